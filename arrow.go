@@ -0,0 +1,304 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"context"
+	"errors"
+	"fmt"
+	"io"
+	"strconv"
+	"time"
+	"unsafe"
+)
+
+// ArrowField describes a column of an ArrowRecordBatch.
+type ArrowField struct {
+	Name string
+	// Format is the Arrow C data interface format string of the column's type:
+	//
+	//	"l"       int64 (integer NUMBERs, BINARY_INTEGER)
+	//	"g"       float64 (other NUMBERs, BINARY_FLOAT, BINARY_DOUBLE)
+	//	"b"       boolean (bit-packed)
+	//	"tsu:"    timestamp[us], without time zone (DATE, TIMESTAMP), as wall clock
+	//	"tsu:UTC" timestamp[us, UTC] (TIMESTAMP WITH (LOCAL) TIME ZONE)
+	//	"u"       utf8 string (with 32-bit offsets)
+	//	"z"       binary (with 32-bit offsets) (RAW)
+	Format   string
+	Nullable bool
+}
+
+// ArrowArray holds the buffers of one column of an ArrowRecordBatch,
+// in the Arrow columnar memory layout (little-endian),
+// so they can be wrapped by an Arrow implementation without copying.
+type ArrowArray struct {
+	// Validity is the validity bitmap: bit (i % 8) of byte (i / 8) is set iff the i-th value is NOT NULL.
+	Validity []byte
+	// Offsets is the offsets buffer of variable length types ("u", "z"), with Length+1 elements.
+	Offsets []int32
+	// Values is the data buffer.
+	Values    []byte
+	Length    int
+	NullCount int
+}
+
+// ArrowRecordBatch is a batch of rows, in the Arrow columnar format.
+//
+// The buffers are reused by the next fetch, so copy or consume them before that.
+type ArrowRecordBatch struct {
+	Fields  []ArrowField
+	Columns []ArrowArray
+	NumRows int
+}
+
+// ArrowFetcher is implemented by the driver.Rows of this driver.
+type ArrowFetcher interface {
+	// FetchArrow fetches the next batch of rows (at most FetchArraySize) into batch.
+	//
+	// Returns io.EOF when there are no more rows.
+	FetchArrow(batch *ArrowRecordBatch) error
+}
+
+var _ ArrowFetcher = (*rows)(nil)
+
+// FetchArrow fetches the next batch of rows (at most FetchArraySize, with one dpiStmt_fetchRows call)
+// into batch, writing fixed width values straight into its Arrow buffers.
+func (r *rows) FetchArrow(batch *ArrowRecordBatch) error {
+	if r.err != nil {
+		return r.err
+	}
+	batch.Fields = resize(batch.Fields, len(r.columns))
+	for i, col := range r.columns {
+		format, err := arrowFormat(col)
+		if err != nil {
+			return fmt.Errorf("%d. column %q: %w", i, col.Name, err)
+		}
+		batch.Fields[i] = ArrowField{Name: col.Name, Format: format, Nullable: col.Nullable}
+	}
+	batch.Columns = resize(batch.Columns, len(r.columns))
+	batch.NumRows = 0
+
+	ctx := context.Background()
+	logger := getLogger(ctx)
+
+	if r.fetched == 0 {
+		if err := r.fetch(ctx, logger); err != nil {
+			return err
+		}
+	}
+	start, n := int(r.bufferRowIndex), int(r.fetched)
+	for i, col := range r.columns {
+		if err := r.fillArrow(&batch.Columns[i], batch.Fields[i].Format, col, r.batchData(i, start, n)); err != nil {
+			return fmt.Errorf("%d. column %q: %w", i, col.Name, err)
+		}
+	}
+	batch.NumRows = n
+	r.bufferRowIndex += C.uint32_t(n)
+	r.fetched = 0
+	return nil
+}
+
+// arrowFormat returns the Arrow format string for the column.
+func arrowFormat(col Column) (string, error) {
+	switch col.NativeType {
+	case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64,
+		C.DPI_NATIVE_TYPE_FLOAT, C.DPI_NATIVE_TYPE_DOUBLE,
+		C.DPI_NATIVE_TYPE_BYTES, C.DPI_NATIVE_TYPE_TIMESTAMP:
+	case C.DPI_NATIVE_TYPE_BOOLEAN:
+		return "b", nil
+	default:
+		return "", fmt.Errorf("column type %d (native %d) is not supported by FetchArrow", col.OracleType, col.NativeType)
+	}
+	switch col.OracleType {
+	case C.DPI_ORACLE_TYPE_RAW, C.DPI_ORACLE_TYPE_LONG_RAW:
+		return "z", nil
+	case C.DPI_ORACLE_TYPE_TIMESTAMP_TZ, C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+		return "tsu:UTC", nil
+	}
+	switch columnKind(col) {
+	case 'i':
+		return "l", nil
+	case 'f':
+		return "g", nil
+	case 't':
+		return "tsu:", nil
+	}
+	return "u", nil
+}
+
+func (r *rows) fillArrow(a *ArrowArray, format string, col Column, data []C.dpiData) error {
+	n := len(data)
+	a.Length, a.NullCount = n, 0
+	a.Validity = resize(a.Validity, (n+7)>>3)
+	clear(a.Validity)
+	for j := range data {
+		if data[j].isNull == 1 {
+			a.NullCount++
+		} else {
+			a.Validity[j>>3] |= 1 << (j & 7)
+		}
+	}
+	natTyp := col.NativeType
+
+	switch format {
+	case "l":
+		a.Offsets = a.Offsets[:0]
+		vs := arrowValues[int64](a, n)
+		for j := range data {
+			d := &data[j]
+			if d.isNull == 1 {
+				vs[j] = 0
+				continue
+			}
+			switch natTyp {
+			case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64:
+				vs[j] = *((*int64)(unsafe.Pointer(&d.value)))
+			case C.DPI_NATIVE_TYPE_BYTES:
+				var err error
+				if vs[j], err = strconv.ParseInt(string(dpiDataBytes(d)), 10, 64); err != nil {
+					return err
+				}
+			default:
+				return fmt.Errorf("cannot convert %d to int64", natTyp)
+			}
+		}
+
+	case "g":
+		a.Offsets = a.Offsets[:0]
+		vs := arrowValues[float64](a, n)
+		for j := range data {
+			d := &data[j]
+			if d.isNull == 1 {
+				vs[j] = 0
+				continue
+			}
+			switch natTyp {
+			case C.DPI_NATIVE_TYPE_INT64:
+				vs[j] = float64(*((*int64)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_UINT64:
+				vs[j] = float64(*((*uint64)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_FLOAT:
+				vs[j] = float64(*((*float32)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_DOUBLE:
+				vs[j] = *((*float64)(unsafe.Pointer(&d.value)))
+			case C.DPI_NATIVE_TYPE_BYTES:
+				var err error
+				if vs[j], err = strconv.ParseFloat(string(dpiDataBytes(d)), 64); err != nil {
+					return err
+				}
+			default:
+				return fmt.Errorf("cannot convert %d to float64", natTyp)
+			}
+		}
+
+	case "b":
+		a.Offsets = a.Offsets[:0]
+		a.Values = resize(a.Values, (n+7)>>3)
+		clear(a.Values)
+		for j := range data {
+			if data[j].isNull != 1 && *((*C.int)(unsafe.Pointer(&data[j].value))) != 0 {
+				a.Values[j>>3] |= 1 << (j & 7)
+			}
+		}
+
+	case "tsu:", "tsu:UTC":
+		a.Offsets = a.Offsets[:0]
+		vs := arrowValues[int64](a, n)
+		loc := time.UTC // wall clock for timestamps without time zone
+		withTZ := format == "tsu:UTC"
+		for j := range data {
+			if data[j].isNull == 1 {
+				vs[j] = 0
+				continue
+			}
+			ts := *((*C.dpiTimestamp)(unsafe.Pointer(&data[j].value)))
+			if withTZ {
+				loc = timeZoneFor(ts.tzHourOffset, ts.tzMinuteOffset, nil)
+			}
+			vs[j] = time.Date(
+				int(ts.year), time.Month(ts.month), int(ts.day),
+				int(ts.hour), int(ts.minute), int(ts.second), int(ts.fsecond),
+				loc,
+			).UnixMicro()
+		}
+
+	case "u", "z":
+		a.Offsets = resize(a.Offsets, n+1)
+		a.Values = a.Values[:0]
+		a.Offsets[0] = 0
+		for j := range data {
+			d := &data[j]
+			if d.isNull != 1 {
+				switch natTyp {
+				case C.DPI_NATIVE_TYPE_BYTES:
+					a.Values = append(a.Values, dpiDataBytes(d)...)
+				case C.DPI_NATIVE_TYPE_INT64:
+					a.Values = strconv.AppendInt(a.Values, *((*int64)(unsafe.Pointer(&d.value))), 10)
+				case C.DPI_NATIVE_TYPE_UINT64:
+					a.Values = strconv.AppendUint(a.Values, *((*uint64)(unsafe.Pointer(&d.value))), 10)
+				case C.DPI_NATIVE_TYPE_DOUBLE:
+					a.Values = strconv.AppendFloat(a.Values, *((*float64)(unsafe.Pointer(&d.value))), 'f', -1, 64)
+				case C.DPI_NATIVE_TYPE_FLOAT:
+					a.Values = strconv.AppendFloat(a.Values, float64(*((*float32)(unsafe.Pointer(&d.value)))), 'f', -1, 32)
+				default:
+					return fmt.Errorf("cannot convert %d to string", natTyp)
+				}
+			}
+			if len(a.Values) > 1<<31-1 {
+				return errors.New("batch too big for 32-bit offsets - decrease FetchArraySize")
+			}
+			a.Offsets[j+1] = int32(len(a.Values))
+		}
+
+	default:
+		return fmt.Errorf("unknown format %q", format)
+	}
+	return nil
+}
+
+// arrowValues resizes a.Values to hold n T values, and returns it as a []T.
+func arrowValues[T int64 | float64](a *ArrowArray, n int) []T {
+	var t T
+	size := int(unsafe.Sizeof(t))
+	// allocate as []T to guarantee the alignment
+	if cap(a.Values) < n*size || uintptr(unsafe.Pointer(unsafe.SliceData(a.Values)))%unsafe.Alignof(t) != 0 {
+		vs := make([]T, n)
+		a.Values = unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(vs))), n*size)
+		return vs
+	}
+	a.Values = a.Values[:n*size]
+	if n == 0 {
+		return nil
+	}
+	return unsafe.Slice((*T)(unsafe.Pointer(unsafe.SliceData(a.Values))), n)
+}
+
+// QueryArrow executes the query qry with args on ex, and calls f with each fetched batch
+// (of at most FetchArraySize rows), in the Arrow columnar format.
+//
+// The buffers of the batch are reused by the next batch, so consume or copy them in f.
+//
+// The args may contain Options, just as with QueryContext.
+func QueryArrow(ctx context.Context, ex Execer, qry string, args []interface{}, f func(*ArrowRecordBatch) error) error {
+	return queryRaw(ctx, ex, qry, args, func(drs *rows) error {
+		var batch ArrowRecordBatch
+		for {
+			if err := drs.FetchArrow(&batch); err != nil {
+				if errors.Is(err, io.EOF) {
+					return nil
+				}
+				return err
+			}
+			if err := f(&batch); err != nil {
+				return err
+			}
+		}
+	})
+}
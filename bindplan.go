@@ -0,0 +1,147 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include <stdlib.h>
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"context"
+	"database/sql/driver"
+	"fmt"
+	"reflect"
+	"runtime"
+	"strconv"
+	"time"
+	"unsafe"
+)
+
+// bindPlan caches what bindVarTypeSwitch derived for the arguments of the last execution,
+// keyed on their types, so re-executions of a prepared statement with the same
+// argument types reuse its variables and go straight to the setters.
+type bindPlan struct {
+	types []reflect.Type
+	names []string
+	infos []argInfo
+	named bool
+}
+
+// plannable reports whether the binding of v depends only on its type
+// (and its length, for the variable's buffer size).
+func plannable(v interface{}) bool {
+	switch v.(type) {
+	case int, int8, int16, int32, int64, uint, uint16, uint32, uint64,
+		float32, float64, string, []byte, Number, time.Time:
+		return true
+	}
+	return false
+}
+
+// plannedBufSize returns the buffer size needed for v.
+func plannedBufSize(v interface{}) int {
+	switch x := v.(type) {
+	case string:
+		return 4 * len(x)
+	case []byte:
+		return len(x)
+	case Number:
+		return len(x)
+	}
+	return 0
+}
+
+// record stores the plan of the just bound args, if all of them are plannable.
+func (p *bindPlan) record(args []driver.NamedValue, infos []argInfo, named bool) {
+	p.types, p.names, p.infos = p.types[:0], p.names[:0], p.infos[:0]
+	for i, a := range args {
+		if !plannable(a.Value) || infos[i].isOut || !infos[i].isIn {
+			p.types, p.names, p.infos = nil, nil, nil
+			return
+		}
+		p.types = append(p.types, reflect.TypeOf(a.Value))
+		p.names = append(p.names, a.Name)
+	}
+	p.infos = append(p.infos, infos...)
+	p.named = named
+}
+
+// matches reports whether args have the same types as the recorded ones.
+func (p *bindPlan) matches(args []driver.NamedValue) bool {
+	if len(args) == 0 || len(args) != len(p.types) {
+		return false
+	}
+	for i, a := range args {
+		if a.Name != p.names[i] || reflect.TypeOf(a.Value) != p.types[i] {
+			return false
+		}
+	}
+	return true
+}
+
+// bindPlanned binds args using st.bindPlan, if it matches them.
+// The variables are reused (only string and []byte ones are reallocated, when they grow),
+// and bound again only when any of them has been reallocated.
+func (st *statement) bindPlanned(ctx context.Context, args []driver.NamedValue) (bool, error) {
+	p := &st.bindPlan
+	if !p.matches(args) || len(st.vars) != len(args) || len(st.data) != len(args) {
+		return false, nil
+	}
+	st.arrLen = -1
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+	var rebind bool
+	for i, a := range args {
+		st.gets[i], st.dests[i], st.isSlice[i] = nil, a.Value, false
+		if st.vars[i] == nil {
+			p.types = nil
+			return false, nil
+		}
+		if n := plannedBufSize(a.Value); n > st.varInfos[i].BufSize {
+			vi := st.varInfos[i]
+			vi.BufSize = n
+			C.dpiVar_release(st.vars[i])
+			st.vars[i], st.data[i] = nil, nil
+			var err error
+			if st.vars[i], st.data[i], err = st.newVar(vi); err != nil {
+				p.types = nil
+				return true, fmt.Errorf("%d: %w", i, err)
+			}
+			st.varInfos[i] = vi
+			rebind = true
+		}
+		if err := p.infos[i].set(ctx, st.vars[i], st.data[i][:1], a.Value); err != nil {
+			p.types = nil
+			return true, fmt.Errorf("set(data[%d][%d], %#v (%T)): %w", i, 0, a.Value, a.Value, err)
+		}
+	}
+	if !rebind {
+		return true, nil
+	}
+	for i, a := range args {
+		i, v := i, st.vars[i]
+		if !p.named {
+			if err := st.checkExecNoLOT(func() C.int { return C.dpiStmt_bindByPos(st.dpiStmt, C.uint32_t(i+1), v) }); err != nil {
+				p.types = nil
+				return true, fmt.Errorf("bindByPos[%d]: %w", i, err)
+			}
+			continue
+		}
+		name := a.Name
+		if name == "" {
+			name = strconv.Itoa(a.Ordinal)
+		}
+		cName := C.CString(name)
+		err := st.checkExecNoLOT(func() C.int { return C.dpiStmt_bindByName(st.dpiStmt, cName, C.uint32_t(len(name)), v) })
+		C.free(unsafe.Pointer(cName))
+		if err != nil {
+			p.types = nil
+			return true, fmt.Errorf("bindByName[%q]: %w", name, err)
+		}
+	}
+	return true, nil
+}
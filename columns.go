@@ -0,0 +1,414 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"context"
+	"database/sql"
+	"database/sql/driver"
+	"errors"
+	"fmt"
+	"io"
+	"strconv"
+	"time"
+	"unsafe"
+)
+
+// ColumnBuffer receives one column of a batch fetched by FetchColumns.
+//
+// Exactly one of the typed slices is filled: the one which is non-nil,
+// or if all are nil, the one matching the column's type
+// (Int64 for integer NUMBERs, Float64 for other NUMBERs and BINARY_FLOAT/DOUBLE,
+// Time for DATEs and TIMESTAMPs, String for everything else supported).
+//
+// The slices are reused (resliced) between batches, and grown when needed.
+type ColumnBuffer struct {
+	Int64   []int64
+	Float64 []float64
+	Time    []time.Time
+	String  []string
+	// Nulls is a bitmap with bit (i % 8) of byte (i / 8) set iff the i-th value is NULL.
+	// The corresponding typed value is the zero value.
+	Nulls []byte
+
+	// VECTOR columns are fetched into one contiguous slice, row after row,
+	// Dimensions values per row (Dimensions/8 bytes for VectorBinary):
+	// the one which is non-nil, or if all are nil, the one matching the column's format.
+	// The values of a NULL row are zeros.
+	VectorFloat32 []float32
+	VectorFloat64 []float64
+	VectorInt8    []int8
+	VectorBinary  []uint8
+	// Dimensions is the number of dimensions of the vectors.
+	// It is set from the column's description, so it must be set only for
+	// columns with flexible dimensions (VECTOR(*, ...)), where all vectors must have the same dimensions.
+	Dimensions int
+}
+
+// IsNull reports whether the i-th value of the batch is NULL.
+func (cb *ColumnBuffer) IsNull(i int) bool { return cb.Nulls[i>>3]&(1<<(i&7)) != 0 }
+
+// ColumnFetcher is implemented by the driver.Rows of this driver.
+type ColumnFetcher interface {
+	// FetchColumns fetches the next batch of rows (at most FetchArraySize),
+	// directly into the typed column slices of dest (one for each column),
+	// and returns the number of rows fetched.
+	//
+	// Returns io.EOF when there are no more rows.
+	FetchColumns(dest []ColumnBuffer) (int, error)
+}
+
+var _ ColumnFetcher = (*rows)(nil)
+
+// FetchColumns fetches the next batch of rows (at most FetchArraySize, with one dpiStmt_fetchRows call),
+// directly into the typed column slices of dest (one for each column),
+// without allocating a driver.Value for each cell.
+//
+// Returns the number of rows fetched, or io.EOF when there are no more rows.
+func (r *rows) FetchColumns(dest []ColumnBuffer) (int, error) {
+	if r.err != nil {
+		return 0, r.err
+	}
+	if len(dest) != len(r.columns) {
+		return 0, fmt.Errorf("column count mismatch: we have %d columns, but given %d destination", len(r.columns), len(dest))
+	}
+	ctx := context.Background()
+	logger := getLogger(ctx)
+
+	if r.fetched == 0 {
+		if err := r.fetch(ctx, logger); err != nil {
+			return 0, err
+		}
+	}
+	start, n := int(r.bufferRowIndex), int(r.fetched)
+	for i, col := range r.columns {
+		var err error
+		if col.OracleType == C.DPI_ORACLE_TYPE_VECTOR {
+			err = r.fillVectors(&dest[i], col, r.vars[i], start, r.data[i][start:start+n])
+		} else {
+			err = r.fillColumn(&dest[i], col, r.batchData(i, start, n))
+		}
+		if err != nil {
+			return 0, fmt.Errorf("%d. column %q: %w", i, col.Name, err)
+		}
+	}
+	r.bufferRowIndex += C.uint32_t(n)
+	r.fetched = 0
+	return n, nil
+}
+
+// columnKind returns which slice of a ColumnBuffer should receive col by default.
+func columnKind(col Column) byte {
+	switch col.OracleType {
+	case C.DPI_ORACLE_TYPE_NUMBER:
+		switch col.NativeType {
+		case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64:
+			return 'i'
+		}
+		return 'f'
+	case C.DPI_ORACLE_TYPE_NATIVE_INT, C.DPI_ORACLE_TYPE_NATIVE_UINT:
+		return 'i'
+	case C.DPI_ORACLE_TYPE_NATIVE_FLOAT, C.DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+		return 'f'
+	case C.DPI_ORACLE_TYPE_DATE, C.DPI_ORACLE_TYPE_TIMESTAMP,
+		C.DPI_ORACLE_TYPE_TIMESTAMP_TZ, C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+		return 't'
+	}
+	return 's'
+}
+
+// setNulls sets the Nulls bitmap of cb from data.
+func (cb *ColumnBuffer) setNulls(data []C.dpiData) {
+	nb := (len(data) + 7) >> 3
+	if cap(cb.Nulls) < nb {
+		cb.Nulls = make([]byte, nb)
+	} else {
+		cb.Nulls = cb.Nulls[:nb]
+		clear(cb.Nulls)
+	}
+	for j := range data {
+		if data[j].isNull == 1 {
+			cb.Nulls[j>>3] |= 1 << (j & 7)
+		}
+	}
+}
+
+func (r *rows) fillColumn(cb *ColumnBuffer, col Column, data []C.dpiData) error {
+	n := len(data)
+	cb.setNulls(data)
+
+	kind := columnKind(col)
+	switch {
+	case cb.Int64 != nil:
+		kind = 'i'
+	case cb.Float64 != nil:
+		kind = 'f'
+	case cb.Time != nil:
+		kind = 't'
+	case cb.String != nil:
+		kind = 's'
+	}
+	natTyp := col.NativeType
+	switch natTyp {
+	case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64,
+		C.DPI_NATIVE_TYPE_FLOAT, C.DPI_NATIVE_TYPE_DOUBLE,
+		C.DPI_NATIVE_TYPE_BYTES, C.DPI_NATIVE_TYPE_TIMESTAMP,
+		C.DPI_NATIVE_TYPE_BOOLEAN:
+	default:
+		return fmt.Errorf("column type %d (native %d) is not supported by FetchColumns", col.OracleType, natTyp)
+	}
+
+	switch kind {
+	case 'i':
+		cb.Int64 = resize(cb.Int64, n)
+		for j := range data {
+			if data[j].isNull == 1 {
+				cb.Int64[j] = 0
+				continue
+			}
+			d := &data[j]
+			switch natTyp {
+			case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64:
+				cb.Int64[j] = *((*int64)(unsafe.Pointer(&d.value)))
+			case C.DPI_NATIVE_TYPE_FLOAT:
+				cb.Int64[j] = int64(*((*float32)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_DOUBLE:
+				cb.Int64[j] = int64(*((*float64)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_BOOLEAN:
+				cb.Int64[j] = int64(*((*C.int)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_BYTES:
+				b := dpiDataBytes(d)
+				var err error
+				if cb.Int64[j], err = strconv.ParseInt(string(b), 10, 64); err != nil {
+					return err
+				}
+			default:
+				return fmt.Errorf("cannot convert %d to int64", natTyp)
+			}
+		}
+
+	case 'f':
+		cb.Float64 = resize(cb.Float64, n)
+		for j := range data {
+			if data[j].isNull == 1 {
+				cb.Float64[j] = 0
+				continue
+			}
+			d := &data[j]
+			switch natTyp {
+			case C.DPI_NATIVE_TYPE_INT64:
+				cb.Float64[j] = float64(*((*int64)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_UINT64:
+				cb.Float64[j] = float64(*((*uint64)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_FLOAT:
+				cb.Float64[j] = float64(*((*float32)(unsafe.Pointer(&d.value))))
+			case C.DPI_NATIVE_TYPE_DOUBLE:
+				cb.Float64[j] = *((*float64)(unsafe.Pointer(&d.value)))
+			case C.DPI_NATIVE_TYPE_BYTES:
+				b := dpiDataBytes(d)
+				var err error
+				if cb.Float64[j], err = strconv.ParseFloat(string(b), 64); err != nil {
+					return err
+				}
+			default:
+				return fmt.Errorf("cannot convert %d to float64", natTyp)
+			}
+		}
+
+	case 't':
+		if natTyp != C.DPI_NATIVE_TYPE_TIMESTAMP {
+			return fmt.Errorf("cannot convert %d to time.Time", natTyp)
+		}
+		cb.Time = resize(cb.Time, n)
+		tz := r.conn.Timezone()
+		if tz == nil {
+			tz = time.Local
+		}
+		withTZ := col.OracleType == C.DPI_ORACLE_TYPE_TIMESTAMP_TZ || col.OracleType == C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ
+		for j := range data {
+			if data[j].isNull == 1 {
+				cb.Time[j] = time.Time{}
+				continue
+			}
+			ts := *((*C.dpiTimestamp)(unsafe.Pointer(&data[j].value)))
+			loc := tz
+			if withTZ {
+				if loc = timeZoneFor(ts.tzHourOffset, ts.tzMinuteOffset, nil); loc == nil {
+					loc = tz
+				}
+			}
+			cb.Time[j] = time.Date(
+				int(ts.year), time.Month(ts.month), int(ts.day),
+				int(ts.hour), int(ts.minute), int(ts.second), int(ts.fsecond),
+				loc,
+			)
+		}
+
+	default:
+		cb.String = resize(cb.String, n)
+		for j := range data {
+			if data[j].isNull == 1 {
+				cb.String[j] = ""
+				continue
+			}
+			d := &data[j]
+			switch natTyp {
+			case C.DPI_NATIVE_TYPE_BYTES:
+				cb.String[j] = string(dpiDataBytes(d))
+			case C.DPI_NATIVE_TYPE_INT64:
+				cb.String[j] = strconv.FormatInt(*((*int64)(unsafe.Pointer(&d.value))), 10)
+			case C.DPI_NATIVE_TYPE_UINT64:
+				cb.String[j] = strconv.FormatUint(*((*uint64)(unsafe.Pointer(&d.value))), 10)
+			case C.DPI_NATIVE_TYPE_FLOAT:
+				cb.String[j] = string(printFloat(float64(*((*float32)(unsafe.Pointer(&d.value))))))
+			case C.DPI_NATIVE_TYPE_DOUBLE:
+				cb.String[j] = string(printFloat(*((*float64)(unsafe.Pointer(&d.value)))))
+			case C.DPI_NATIVE_TYPE_BOOLEAN:
+				cb.String[j] = strconv.FormatBool(*((*C.int)(unsafe.Pointer(&d.value))) == 1)
+			default:
+				return fmt.Errorf("cannot convert %d to string", natTyp)
+			}
+		}
+	}
+	return nil
+}
+
+// fillVectors copies the vectors of the batch (starting at start in v)
+// into the contiguous slice of cb, with one dpiVar_getVectorValues call,
+// without allocating the dimensions of each vector, and without Vector values.
+func (r *rows) fillVectors(cb *ColumnBuffer, col Column, v *C.dpiVar, start int, data []C.dpiData) error {
+	if col.VectorFlags&C.DPI_VECTOR_FLAGS_SPARSE != 0 {
+		return errors.New("SPARSE vectors are not supported by FetchColumns")
+	}
+	n := len(data)
+	cb.setNulls(data)
+	if col.VectorDimensions != 0 {
+		cb.Dimensions = int(col.VectorDimensions)
+	} else if cb.Dimensions <= 0 {
+		return errors.New("the Dimensions of a flexible dimension VECTOR column must be set")
+	}
+	dims := cb.Dimensions
+	format := col.VectorFormat
+	switch {
+	case cb.VectorFloat32 != nil:
+		format = C.DPI_VECTOR_FORMAT_FLOAT32
+	case cb.VectorFloat64 != nil:
+		format = C.DPI_VECTOR_FORMAT_FLOAT64
+	case cb.VectorInt8 != nil:
+		format = C.DPI_VECTOR_FORMAT_INT8
+	case cb.VectorBinary != nil:
+		format = C.DPI_VECTOR_FORMAT_BINARY
+	}
+	var ptr unsafe.Pointer
+	switch format {
+	case C.DPI_VECTOR_FORMAT_FLOAT32:
+		cb.VectorFloat32 = resize(cb.VectorFloat32, n*dims)
+		ptr = unsafe.Pointer(unsafe.SliceData(cb.VectorFloat32))
+	case C.DPI_VECTOR_FORMAT_FLOAT64:
+		cb.VectorFloat64 = resize(cb.VectorFloat64, n*dims)
+		ptr = unsafe.Pointer(unsafe.SliceData(cb.VectorFloat64))
+	case C.DPI_VECTOR_FORMAT_INT8:
+		cb.VectorInt8 = resize(cb.VectorInt8, n*dims)
+		ptr = unsafe.Pointer(unsafe.SliceData(cb.VectorInt8))
+	case C.DPI_VECTOR_FORMAT_BINARY:
+		if dims%8 != 0 {
+			return fmt.Errorf("BINARY vector dimensions (%d) must be a multiple of 8", dims)
+		}
+		cb.VectorBinary = resize(cb.VectorBinary, n*dims/8)
+		ptr = unsafe.Pointer(unsafe.SliceData(cb.VectorBinary))
+	default:
+		return fmt.Errorf("vector format %d is not known, set one of the Vector slices of the ColumnBuffer", format)
+	}
+	if n == 0 {
+		return nil
+	}
+	return r.checkExec(func() C.int {
+		return C.dpiVar_getVectorValues(v, C.uint32_t(start), C.uint32_t(n), format, C.uint32_t(dims), ptr)
+	})
+}
+
+// dpiDataBytes returns the bytes of d, without copying.
+func dpiDataBytes(d *C.dpiData) []byte {
+	b := (*C.dpiBytes)(unsafe.Pointer(&d.value))
+	if b.length == 0 {
+		return nil
+	}
+	return unsafe.Slice((*byte)(unsafe.Pointer(b.ptr)), b.length)
+}
+
+func resize[T any](s []T, n int) []T {
+	if cap(s) < n {
+		return make([]T, n)
+	}
+	return s[:n]
+}
+
+// QueryColumns executes the query qry with args on ex, and calls f after each batch
+// (of at most FetchArraySize rows) has been fetched into dest, with the number of rows in the batch.
+//
+// dest is resized to the number of columns if its length does not match.
+// The slices in dest are overwritten by the next batch, so copy what you need to keep.
+//
+// The args may contain Options, just as with QueryContext.
+func QueryColumns(ctx context.Context, ex Execer, qry string, args []interface{}, dest []ColumnBuffer, f func(dest []ColumnBuffer, n int) error) error {
+	return queryRaw(ctx, ex, qry, args, func(r *rows) error {
+		if n := len(r.columns); len(dest) != n {
+			dest = resize(dest, n)
+		}
+		for {
+			n, err := r.FetchColumns(dest)
+			if err != nil {
+				if errors.Is(err, io.EOF) {
+					return nil
+				}
+				return err
+			}
+			if err = f(dest, n); err != nil {
+				return err
+			}
+		}
+	})
+}
+
+// queryRaw executes qry with args on the driver connection of ex, and calls f with the resulting rows.
+func queryRaw(ctx context.Context, ex Execer, qry string, args []interface{}, f func(*rows) error) error {
+	return Raw(ctx, ex, func(c Conn) error {
+		dst, err := c.PrepareContext(ctx, qry)
+		if err != nil {
+			return err
+		}
+		defer dst.Close()
+		st := dst.(*statement)
+		nargs := make([]driver.NamedValue, 0, len(args))
+		for _, a := range args {
+			nv := driver.NamedValue{Ordinal: len(nargs) + 1, Value: a}
+			if na, ok := a.(sql.NamedArg); ok {
+				nv.Name, nv.Value = na.Name, na.Value
+			}
+			if err := st.CheckNamedValue(&nv); err != nil {
+				if errors.Is(err, driver.ErrRemoveArgument) {
+					continue
+				}
+				return err
+			}
+			nargs = append(nargs, nv)
+		}
+		drs, err := st.QueryContext(ctx, nargs)
+		if err != nil {
+			return err
+		}
+		defer drs.Close()
+		r, ok := drs.(*rows)
+		if !ok {
+			return fmt.Errorf("%T is not a *rows", drs)
+		}
+		return f(r)
+	})
+}
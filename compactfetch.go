@@ -0,0 +1,98 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// compactColumn holds the raw arrays of a column fetched into a compact variable (see CompactFetch).
+//
+// load fills data with the value of a row, so the column decoders
+// and the generic path of Next can handle it as any other column.
+type compactColumn struct {
+	values     unsafe.Pointer
+	indicators []C.int16_t
+	lengths    []C.uint32_t
+	valueSize  uintptr
+	data       C.dpiData
+	isBytes    bool
+}
+
+// compactable reports whether the query variable described by vi can be compact:
+// the OCI buffer of its type needs no conversion, and it is not dynamic.
+func compactable(vi varInfo) bool {
+	if vi.ObjectType != nil || vi.IsPLSArray {
+		return false
+	}
+	switch vi.Typ {
+	case C.DPI_ORACLE_TYPE_VARCHAR, C.DPI_ORACLE_TYPE_NVARCHAR,
+		C.DPI_ORACLE_TYPE_CHAR, C.DPI_ORACLE_TYPE_NCHAR, C.DPI_ORACLE_TYPE_RAW:
+		return vi.NatTyp == C.DPI_NATIVE_TYPE_BYTES && vi.BufSize <= C.DPI_MAX_BASIC_BUFFER_SIZE
+	case C.DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+		return vi.NatTyp == C.DPI_NATIVE_TYPE_DOUBLE
+	case C.DPI_ORACLE_TYPE_NATIVE_FLOAT:
+		return vi.NatTyp == C.DPI_NATIVE_TYPE_FLOAT
+	}
+	return false
+}
+
+// newCompactColumn returns the arrays of the compact variable v, of sliceLen rows.
+func (c *conn) newCompactColumn(v *C.dpiVar, sliceLen int) (compactColumn, error) {
+	var arrays C.dpiVarArrays
+	if err := c.checkExec(func() C.int { return C.dpiVar_getArrays(v, &arrays) }); err != nil {
+		return compactColumn{}, fmt.Errorf("getArrays: %w", err)
+	}
+	cc := compactColumn{
+		values:     arrays.values,
+		indicators: unsafe.Slice(arrays.indicators, sliceLen),
+		valueSize:  uintptr(arrays.valueSize),
+		isBytes:    v.nativeTypeNum == C.DPI_NATIVE_TYPE_BYTES,
+	}
+	if cc.isBytes {
+		cc.lengths = unsafe.Slice(arrays.lengths, sliceLen)
+	}
+	return cc, nil
+}
+
+// load returns the value of the row, in cc.data.
+func (cc *compactColumn) load(row C.uint32_t) *C.dpiData {
+	d := &cc.data
+	if cc.indicators[row] == C.DPI_OCI_IND_NULL {
+		d.isNull = 1
+		return d
+	}
+	d.isNull = 0
+	p := unsafe.Add(cc.values, uintptr(row)*cc.valueSize)
+	if cc.isBytes {
+		b := (*C.dpiBytes)(unsafe.Pointer(&d.value))
+		b.ptr, b.length = (*C.char)(p), cc.lengths[row]
+	} else {
+		copy(unsafe.Slice((*byte)(unsafe.Pointer(&d.value)), cc.valueSize), unsafe.Slice((*byte)(p), cc.valueSize))
+	}
+	return d
+}
+
+// batchData returns the data of the n rows of the i-th column from start,
+// for FetchColumns and FetchArrow: a slice of r.data, or for a compact column,
+// the rows loaded into r.compactBatch, so valid only till the next call.
+func (r *rows) batchData(i, start, n int) []C.dpiData {
+	if r.compact == nil || r.compact[i].values == nil {
+		return r.data[i][start : start+n]
+	}
+	cc := &r.compact[i]
+	r.compactBatch = resize(r.compactBatch, n)
+	data := r.compactBatch
+	for j := range data {
+		data[j] = *cc.load(C.uint32_t(start + j))
+	}
+	return data
+}
@@ -65,6 +65,10 @@ type conn struct {
 	params              dsn.ConnectionParams
 	mu                  sync.RWMutex
 	objTypes            map[string]*ObjectType
+	varArena            varArena
+	stats               connCounters
+	poolStats           *connCounters
+	poolServer          *atomic.Pointer[VersionInfo]
 	tzOffSecs           int
 	inTransaction       bool
 	released            bool
@@ -196,6 +200,7 @@ func (c *conn) Ping(ctx context.Context) error {
 	}
 	err = c.checkExec(func() C.int { return C.dpiConn_ping(c.dpiConn) })
 	cleanup()
+	c.countPing()
 	if err != nil {
 		return maybeBadConn(fmt.Errorf("Ping: %w", err), c)
 	}
@@ -248,6 +253,23 @@ func (c *conn) closeNotLocking() error {
 		_ = v.Close()
 		delete(c.objTypes, k)
 	}
+	c.varArena.release()
+
+	// return a tagged session to the pool with its tag, for the next acquisition with the same tag.
+	// dpiConn_close closes the statements and LOBs still open, so it does not matter who else holds dpiConn;
+	// if it fails, dpiConn_release returns the session untagged.
+	if tag := c.params.SessionTag; tag != "" && c.poolKey != "" {
+		cTag := C.CString(tag)
+		err := c.checkExec(func() C.int {
+			return C.dpiConn_close(dpiConn, C.DPI_MODE_CONN_CLOSE_RETAG, cTag, C.uint32_t(len(tag)))
+		})
+		C.free(unsafe.Pointer(cTag))
+		if err != nil {
+			if logger := getLogger(context.TODO()); logger != nil {
+				logger.Warn("retag on close", "tag", tag, "error", err)
+			}
+		}
+	}
 
 	// dpiConn_release decrements dpiConn's reference counting,
 	// and closes it when it reaches zero.
@@ -403,6 +425,7 @@ func (c *conn) endTran(isCommit bool) error {
 
 	var err error
 	//msg := "Commit"
+	c.countEndTran(isCommit)
 	if isCommit {
 		if err = c.checkExec(func() C.int { return C.dpiConn_commit(c.dpiConn) }); err != nil {
 			err = maybeBadConn(fmt.Errorf("Commit: %w", err), c)
@@ -423,6 +446,7 @@ type varInfo struct {
 	NatTyp            C.dpiNativeTypeNum
 	Typ               C.dpiOracleTypeNum
 	IsPLSArray        bool
+	Compact           bool // query variable without dpiData, see CompactFetch
 }
 
 func (c *conn) newVar(vi varInfo) (*C.dpiVar, []C.dpiData, error) {
@@ -442,6 +466,17 @@ func (c *conn) newVar(vi varInfo) (*C.dpiVar, []C.dpiData, error) {
 	if logger != nil {
 		logger.Debug("dpiConn_newVar", "conn", c.dpiConn, "typ", int(vi.Typ), "natTyp", int(vi.NatTyp), "sliceLen", vi.SliceLen, "bufSize", vi.BufSize, "isArray", isArray, "objType", vi.ObjectType, "v", v)
 	}
+	if vi.Compact {
+		if err := c.checkExec(func() C.int {
+			return C.dpiConn_newCompactVar(
+				c.dpiConn, vi.Typ, vi.NatTyp, C.uint32_t(vi.SliceLen),
+				C.uint32_t(vi.BufSize), 1, &v,
+			)
+		}); err != nil {
+			return nil, nil, fmt.Errorf("newCompactVar(typ=%d, natTyp=%d, sliceLen=%d, bufSize=%d): %w", vi.Typ, vi.NatTyp, vi.SliceLen, vi.BufSize, err)
+		}
+		return v, nil, nil
+	}
 	if err := c.checkExec(func() C.int {
 		return C.dpiConn_newVar(
 			c.dpiConn, vi.Typ, vi.NatTyp, C.uint32_t(vi.SliceLen),
@@ -475,6 +510,10 @@ func (c *conn) ServerVersion() (VersionInfo, error) {
 		//((*[1024]byte)(unsafe.Pointer(release)))[:releaseLen:releaseLen],
 		([]byte)(unsafe.Slice((*byte)(unsafe.Pointer(release)), releaseLen)),
 		[]byte{'\n'}, []byte{';', ' '}, -1))
+	if c.poolServer != nil {
+		v := c.Server
+		c.poolServer.Store(&v)
+	}
 
 	return c.Server, nil
 }
@@ -909,13 +948,15 @@ func (c *conn) GetPoolStats() (stats PoolStats, err error) {
 		return stats, nil
 	}
 
-	drv.mu.RLock()
-	pool := drv.pools[key]
-	drv.mu.RUnlock()
-	if pool == nil {
+	pools := drv.pools.Load()
+	if pools == nil {
 		return stats, nil
 	}
-	return drv.getPoolStats(pool)
+	pool, ok := pools.Load(key)
+	if !ok {
+		return stats, nil
+	}
+	return drv.getPoolStats(pool.(*connPool))
 }
 
 type traceTagCtxKey struct{}
@@ -962,8 +1003,9 @@ func (tt TraceTag) String() string {
 }
 
 type (
-	paramsCtxKey    struct{}
-	userPasswCtxKey struct{}
+	paramsCtxKey     struct{}
+	userPasswCtxKey  struct{}
+	sessionTagCtxKey struct{}
 
 	// UserPasswdConnClassTag consists of Username, Password
 	// and ConnectionClass values that can be set with ContextWithUserPassw
@@ -1010,6 +1052,23 @@ func ContextWithUserPassw(ctx context.Context, user, password, connClass string)
 			ConnClass: connClass})
 }
 
+// ContextWithSessionTag returns a context with the specified session tag (workload key),
+// to acquire the session from the pool which was released with the same tag, if there is one.
+//
+// Sessions acquired with a tag are returned to the pool with that tag,
+// so the sessions of each workload keep their session state (NLS settings, time zone
+// and whatever the OnInit function sets) and their warm statement caches.
+// When no such session is found, the acquired one is treated as new,
+// so the OnInit function runs for it even with InitOnNewConn.
+//
+// As with ContextWithUserPassw, this only affects acquisitions from the pool,
+// so disable the Go connection pool with DB.SetMaxIdleConns(0), or use DB.Conn.
+//
+// If a standalone connection is being used this will have no effect.
+func ContextWithSessionTag(ctx context.Context, tag string) context.Context {
+	return context.WithValue(ctx, sessionTagCtxKey{}, tag)
+}
+
 // StartupMode for the database.
 type StartupMode C.dpiStartupMode
 
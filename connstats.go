@@ -0,0 +1,203 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+import (
+	"context"
+	"fmt"
+	"log/slog"
+	"sync/atomic"
+	"time"
+)
+
+// ConnStats are the cumulative counters of the calls of a connection
+// (see GetConnStats), or of all the connections of a pool (PoolStats.Conn).
+//
+// They are always collected, as they cost only a few atomic additions per call,
+// and help finding N+1 query and slow fetch patterns.
+type ConnStats struct {
+	// Executes is the number of statement executions (an array DML counts as one).
+	Executes uint64
+	// Fetches is the number of fetches, each of (at most) FetchArraySize rows.
+	Fetches uint64
+	// RowsFetched is the number of rows returned by the fetches.
+	RowsFetched uint64
+	// Commits, Rollbacks and Pings are the number of such calls.
+	Commits, Rollbacks, Pings uint64
+	// Acquires is the number of sessions created (or acquired from the pool).
+	Acquires uint64
+	// ExecuteTime, FetchTime and AcquireTime are the time spent blocked in these calls.
+	// AcquireTime includes the waits for a free session of the pool.
+	ExecuteTime, FetchTime, AcquireTime time.Duration
+}
+
+// Calls returns the number of the counted calls to the server.
+//
+// This is an upper bound of the round trips: a fetch may be served from the prefetched rows,
+// and the session of an acquire may be an idle one of the pool.
+func (s ConnStats) Calls() uint64 {
+	return s.Executes + s.Fetches + s.Commits + s.Rollbacks + s.Pings + s.Acquires
+}
+
+func (s ConnStats) String() string {
+	return fmt.Sprintf("executes=%d (%s) fetches=%d (%s) rows=%d commits=%d rollbacks=%d pings=%d acquires=%d (%s)",
+		s.Executes, s.ExecuteTime, s.Fetches, s.FetchTime, s.RowsFetched,
+		s.Commits, s.Rollbacks, s.Pings, s.Acquires, s.AcquireTime)
+}
+
+// LogValue implements slog.LogValuer, to log the ConnStats as a group.
+func (s ConnStats) LogValue() slog.Value {
+	return slog.GroupValue(
+		slog.Uint64("executes", s.Executes), slog.Duration("executeTime", s.ExecuteTime),
+		slog.Uint64("fetches", s.Fetches), slog.Duration("fetchTime", s.FetchTime),
+		slog.Uint64("rowsFetched", s.RowsFetched),
+		slog.Uint64("commits", s.Commits), slog.Uint64("rollbacks", s.Rollbacks),
+		slog.Uint64("pings", s.Pings),
+		slog.Uint64("acquires", s.Acquires), slog.Duration("acquireTime", s.AcquireTime),
+		slog.Uint64("calls", s.Calls()),
+	)
+}
+
+// Sub returns the difference of the counters, for measuring an interval.
+func (s ConnStats) Sub(t ConnStats) ConnStats {
+	return ConnStats{
+		Executes: s.Executes - t.Executes, Fetches: s.Fetches - t.Fetches,
+		RowsFetched: s.RowsFetched - t.RowsFetched,
+		Commits:     s.Commits - t.Commits, Rollbacks: s.Rollbacks - t.Rollbacks,
+		Pings: s.Pings - t.Pings, Acquires: s.Acquires - t.Acquires,
+		ExecuteTime: s.ExecuteTime - t.ExecuteTime, FetchTime: s.FetchTime - t.FetchTime,
+		AcquireTime: s.AcquireTime - t.AcquireTime,
+	}
+}
+
+// connCounters are the atomic counters behind ConnStats.
+type connCounters struct {
+	executes, fetches, rowsFetched      atomic.Uint64
+	commits, rollbacks, pings           atomic.Uint64
+	acquires                            atomic.Uint64
+	executeTime, fetchTime, acquireTime atomic.Int64
+}
+
+func (cc *connCounters) snapshot() ConnStats {
+	if cc == nil {
+		return ConnStats{}
+	}
+	return ConnStats{
+		Executes: cc.executes.Load(), Fetches: cc.fetches.Load(), RowsFetched: cc.rowsFetched.Load(),
+		Commits: cc.commits.Load(), Rollbacks: cc.rollbacks.Load(), Pings: cc.pings.Load(),
+		Acquires:    cc.acquires.Load(),
+		ExecuteTime: time.Duration(cc.executeTime.Load()),
+		FetchTime:   time.Duration(cc.fetchTime.Load()),
+		AcquireTime: time.Duration(cc.acquireTime.Load()),
+	}
+}
+
+// counters returns the counters of the connection and of its pool (if any).
+func (c *conn) counters() [2]*connCounters {
+	if c == nil {
+		return [2]*connCounters{}
+	}
+	return [2]*connCounters{&c.stats, c.poolStats}
+}
+
+func (c *conn) countExecute(start time.Time) {
+	d := int64(time.Since(start))
+	for _, cc := range c.counters() {
+		if cc != nil {
+			cc.executes.Add(1)
+			cc.executeTime.Add(d)
+		}
+	}
+}
+
+func (c *conn) countFetch(start time.Time, rows uint32) {
+	d := int64(time.Since(start))
+	for _, cc := range c.counters() {
+		if cc != nil {
+			cc.fetches.Add(1)
+			cc.rowsFetched.Add(uint64(rows))
+			cc.fetchTime.Add(d)
+		}
+	}
+}
+
+func (c *conn) countEndTran(isCommit bool) {
+	for _, cc := range c.counters() {
+		if cc == nil {
+			continue
+		}
+		if isCommit {
+			cc.commits.Add(1)
+		} else {
+			cc.rollbacks.Add(1)
+		}
+	}
+}
+
+func (c *conn) countPing() {
+	for _, cc := range c.counters() {
+		if cc != nil {
+			cc.pings.Add(1)
+		}
+	}
+}
+
+func (c *conn) countAcquire(d time.Duration) {
+	for _, cc := range c.counters() {
+		if cc != nil {
+			cc.acquires.Add(1)
+			cc.acquireTime.Add(int64(d))
+		}
+	}
+}
+
+// GetConnStats returns the cumulative counters of the connection of ex.
+//
+// For connection pools (*sql.DB) this is the connection acquired for the call,
+// use PoolStats.Conn for the counters of the pool.
+func GetConnStats(ctx context.Context, ex Execer) (stats ConnStats, err error) {
+	err = Raw(ctx, ex, func(c Conn) error {
+		cx, ok := c.(*conn)
+		if !ok {
+			return fmt.Errorf("%T is not a godror connection", c)
+		}
+		stats = cx.stats.snapshot()
+		return nil
+	})
+	return stats, err
+}
+
+// LogStats logs the PoolStats of the pool of db with logger at every interval, till ctx is done,
+// as "godror.stats" records, with the ConnStats of the interval (under "delta") as a group.
+func LogStats(ctx context.Context, logger *slog.Logger, db Execer, interval time.Duration) error {
+	if logger == nil {
+		return nil
+	}
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+	var prev ConnStats
+	for {
+		select {
+		case <-ctx.Done():
+			return ctx.Err()
+		case <-ticker.C:
+		}
+		var stats PoolStats
+		if err := Raw(ctx, db, func(c Conn) (err error) {
+			stats, err = c.GetPoolStats()
+			return err
+		}); err != nil {
+			if ctx.Err() != nil {
+				return ctx.Err()
+			}
+			logger.Warn("godror.stats", "error", err)
+			continue
+		}
+		logger.LogAttrs(ctx, slog.LevelInfo, "godror.stats",
+			slog.Any("pool", stats), slog.Any("delta", stats.Conn.Sub(prev)))
+		prev = stats.Conn
+	}
+}
@@ -31,6 +31,8 @@ type Data struct {
 	dpiData       C.dpiData
 	implicitObj   bool
 	NativeTypeNum C.dpiNativeTypeNum
+	// buf keeps the buffer of a NUMBER got as bytes by the bulk getters alive.
+	buf []byte
 }
 
 const (
@@ -638,6 +640,7 @@ func (d *Data) reset() {
 	d.NativeTypeNum = 0
 	d.ObjectType = nil
 	d.implicitObj = false
+	d.buf = nil
 	d.SetBytes(nil)
 	d.dpiData.isNull = 1
 }
@@ -0,0 +1,318 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"context"
+	"errors"
+	"fmt"
+	"runtime"
+	"time"
+	"unsafe"
+)
+
+// BatchColumnType is the type of the values of a DirectBatch column.
+type BatchColumnType uint8
+
+const (
+	// BatchInt64 values are bound as NUMBER.
+	BatchInt64 = BatchColumnType(iota + 1)
+	// BatchFloat64 values are bound as BINARY_DOUBLE.
+	BatchFloat64
+	// BatchString values are bound as VARCHAR2.
+	BatchString
+	// BatchBytes values are bound as RAW.
+	BatchBytes
+	// BatchTime values are bound as TIMESTAMP WITH TIME ZONE.
+	BatchTime
+)
+
+// BatchColumn describes one bind variable (by position) of a DirectBatch.
+type BatchColumn struct {
+	Type BatchColumnType
+	// MaxSize is the maximum length in bytes of BatchString and BatchBytes values.
+	// Defaults to 4000.
+	MaxSize int
+}
+
+// DirectBatch collects rows of typed values straight into the bind buffers
+// of the statement, and executes them with one array DML (executeMany) call
+// per Limit rows.
+//
+// It is double-buffered: when Limit rows are collected, the execution
+// is started in the background, and the next rows can be set into the other buffer meanwhile.
+// Errors of a background execution are returned by the next Next, Flush or Close call,
+// and the rows collected but not executed till then are discarded.
+//
+// The connection must not be used by anything else until Close.
+//
+// The Set methods panic if the column has a different type.
+type DirectBatch struct {
+	st           *statement
+	columns      []BatchColumn
+	bufs         [2]directBuffer
+	done         chan directResult
+	tz           *time.Location
+	cur, size    int
+	limit        int
+	inFlight     bool
+	rowsAffected int64
+}
+
+type directBuffer struct {
+	vars []*C.dpiVar
+	data [][]C.dpiData
+}
+
+type directResult struct {
+	rowsAffected int64
+	err          error
+}
+
+// NewDirectBatch prepares qry on cx, and allocates two sets of bind variables
+// of limit rows, according to columns.
+//
+// If limit <= 0, DefaultBatchLimit is used.
+func NewDirectBatch(ctx context.Context, cx Conn, qry string, limit int, columns ...BatchColumn) (*DirectBatch, error) {
+	c, ok := cx.(*conn)
+	if !ok {
+		return nil, fmt.Errorf("%T is not a *conn", cx)
+	}
+	if limit <= 0 {
+		limit = DefaultBatchLimit
+	}
+	dst, err := c.PrepareContext(ctx, qry)
+	if err != nil {
+		return nil, err
+	}
+	b := DirectBatch{
+		st: dst.(*statement), columns: append([]BatchColumn(nil), columns...), limit: limit,
+		done: make(chan directResult, 1), tz: c.Timezone(),
+	}
+	for k := range b.bufs {
+		buf := &b.bufs[k]
+		buf.vars = make([]*C.dpiVar, len(columns))
+		buf.data = make([][]C.dpiData, len(columns))
+		for i, col := range b.columns {
+			vi := varInfo{SliceLen: limit}
+			switch col.Type {
+			case BatchInt64:
+				vi.Typ, vi.NatTyp = C.DPI_ORACLE_TYPE_NUMBER, C.DPI_NATIVE_TYPE_INT64
+			case BatchFloat64:
+				vi.Typ, vi.NatTyp = C.DPI_ORACLE_TYPE_NATIVE_DOUBLE, C.DPI_NATIVE_TYPE_DOUBLE
+			case BatchString, BatchBytes:
+				vi.Typ, vi.NatTyp = C.DPI_ORACLE_TYPE_VARCHAR, C.DPI_NATIVE_TYPE_BYTES
+				if col.Type == BatchBytes {
+					vi.Typ = C.DPI_ORACLE_TYPE_RAW
+				}
+				if col.MaxSize <= 0 {
+					col.MaxSize = 4000
+					b.columns[i].MaxSize = col.MaxSize
+				}
+				vi.BufSize = col.MaxSize
+			case BatchTime:
+				vi.Typ, vi.NatTyp = C.DPI_ORACLE_TYPE_TIMESTAMP_TZ, C.DPI_NATIVE_TYPE_TIMESTAMP
+			default:
+				b.Close()
+				return nil, fmt.Errorf("%d. column: unknown type %d", i, col.Type)
+			}
+			if buf.vars[i], buf.data[i], err = c.newVar(vi); err != nil {
+				b.Close()
+				return nil, fmt.Errorf("%d. column: %w", i, err)
+			}
+		}
+	}
+	return &b, nil
+}
+
+// Size returns the number of rows set but not executed yet.
+func (b *DirectBatch) Size() int { return b.size }
+
+// RowsAffected returns the accumulated number of rows affected by the finished executions.
+func (b *DirectBatch) RowsAffected() int64 { return b.rowsAffected }
+
+func (b *DirectBatch) dpiData(col int, typ BatchColumnType) *C.dpiData {
+	if b.columns[col].Type != typ {
+		panic(fmt.Errorf("%d. column is of type %d, not %d", col, b.columns[col].Type, typ))
+	}
+	return &b.bufs[b.cur].data[col][b.size]
+}
+
+// SetNull sets the col-th value of the current row to NULL.
+func (b *DirectBatch) SetNull(col int) {
+	b.bufs[b.cur].data[col][b.size].isNull = 1
+}
+
+// SetInt64 sets the col-th value of the current row.
+func (b *DirectBatch) SetInt64(col int, v int64) {
+	d := b.dpiData(col, BatchInt64)
+	*((*int64)(unsafe.Pointer(&d.value))) = v
+	d.isNull = 0
+}
+
+// SetFloat64 sets the col-th value of the current row.
+func (b *DirectBatch) SetFloat64(col int, v float64) {
+	d := b.dpiData(col, BatchFloat64)
+	*((*float64)(unsafe.Pointer(&d.value))) = v
+	d.isNull = 0
+}
+
+// SetTime sets the col-th value of the current row. The zero time is NULL.
+func (b *DirectBatch) SetTime(col int, v time.Time) {
+	d := b.dpiData(col, BatchTime)
+	if v.IsZero() {
+		d.isNull = 1
+		return
+	}
+	dataSetTime(context.Background(), d, v, b.tz)
+	d.isNull = 0
+}
+
+// SetString sets the col-th value of the current row. The empty string is NULL.
+func (b *DirectBatch) SetString(col int, v string) error {
+	return b.setBytes(col, BatchString, unsafe.Slice(unsafe.StringData(v), len(v)))
+}
+
+// SetBytes sets the col-th value of the current row. An empty slice is NULL.
+func (b *DirectBatch) SetBytes(col int, v []byte) error {
+	return b.setBytes(col, BatchBytes, v)
+}
+
+func (b *DirectBatch) setBytes(col int, typ BatchColumnType, v []byte) error {
+	d := b.dpiData(col, typ)
+	if len(v) > b.columns[col].MaxSize {
+		return fmt.Errorf("%d. column: value of length %d is longer than %d", col, len(v), b.columns[col].MaxSize)
+	}
+	// the dpiBytes of fixed size variables point to their own part of the buffer
+	db := (*C.dpiBytes)(unsafe.Pointer(&d.value))
+	copy(unsafe.Slice((*byte)(unsafe.Pointer(db.ptr)), b.columns[col].MaxSize), v)
+	db.length = C.uint32_t(len(v))
+	d.isNull = C.int(b2i(len(v) == 0))
+	return nil
+}
+
+// Next finishes the current row. When Limit rows are set,
+// their execution is started in the background.
+func (b *DirectBatch) Next(ctx context.Context) error {
+	b.size++
+	if b.size < b.limit {
+		b.clearRow()
+		return nil
+	}
+	return b.start(ctx)
+}
+
+// Flush executes the rows set, and waits for the end of all executions.
+func (b *DirectBatch) Flush(ctx context.Context) error {
+	if b.size != 0 {
+		if err := b.start(ctx); err != nil {
+			return err
+		}
+	}
+	return b.wait()
+}
+
+// Close waits for the execution in flight, and releases the statement and the variables.
+func (b *DirectBatch) Close() error {
+	if b == nil || b.st == nil {
+		return nil
+	}
+	err := b.wait()
+	if closeErr := b.st.Close(); closeErr != nil && err == nil {
+		err = closeErr
+	}
+	b.st = nil
+	for k := range b.bufs {
+		for _, v := range b.bufs[k].vars {
+			if v != nil {
+				C.dpiVar_release(v)
+			}
+		}
+		b.bufs[k] = directBuffer{}
+	}
+	return err
+}
+
+// clearRow sets all the values of the current row to NULL.
+func (b *DirectBatch) clearRow() {
+	for _, data := range b.bufs[b.cur].data {
+		data[b.size].isNull = 1
+	}
+}
+
+// wait waits for the execution in flight, if any.
+func (b *DirectBatch) wait() error {
+	if !b.inFlight {
+		return nil
+	}
+	res := <-b.done
+	b.inFlight = false
+	b.rowsAffected += res.rowsAffected
+	return res.err
+}
+
+// start starts the execution of the current buffer in the background,
+// after the previous one has finished, and switches to the other buffer.
+func (b *DirectBatch) start(ctx context.Context) error {
+	if err := b.wait(); err != nil {
+		b.size = 0
+		b.clearRow()
+		return err
+	}
+	buf, n := &b.bufs[b.cur], b.size
+	b.inFlight = true
+	go func() {
+		affected, err := b.execute(ctx, buf, n)
+		b.done <- directResult{rowsAffected: affected, err: err}
+	}()
+	b.cur, b.size = 1-b.cur, 0
+	b.clearRow()
+	return nil
+}
+
+// execute binds the variables of buf and executes the first n rows of them.
+func (b *DirectBatch) execute(ctx context.Context, buf *directBuffer, n int) (int64, error) {
+	st := b.st
+	st.Lock()
+	defer st.Unlock()
+	if st.conn == nil || st.dpiStmt == nil {
+		return 0, errors.New("statement is closed")
+	}
+	st.conn.mu.RLock()
+	defer st.conn.mu.RUnlock()
+	cleanup, err := st.handleDeadline(ctx)
+	if err != nil {
+		return 0, err
+	}
+	defer cleanup()
+
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+	for i, v := range buf.vars {
+		if err = st.checkExecNoLOT(func() C.int { return C.dpiStmt_bindByPos(st.dpiStmt, C.uint32_t(i+1), v) }); err != nil {
+			return 0, fmt.Errorf("bindByPos[%d]: %w", i, err)
+		}
+	}
+	mode := st.ExecMode()
+	if !st.inTransaction {
+		mode |= C.DPI_MODE_EXEC_COMMIT_ON_SUCCESS
+	}
+	start := time.Now()
+	err = st.checkExecNoLOT(func() C.int { return C.dpiStmt_executeMany(st.dpiStmt, mode, C.uint32_t(n)) })
+	st.conn.countExecute(start)
+	if err != nil {
+		return 0, maybeBadConn(fmt.Errorf("executeMany(%d): %w", n, err), st.conn)
+	}
+	var count C.uint64_t
+	if err = st.checkExecNoLOT(func() C.int { return C.dpiStmt_getRowCount(st.dpiStmt, &count) }); err != nil {
+		return 0, err
+	}
+	return int64(count), nil
+}
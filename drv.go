@@ -103,6 +103,12 @@ const (
 	// DefaultPrefetchCountis the number of prefetched rows by default (if not changed through PrefetchCount statement option).
 	DefaultPrefetchCount = DefaultFetchArraySize
 
+	// DefaultAdaptiveFetchMemory is the memory budget of the fetch buffers of AdaptiveFetch by default.
+	DefaultAdaptiveFetchMemory = 4 << 20
+
+	// DefaultInternStrings is the number of distinct values interned per column by InternStrings by default.
+	DefaultInternStrings = 1024
+
 	// DefaultArraySize is the length of the maximum PL/SQL array by default (if not changed through ArraySize statement option).
 	DefaultArraySize = 1 << 10
 
@@ -203,8 +209,10 @@ func init() {
 var _ driver.Driver = (*drv)(nil)
 
 type drv struct {
-	dpiContext    *C.dpiContext
-	pools         map[string]*connPool
+	dpiContext *C.dpiContext
+	// pools is the registry of pools (a map of key to *connPool),
+	// replaced by Close, so connectors can check their cached pool with one atomic load.
+	pools         atomic.Pointer[sync.Map]
 	timezones     map[string]locationWithOffSecs
 	clientVersion VersionInfo
 	mu            sync.RWMutex
@@ -217,12 +225,15 @@ func (d *drv) Close() error {
 	}
 	d.mu.Lock()
 	defer d.mu.Unlock()
-	dpiCtx, pools := d.dpiContext, d.pools
-	d.dpiContext, d.pools, d.timezones = nil, nil, nil
+	dpiCtx, pools := d.dpiContext, d.pools.Swap(nil)
+	d.dpiContext, d.timezones = nil, nil
 	done := make(chan error, 1)
 	go func() {
-		for _, pool := range pools {
-			pool.Purge()
+		if pools != nil {
+			pools.Range(func(_, pool any) bool {
+				pool.(*connPool).Purge()
+				return true
+			})
 		}
 		done <- nil
 	}()
@@ -254,6 +265,9 @@ type connPool struct {
 	key                  string
 	wrapTokenCallBackCtx unsafe.Pointer
 	params               commonAndPoolParams
+	stats                connCounters
+	// server is the version of the database, the same for all the sessions.
+	server atomic.Pointer[VersionInfo]
 }
 
 // Purge force-closes the pool's connections then closes the pool.
@@ -299,15 +313,15 @@ func (d *drv) checkExecWithWarning(f func() C.int) error {
 
 func (d *drv) init(configDir, libDir string) error {
 	d.mu.RLock()
-	ok := d.pools != nil && d.timezones != nil && d.dpiContext != nil
+	ok := d.pools.Load() != nil && d.timezones != nil && d.dpiContext != nil
 	d.mu.RUnlock()
 	if ok {
 		return nil
 	}
 	d.mu.Lock()
 	defer d.mu.Unlock()
-	if d.pools == nil {
-		d.pools = make(map[string]*connPool)
+	if d.pools.Load() == nil {
+		d.pools.Store(new(sync.Map))
 	}
 	if d.timezones == nil {
 		d.timezones = make(map[string]locationWithOffSecs)
@@ -429,21 +443,32 @@ func (d *drv) createConn(pool *connPool, P commonAndConnParams) (*conn, bool, er
 		return nil, false, err
 	}
 
+	start := time.Now()
 	dc, isNew, cleanup, err := d.acquireConn(pool, P)
 	if err != nil {
 		return nil, false, err
 	}
 	var poolKey string
+	var poolStats *connCounters
+	var poolServer *atomic.Pointer[VersionInfo]
 	if pool != nil {
-		poolKey = pool.key
+		poolKey, poolStats, poolServer = pool.key, &pool.stats, &pool.server
 	}
 	// create connection and initialize it, if needed
 	c := conn{
 		drv: d, dpiConn: dc,
-		params:   dsn.ConnectionParams{CommonParams: P.CommonParams, ConnParams: P.ConnParams},
-		poolKey:  poolKey,
-		objTypes: make(map[string]*ObjectType),
+		params:     dsn.ConnectionParams{CommonParams: P.CommonParams, ConnParams: P.ConnParams},
+		poolKey:    poolKey,
+		poolStats:  poolStats,
+		poolServer: poolServer,
+		objTypes:   make(map[string]*ObjectType),
+	}
+	if poolServer != nil {
+		if v := poolServer.Load(); v != nil {
+			c.Server = *v
+		}
 	}
+	c.countAcquire(time.Since(start))
 	logger := P.Logger
 	var cs *C.char
 	var length C.uint
@@ -542,7 +567,7 @@ func (d *drv) acquireConn(pool *connPool, P commonAndConnParams) (*C.dpiConn, bo
 		commonCreateParamsPtr = &commonCreateParams
 	}
 	// manage strings
-	var cUsername, cPassword, cNewPassword, cConnectString, cConnClass *C.char
+	var cUsername, cPassword, cNewPassword, cConnectString, cConnClass, cTag *C.char
 	defer func() {
 		if cUsername != nil {
 			C.free(unsafe.Pointer(cUsername))
@@ -559,6 +584,9 @@ func (d *drv) acquireConn(pool *connPool, P commonAndConnParams) (*C.dpiConn, bo
 		if cConnClass != nil {
 			C.free(unsafe.Pointer(cConnClass))
 		}
+		if cTag != nil {
+			C.free(unsafe.Pointer(cTag))
+		}
 	}()
 
 	// initialize ODPI-C structure for connection creation parameters
@@ -576,6 +604,13 @@ func (d *drv) acquireConn(pool *connPool, P commonAndConnParams) (*C.dpiConn, bo
 		connCreateParams.connectionClassLength = C.uint32_t(len(P.ConnClass))
 	}
 
+	// assign session tag (only relevant for pooled connections)
+	if pool != nil && P.SessionTag != "" {
+		cTag = C.CString(P.SessionTag)
+		connCreateParams.tag = cTag
+		connCreateParams.tagLength = C.uint32_t(len(P.SessionTag))
+	}
+
 	// assign new password (only relevant for standalone connections)
 	if pool == nil && !P.NewPassword.IsZero() {
 		cNewPassword = C.CString(P.NewPassword.Secret())
@@ -718,6 +753,13 @@ func (d *drv) acquireConn(pool *connPool, P commonAndConnParams) (*C.dpiConn, bo
 	}
 	//use the information from ODPI driver if new connection has been created or it is only pooled
 	isNew := connCreateParams.outNewSession == 1
+	if cTag != nil && connCreateParams.outTagFound == 0 {
+		// the session is not in the state of the tag, so it has to be initialized as a new one
+		if logger != nil {
+			logger.Debug("session tag not found", "tag", P.SessionTag, "newSession", isNew)
+		}
+		isNew = true
+	}
 	return dc, isNew, cleanup, nil
 }
 
@@ -730,14 +772,20 @@ func (d *drv) acquireConn(pool *connPool, P commonAndConnParams) (*C.dpiConn, bo
 // to acquire a connection from the pool specified by the pool parameters or
 // are used to create a standalone connection.
 func (d *drv) createConnFromParams(ctx context.Context, P dsn.ConnectionParams) (*conn, error) {
-	var err error
 	var pool *connPool
 	if !P.IsStandalone() {
+		var err error
 		pool, err = d.getPool(commonAndPoolParams{CommonParams: P.CommonParams, PoolParams: P.PoolParams})
 		if err != nil {
 			return nil, err
 		}
 	}
+	return d.createConnWithPool(ctx, pool, P)
+}
+
+// createConnWithPool creates a driver connection from pool (nil for a standalone connection),
+// and initializes it.
+func (d *drv) createConnWithPool(ctx context.Context, pool *connPool, P dsn.ConnectionParams) (*conn, error) {
 	conn, isNew, err := d.createConn(pool, commonAndConnParams{CommonParams: P.CommonParams, ConnParams: P.ConnParams})
 	if err != nil {
 		return conn, err
@@ -763,14 +811,20 @@ func (d *drv) createConnFromParams(ctx context.Context, P dsn.ConnectionParams)
 
 // getPool get the pool to use given the set of pool parameters provided.
 //
-// Pools are stored in a map keyed by a string representation of the pool parameters.
-// If no pool exists, a pool is created and stored in the map.
+// Pools are stored in a registry keyed by a string representation of the pool parameters.
+// If no pool exists, a pool is created and stored in the registry.
 func (d *drv) getPool(P commonAndPoolParams) (*connPool, error) {
 	// initialize driver, if necessary
 	if err := d.init(P.ConfigDir, P.LibDir); err != nil {
 		return nil, err
 	}
 
+	pool, _, err := d.getPoolByKey(P, poolKey(P))
+	return pool, err
+}
+
+// poolKey returns the key of the pool for the parameters in the registry of pools.
+func poolKey(P commonAndPoolParams) string {
 	var usernameKey string
 	var passwordHash [sha256.Size]byte
 	if !(P.Heterogeneous.Valid && P.Heterogeneous.Bool) &&
@@ -779,44 +833,46 @@ func (d *drv) getPool(P commonAndPoolParams) (*connPool, error) {
 		usernameKey = P.Username
 		passwordHash = sha256.Sum256([]byte(P.Password.Secret())) // See issue #245
 	}
-	// determine key to use for pool
-	poolKey := fmt.Sprintf("%s\t%x\t%s\t%d\t%d\t%d\t%s\t%s\t%s\t%t\t%t\t%t\t%s\t%d\t%s",
+	return fmt.Sprintf("%s\t%x\t%s\t%d\t%d\t%d\t%s\t%s\t%s\t%t\t%t\t%t\t%s\t%d\t%s\t%t",
 		usernameKey, passwordHash[:4], P.ConnectString, P.MinSessions, P.MaxSessions,
 		P.SessionIncrement, P.WaitTimeout, P.MaxLifeTime, P.SessionTimeout,
 		P.Heterogeneous.Bool, P.EnableEvents, P.ExternalAuth.Bool,
-		P.Timezone, P.MaxSessionsPerShard, P.PingInterval,
+		P.Timezone, P.MaxSessionsPerShard, P.PingInterval, P.SodaMetadataCache,
 	)
+}
+
+// getPoolByKey returns the pool of the registry under poolKey, creating it if needed,
+// and the registry it is in.
+//
+// The driver must be initialized.
+func (d *drv) getPoolByKey(P commonAndPoolParams, poolKey string) (*connPool, *sync.Map, error) {
 	logger := P.Logger
 	if logger != nil {
 		logger.Debug("getPool", "key", poolKey)
 	}
+	pools := d.pools.Load()
+	if pools == nil {
+		return nil, nil, driver.ErrBadConn
+	}
 
 	// if pool already exists, return it immediately; otherwise, create a new
-	// pool; hold the lock while the pool is looked up (and created, if needed)
-	// in order to ensure that multiple goroutines do not attempt to create a
-	// pool
-	d.mu.RLock()
-	pool, ok := d.pools[poolKey]
-	d.mu.RUnlock()
-	if ok {
-		return pool, nil
+	// pool, and throw it away if another goroutine has stored one meanwhile.
+	if pool, ok := pools.Load(poolKey); ok {
+		return pool.(*connPool), pools, nil
 	}
 	// createPool uses checkExec wich needs getError which uses RLock,
 	// so we cannot Lock here, thus this little race window for
 	// creating a pool and throwing it away.
 	pool, err := d.createPool(P)
 	if err != nil {
-		return nil, err
+		return nil, nil, err
 	}
-	d.mu.Lock()
-	defer d.mu.Unlock()
-	if poolOld, ok := d.pools[poolKey]; ok {
+	pool.key = poolKey
+	if poolOld, loaded := pools.LoadOrStore(poolKey, pool); loaded {
 		_ = pool.Close()
-		return poolOld, nil
+		return poolOld.(*connPool), pools, nil
 	}
-	pool.key = poolKey
-	d.pools[poolKey] = pool
-	return pool, nil
+	return pool, pools, nil
 }
 
 // createPool creates an ODPI-C pool with the specified parameters.
@@ -962,6 +1018,13 @@ func (d *drv) createPool(P commonAndPoolParams) (*connPool, error) {
 		}
 	}
 	C.dpiPool_setStmtCacheSize(dp, stmtCacheSize)
+	if P.SodaMetadataCache {
+		if C.dpiPool_setSodaMetadataCache(dp, 1) == C.DPI_FAILURE {
+			C.dpiPool_release(dp)
+			UnRegisterTokenCallback(wrapTokenCBCtx)
+			return nil, fmt.Errorf("setSodaMetadataCache: %w", d.getError())
+		}
+	}
 
 	return &connPool{dpiPool: dp, params: P, wrapTokenCallBackCtx: wrapTokenCBCtx}, nil
 }
@@ -970,6 +1033,8 @@ func (d *drv) createPool(P commonAndPoolParams) (*connPool, error) {
 type PoolStats struct {
 	Busy, Open, Max                   uint32
 	MaxLifetime, Timeout, WaitTimeout time.Duration
+	// Conn are the counters of all the connections of the pool.
+	Conn ConnStats
 }
 
 func (s PoolStats) String() string {
@@ -993,6 +1058,7 @@ func (d *drv) getPoolStats(p *connPool) (stats PoolStats, err error) {
 	}
 
 	stats.Max = uint32(p.params.PoolParams.MaxSessions)
+	stats.Conn = p.stats.snapshot()
 
 	runtime.LockOSThread()
 	defer runtime.UnlockOSThread()
@@ -1255,15 +1321,54 @@ var _ driver.Connector = (*connector)(nil)
 var _ io.Closer = (*connector)(nil)
 
 type connector struct {
-	drv *drv
+	drv  *drv
+	pool *connectorPool
 	dsn.ConnectionParams
 }
 
+// connectorPool caches the pool key of a connector, and the pool found under it.
+type connectorPool struct {
+	cached atomic.Pointer[cachedPool]
+	key    string
+}
+
+// cachedPool is the pool found in the pools registry.
+type cachedPool struct {
+	pools *sync.Map
+	pool  *connPool
+}
+
 // NewConnector returns a driver.Connector to be used with sql.OpenDB
 //
 // ConnectionParams must be complete, so start with what ParseDSN returns!
 func (d *drv) NewConnector(params dsn.ConnectionParams) driver.Connector {
-	return connector{drv: d, ConnectionParams: params}
+	c := connector{drv: d, ConnectionParams: params}
+	if !params.IsStandalone() {
+		c.pool = &connectorPool{key: poolKey(c.poolParams())}
+	}
+	return c
+}
+
+func (c connector) poolParams() commonAndPoolParams {
+	return commonAndPoolParams{CommonParams: c.CommonParams, PoolParams: c.PoolParams}
+}
+
+// getPool returns the pool of the connector: the cached one,
+// if the registry of pools has not been replaced since it was found.
+func (c connector) getPool() (*connPool, error) {
+	if cp := c.pool.cached.Load(); cp != nil && cp.pools == c.drv.pools.Load() {
+		return cp.pool, nil
+	}
+	P := c.poolParams()
+	if err := c.drv.init(P.ConfigDir, P.LibDir); err != nil {
+		return nil, err
+	}
+	pool, pools, err := c.drv.getPoolByKey(P, c.pool.key)
+	if err != nil {
+		return nil, err
+	}
+	c.pool.cached.Store(&cachedPool{pools: pools, pool: pool})
+	return pool, nil
 }
 
 // NewConnector returns a driver.Connector to be used with sql.OpenDB,
@@ -1308,6 +1413,9 @@ func (c connector) Connect(ctx context.Context) (driver.Conn, error) {
 				cc.ConnectString = params.ConnectString
 			}
 			logger = cc.Logger
+			if tag, ok := ctx.Value(sessionTagCtxKey{}).(string); ok {
+				cc.ConnParams.SessionTag = tag
+			}
 			if logger != nil {
 				logger.Debug("connect with params from context", "poolParams", params.PoolParams, "connParams", cc, "common", cc.CommonParams)
 			}
@@ -1318,18 +1426,30 @@ func (c connector) Connect(ctx context.Context) (driver.Conn, error) {
 		}
 	}
 
+	cached := c.pool != nil
+	if tag, ok := ctx.Value(sessionTagCtxKey{}).(string); ok {
+		params.ConnParams.SessionTag = tag
+	}
 	if ctxValue := ctx.Value(userPasswCtxKey{}); ctxValue != nil {
 		if up, ok := ctxValue.(UserPasswdConnClassTag); ok {
 			params.CommonParams.Username = up.Username
 			params.CommonParams.Password = up.Password
 			params.ConnParams.ConnClass = up.ConnClass
+			cached = false
 		}
 	}
 
 	if logger != nil {
 		logger.Debug("connect", "poolParams", params.PoolParams, "connParams", params.ConnParams, "common", params.CommonParams)
 	}
-	return c.drv.createConnFromParams(ctx, params)
+	if !cached {
+		return c.drv.createConnFromParams(ctx, params)
+	}
+	pool, err := c.getPool()
+	if err != nil {
+		return nil, err
+	}
+	return c.drv.createConnWithPool(ctx, pool, params)
 }
 
 // Driver returns the underlying Driver of the Connector,
@@ -1391,8 +1511,14 @@ func getOnInit(P *CommonParams) func(context.Context, driver.ConnPrepareContext)
 	return P.OnInit
 }
 
-// mkExecMany returns a function that applies the queries to the connection.
+// mkExecMany returns a function executing qrys, with one round trip:
+// more than one statement (but no query) is executed as one anonymous PL/SQL block.
 func mkExecMany(qrys []string) func(context.Context, driver.ConnPrepareContext) error {
+	if len(qrys) > 1 {
+		if block, ok := execImmediateBlock(qrys); ok {
+			qrys = []string{block}
+		}
+	}
 	return func(ctx context.Context, conn driver.ConnPrepareContext) error {
 		logger := getLogger(ctx)
 		for _, qry := range qrys {
@@ -1412,6 +1538,32 @@ func mkExecMany(qrys []string) func(context.Context, driver.ConnPrepareContext)
 	}
 }
 
+// execImmediateBlock returns the PL/SQL block executing each of qrys with EXECUTE IMMEDIATE,
+// or false if any of them is a query (what EXECUTE IMMEDIATE would not fetch),
+// or sets the EDITION (which must be a top-level statement).
+func execImmediateBlock(qrys []string) (string, bool) {
+	var buf strings.Builder
+	buf.WriteString("BEGIN\n")
+	for _, qry := range qrys {
+		qry = strings.TrimSpace(qry)
+		switch firstWord(qry) {
+		case "SELECT", "WITH", "":
+			return "", false
+		case "BEGIN", "DECLARE":
+		default:
+			if strings.Contains(strings.ToUpper(qry), "EDITION") {
+				return "", false
+			}
+			qry = trimTerminator(qry)
+		}
+		buf.WriteString("EXECUTE IMMEDIATE '")
+		buf.WriteString(strings.ReplaceAll(qry, "'", "''"))
+		buf.WriteString("';\n")
+	}
+	buf.WriteString("END;")
+	return buf.String(), true
+}
+
 func nvlD(a, b time.Duration) time.Duration {
 	if a == 0 {
 		return b
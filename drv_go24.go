@@ -22,6 +22,8 @@ package godror
 #cgo nocallback dpiConn_getObjectType
 #cgo nocallback dpiConn_getServerVersion
 #cgo nocallback dpiConn_getServiceName
+#cgo nocallback dpiConn_getSodaDb
+#cgo nocallback dpiConn_newCompactVar
 #cgo nocallback dpiConn_newMsgProps
 #cgo nocallback dpiConn_newQueue
 #cgo nocallback dpiConn_newTempLob
@@ -101,8 +103,10 @@ package godror
 #cgo nocallback dpiEnqOptions_setDeliveryMode
 #cgo nocallback dpiEnqOptions_setTransformation
 #cgo nocallback dpiEnqOptions_setVisibility
+#cgo nocallback dpiJson_getValueAtPath
 #cgo nocallback dpiJson_setFromText
 #cgo nocallback dpiJson_setValue
+#cgo nocallback dpiLob_addRef
 #cgo nocallback dpiLob_close
 #cgo nocallback dpiLob_closeResource
 #cgo nocallback dpiLob_getChunkSize
@@ -139,12 +143,16 @@ package godror
 #cgo nocallback dpiMsgProps_setPriority
 #cgo nocallback dpiObject_addRef
 #cgo nocallback dpiObject_appendElement
+#cgo nocallback dpiObject_appendElements
 #cgo nocallback dpiObjectAttr_getInfo
 #cgo nocallback dpiObjectAttr_release
 #cgo nocallback dpiObject_deleteElementByIndex
 #cgo nocallback dpiObject_getAttributeValue
+#cgo nocallback dpiObject_getAttributeValues
+#cgo nocallback dpiObject_getElementArray
 #cgo nocallback dpiObject_getElementExistsByIndex
 #cgo nocallback dpiObject_getElementValueByIndex
+#cgo nocallback dpiObject_getElementValues
 #cgo nocallback dpiObject_getFirstIndex
 #cgo nocallback dpiObject_getLastIndex
 #cgo nocallback dpiObject_getNextIndex
@@ -166,6 +174,7 @@ package godror
 #cgo nocallback dpiPool_getTimeout
 #cgo nocallback dpiPool_getWaitTimeout
 #cgo nocallback dpiPool_release
+#cgo nocallback dpiPool_setSodaMetadataCache
 #cgo nocallback dpiPool_setStmtCacheSize
 #cgo nocallback dpiQueue_deqMany
 #cgo nocallback dpiQueue_deqOne
@@ -175,6 +184,32 @@ package godror
 #cgo nocallback dpiQueue_getEnqOptions
 #cgo nocallback dpiQueue_release
 #cgo nocallback dpiRowid_getStringValue
+#cgo nocallback dpiSodaColl_drop
+#cgo nocallback dpiSodaColl_find
+#cgo nocallback dpiSodaColl_findOne
+#cgo nocallback dpiSodaColl_getDocCount
+#cgo nocallback dpiSodaColl_getMetadata
+#cgo nocallback dpiSodaColl_insertMany
+#cgo nocallback dpiSodaColl_release
+#cgo nocallback dpiSodaColl_remove
+#cgo nocallback dpiSodaColl_truncate
+#cgo nocallback dpiSodaDb_createCollection
+#cgo nocallback dpiSodaDb_createDocument
+#cgo nocallback dpiSodaDb_freeCollectionNames
+#cgo nocallback dpiSodaDb_getCollectionNames
+#cgo nocallback dpiSodaDb_openCollection
+#cgo nocallback dpiSodaDb_release
+#cgo nocallback dpiSodaDoc_getContent
+#cgo nocallback dpiSodaDoc_getCreatedOn
+#cgo nocallback dpiSodaDoc_getIsJson
+#cgo nocallback dpiSodaDoc_getJsonContent
+#cgo nocallback dpiSodaDoc_getKey
+#cgo nocallback dpiSodaDoc_getLastModified
+#cgo nocallback dpiSodaDoc_getMediaType
+#cgo nocallback dpiSodaDoc_getVersion
+#cgo nocallback dpiSodaDoc_release
+#cgo nocallback dpiSodaDocCursor_getNext
+#cgo nocallback dpiSodaDocCursor_release
 #cgo nocallback dpiStmt_addRef
 #cgo nocallback dpiStmt_bindByName
 #cgo nocallback dpiStmt_bindByPos
@@ -196,14 +231,22 @@ package godror
 #cgo nocallback dpiStmt_release
 #cgo nocallback dpiStmt_setFetchArraySize
 #cgo nocallback dpiStmt_setPrefetchRows
+#cgo nocallback dpiVar_getArrays
 #cgo nocallback dpiVar_getNumElementsInArray
 #cgo nocallback dpiVar_getReturnedData
+#cgo nocallback dpiVar_getVectorValues
 #cgo nocallback dpiVar_release
 #cgo nocallback dpiVar_setFromBytes
 #cgo nocallback dpiVar_setFromJson
 #cgo nocallback dpiVar_setFromLob
 #cgo nocallback dpiVar_setFromObject
 #cgo nocallback dpiVar_setNumElementsInArray
+#cgo nocallback dpiVar_setVectorValues
+#cgo nocallback godrorStmtExecute
+#cgo nocallback godrorStmtExecuteMany
+#cgo nocallback godrorStmtFetchRows
+#cgo nocallback godrorVarSetFromBytes
+#cgo nocallback godrorVectorDistancesFloat32
 #cgo nocallback godror_allocate_dpiNode
 #cgo nocallback godror_dpiasJsonArray
 #cgo nocallback godror_dpiasJsonObject
@@ -6,6 +6,7 @@
 package godror
 
 import (
+	"database/sql"
 	"encoding/json"
 	"errors"
 	"testing"
@@ -100,3 +101,135 @@ func TestMarshalJSON(t *testing.T) {
 	}
 	t.Log(string(b))
 }
+
+func TestExecImmediateBlock(t *testing.T) {
+	for nm, tC := range map[string]struct {
+		want  string
+		qrys  []string
+		folds bool
+	}{
+		"alter": {
+			qrys:  []string{"ALTER SESSION SET NLS_DATE_FORMAT='YYYY-MM-DD';", "BEGIN DBMS_APPLICATION_INFO.set_module('x', NULL); END;"},
+			want:  "BEGIN\nEXECUTE IMMEDIATE 'ALTER SESSION SET NLS_DATE_FORMAT=''YYYY-MM-DD''';\nEXECUTE IMMEDIATE 'BEGIN DBMS_APPLICATION_INFO.set_module(''x'', NULL); END;';\nEND;",
+			folds: true,
+		},
+		"select":         {qrys: []string{"ALTER SESSION SET TIME_ZONE='UTC'", "SELECT 1 FROM DUAL"}},
+		"select-newline": {qrys: []string{"ALTER SESSION SET TIME_ZONE='UTC'", "SELECT\n1 FROM DUAL"}},
+		"with-tab":       {qrys: []string{"ALTER SESSION SET TIME_ZONE='UTC'", "WITH\tx AS (SELECT 1 a FROM DUAL) SELECT a FROM x"}},
+		"edition":        {qrys: []string{"ALTER SESSION SET TIME_ZONE='UTC'", "ALTER SESSION SET EDITION=e1"}},
+		"procedure": {
+			qrys:  []string{"CREATE OR REPLACE PROCEDURE p IS\nBEGIN\n  NULL;\nEND;\n", "GRANT EXECUTE ON p TO PUBLIC;"},
+			want:  "BEGIN\nEXECUTE IMMEDIATE 'CREATE OR REPLACE PROCEDURE p IS\nBEGIN\n  NULL;\nEND;';\nEXECUTE IMMEDIATE 'GRANT EXECUTE ON p TO PUBLIC';\nEND;",
+			folds: true,
+		},
+	} {
+		got, ok := execImmediateBlock(tC.qrys)
+		if ok != tC.folds {
+			t.Errorf("%s: got %t, wanted %t", nm, ok, tC.folds)
+		} else if got != tC.want {
+			t.Errorf("%s: got %q, wanted %q", nm, got, tC.want)
+		}
+	}
+}
+
+func TestPoolKey(t *testing.T) {
+	var P commonAndPoolParams
+	P.Username, P.ConnectString = "user", "db"
+	key := poolKey(P)
+	P.SodaMetadataCache = true
+	if poolKey(P) == key {
+		t.Error("pools with and without sodaMetadataCache have the same key")
+	}
+}
+
+func TestTrimTerminator(t *testing.T) {
+	for qry, want := range map[string]string{
+		"ALTER SESSION SET TIME_ZONE='UTC'; ":                        "ALTER SESSION SET TIME_ZONE='UTC'",
+		"CREATE TABLE t (id NUMBER);":                                "CREATE TABLE t (id NUMBER)",
+		"CREATE PROCEDURE p IS BEGIN NULL; END;\n":                   "CREATE PROCEDURE p IS BEGIN NULL; END;",
+		"create or replace package body k AS END;":                   "create or replace package body k AS END;",
+		"CREATE OR REPLACE EDITIONABLE TRIGGER t BEFORE INSERT ON x": "CREATE OR REPLACE EDITIONABLE TRIGGER t BEFORE INSERT ON x",
+		"CREATE OR REPLACE VIEW v AS SELECT 1 a FROM DUAL;":          "CREATE OR REPLACE VIEW v AS SELECT 1 a FROM DUAL",
+	} {
+		if got := trimTerminator(qry); got != want {
+			t.Errorf("%q: got %q, wanted %q", qry, got, want)
+		}
+	}
+}
+
+func TestAdaptiveFetchPlan(t *testing.T) {
+	for nm, tC := range map[string]struct {
+		stat   fetchStat
+		budget int
+		want   int
+	}{
+		"lookup": {stat: fetchStat{rows: 1, width: 100}, budget: DefaultAdaptiveFetchMemory, want: 2},
+		"empty":  {stat: fetchStat{rows: 0, width: 100}, budget: DefaultAdaptiveFetchMemory, want: 2},
+		"small":  {stat: fetchStat{rows: 300, width: 100}, budget: DefaultAdaptiveFetchMemory, want: 301},
+		"budget": {stat: fetchStat{rows: 1 << 20, width: 1 << 10}, budget: 1 << 20, want: 15 << 6},
+		"max":    {stat: fetchStat{rows: 1 << 20, width: 8}, budget: 1 << 30, want: maxAdaptiveFetchArraySize},
+		"wide":   {stat: fetchStat{rows: 10, width: 1 << 20}, budget: 1 << 10, want: 2},
+	} {
+		if got := tC.stat.plan(tC.budget); got.arraySize != tC.want || got.prefetchCount != tC.want {
+			t.Errorf("%s: got %+v, wanted %d", nm, got, tC.want)
+		}
+	}
+
+	var fs fetchStats
+	fs.record("q", 1000, 8)
+	fs.record("q", 0, 8)
+	if s, _ := fs.get("q"); s.rows != 750 {
+		t.Errorf("got %d rows after decay, wanted 750", s.rows)
+	}
+	fs.record("q", 2000, 8)
+	if s, _ := fs.get("q"); s.rows != 2000 {
+		t.Errorf("got %d rows, wanted 2000", s.rows)
+	}
+}
+
+func TestResultCacheKey(t *testing.T) {
+	const qry = "SELECT * FROM t WHERE id = :1"
+	key := func(args ...interface{}) string {
+		t.Helper()
+		k, err := resultCacheKey(qry, args)
+		if err != nil {
+			t.Fatal(err)
+		}
+		return k
+	}
+	a, b := 1, 1
+	if key(&a) != key(&b) {
+		t.Error("pointers to equal values have different keys")
+	}
+	if key(&a) != key(1) {
+		t.Error("the pointer and its value have different keys")
+	}
+	if b = 2; key(&a) == key(&b) {
+		t.Error("pointers to different values have the same key")
+	}
+	var np *int
+	if key(np) != key(nil) {
+		t.Error("nil pointer and nil have different keys")
+	}
+	n := Number("3")
+	if key(&n) != key("3") {
+		t.Error("the Valuer and its value have different keys")
+	}
+	if key(sql.Named("id", &a)) != key(sql.Named("id", 1)) {
+		t.Error("the named pointer and its value have different keys")
+	}
+	if key([]string{"a b"}) == key([]string{"a", "b"}) {
+		t.Error("slices with differently split elements have the same key")
+	}
+	if key("a\x00string\x00b") == key("a", "b") {
+		t.Error("a string imitating the separator of two args has the same key as the two args")
+	}
+	if key(sql.Named("a\x00string\x00", 1)) == key(sql.Named("a", "")) {
+		t.Error("a name imitating the separator has the same key")
+	}
+	for _, arg := range []interface{}{sql.Out{Dest: &a}, []*int{&a}, map[string]int{"a": 1}} {
+		if _, err := resultCacheKey(qry, []interface{}{arg}); err == nil {
+			t.Errorf("%T: wanted error", arg)
+		}
+	}
+}
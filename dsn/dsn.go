@@ -158,6 +158,9 @@ type ConnParams struct {
 	ShardingKey, SuperShardingKey []interface{}
 	AdminRole                     AdminRole
 	IsPrelim                      bool
+	// SessionTag is the tag of the session to acquire from the pool
+	// (set by godror.ContextWithSessionTag).
+	SessionTag string
 }
 
 // String returns the string representation of the ConnParams.
@@ -201,6 +204,8 @@ type PoolParams struct {
 	WaitTimeout, MaxLifeTime, SessionTimeout   time.Duration
 	PingInterval                               time.Duration
 	Heterogeneous, ExternalAuth                sql.NullBool
+	// SodaMetadataCache enables the caching of the SODA collection metadata in the pool.
+	SodaMetadataCache bool
 }
 
 // String returns the string representation of PoolParams.
@@ -233,6 +238,9 @@ func (P PoolParams) String() string {
 	if P.PingInterval != 0 {
 		q.Add("pingInterval", P.PingInterval.String())
 	}
+	if P.SodaMetadataCache {
+		q.Add("sodaMetadataCache", "1")
+	}
 	return q.String()
 }
 
@@ -387,6 +395,9 @@ func (P ConnectionParams) string(class, withPassword bool) string {
 	if P.PingInterval != 0 {
 		q.Add("pingInterval", P.PingInterval.String())
 	}
+	if P.SodaMetadataCache {
+		q.Add("sodaMetadataCache", "1")
+	}
 	as := acquireParamsArray(1)
 	defer releaseParamsArray(as)
 	for _, kv := range P.AlterSession {
@@ -547,6 +558,7 @@ func Parse(dataSourceName string) (ConnectionParams, error) {
 		{&P.PerSessionTimezone, "perSessionTimezone"},
 		{&P.InitOnNewConn, "initOnNewConnection"},
 		{&P.NoBreakOnContextCancel, "noBreakOnContextCancel"},
+		{&P.SodaMetadataCache, "sodaMetadataCache"},
 	}
 	if ar := q.Get("adminRole"); len(ar) > 3 && strings.EqualFold(ar[:3], "SYS") {
 		P.AdminRole = AdminRole(strings.ToUpper(ar))
@@ -66,6 +66,9 @@ func TestParse(t *testing.T) {
 		wantDefault.ConnClass = ""
 	}
 
+	wantSoda := wantDefault
+	wantSoda.SodaMetadataCache = true
+
 	wantXO := wantDefault
 	wantXO.ConnectString = "localhost/sid"
 
@@ -196,6 +199,7 @@ func TestParse(t *testing.T) {
 		"logfmt_multiline": {In: "user=user\npassword=pass\nconnectString=localhost/sid\nheterogeneousPool=1", Want: wantHeterogeneous},
 		"logfmt_simple":    {In: `user="user" password="pass" connectString="sid"`, Want: wantDefault},
 		"logfmt_userpass":  {In: `user="user" password="pass" connectString=""`, Want: wantEmptyConnectString},
+		"logfmt_soda":      {In: `user="user" password="pass" connectString="sid" sodaMetadataCache=1`, Want: wantSoda},
 
 		"logfmt_libDir": {In: `user="user" password="pass" 
 			connectString="localhost/orclpdb1"
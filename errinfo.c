@@ -0,0 +1,58 @@
+#include <stdlib.h>
+#include <string.h>
+#include "dpiImpl.h"
+#include "errinfo.h"
+
+// godrorGetErrorInfo copies the error of the last call of this thread
+// into info. The message is copied, as the error buffer of the thread
+// is overwritten by the next call on this thread, which may come from another
+// goroutine before the caller reads it. info->message is NULL if the copy
+// cannot be allocated.
+//
+// This is dpiContext_getError without the check of the context handle.
+static int godrorGetErrorInfo(dpiErrorInfo *info) {
+	dpiError error;
+	char *message;
+
+	dpiGlobal__initError(NULL, &error);
+	dpiError__getInfo(&error, info);
+	message = malloc(info->messageLength + 1);
+	if (message) {
+		memcpy(message, info->message, info->messageLength);
+		message[info->messageLength] = '\0';
+	} else
+		info->messageLength = 0;
+	info->message = message;
+	info->encoding = NULL;
+	return DPI_FAILURE;
+}
+
+int godrorStmtExecute(dpiStmt *stmt, dpiExecMode mode,
+		uint32_t *numQueryColumns, dpiErrorInfo *info) {
+	if (dpiStmt_execute(stmt, mode, numQueryColumns) == DPI_SUCCESS)
+		return DPI_SUCCESS;
+	return godrorGetErrorInfo(info);
+}
+
+int godrorStmtExecuteMany(dpiStmt *stmt, dpiExecMode mode,
+		uint32_t numIters, dpiErrorInfo *info) {
+	if (dpiStmt_executeMany(stmt, mode, numIters) == DPI_SUCCESS)
+		return DPI_SUCCESS;
+	return godrorGetErrorInfo(info);
+}
+
+int godrorStmtFetchRows(dpiStmt *stmt, uint32_t maxRows,
+		uint32_t *bufferRowIndex, uint32_t *numRowsFetched, int *moreRows,
+		dpiErrorInfo *info) {
+	if (dpiStmt_fetchRows(stmt, maxRows, bufferRowIndex, numRowsFetched,
+			moreRows) == DPI_SUCCESS)
+		return DPI_SUCCESS;
+	return godrorGetErrorInfo(info);
+}
+
+int godrorVarSetFromBytes(dpiVar *var, uint32_t pos, const char *value,
+		uint32_t valueLength, dpiErrorInfo *info) {
+	if (dpiVar_setFromBytes(var, pos, value, valueLength) == DPI_SUCCESS)
+		return DPI_SUCCESS;
+	return godrorGetErrorInfo(info);
+}
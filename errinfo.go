@@ -0,0 +1,51 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include <stdlib.h>
+#include "dpiImpl.h"
+#include "errinfo.h"
+*/
+import "C"
+import "unsafe"
+
+// inlineError converts the error info returned by the godror* wrappers (errinfo.h),
+// and frees its message.
+func inlineError(errInfo *C.dpiErrorInfo) error {
+	if errInfo.message != nil {
+		defer C.free(unsafe.Pointer(errInfo.message))
+	}
+	if err := fromErrorInfo(*errInfo); err != nil {
+		return err
+	}
+	return &OraErr{code: int(errInfo.code), message: "unknown error (out of memory copying the message)"}
+}
+
+// executeInline executes the statement (with executeMany of st.arrLen iterations if many),
+// getting the error inline, so it needs no locked OS thread.
+func (st *statement) executeInline(mode C.dpiExecMode, many bool, colCount *C.uint32_t) error {
+	var errInfo C.dpiErrorInfo
+	var rc C.int
+	if many {
+		rc = C.godrorStmtExecuteMany(st.dpiStmt, mode, C.uint32_t(st.arrLen), &errInfo)
+	} else {
+		rc = C.godrorStmtExecute(st.dpiStmt, mode, colCount, &errInfo)
+	}
+	if rc != C.DPI_FAILURE {
+		return nil
+	}
+	return inlineError(&errInfo)
+}
+
+// setFromBytes is dpiVar_setFromBytes with the error got inline, so it needs no locked OS thread.
+func setFromBytes(dv *C.dpiVar, pos int, p *C.char, length int) error {
+	var errInfo C.dpiErrorInfo
+	if C.godrorVarSetFromBytes(dv, C.uint32_t(pos), p, C.uint32_t(length), &errInfo) != C.DPI_FAILURE {
+		return nil
+	}
+	return inlineError(&errInfo)
+}
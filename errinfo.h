@@ -0,0 +1,18 @@
+#ifndef GODROR_ERRINFO
+#define GODROR_ERRINFO
+
+// The godror* wrappers call the ODPI-C function, and on failure copy its
+// error into info in the same (C) call, so the caller needs no locked OS
+// thread to read the thread local error. The message of info is copied
+// into a malloc'ed buffer, which must be freed by the caller.
+int godrorStmtExecute(dpiStmt *stmt, dpiExecMode mode,
+		uint32_t *numQueryColumns, dpiErrorInfo *info);
+int godrorStmtExecuteMany(dpiStmt *stmt, dpiExecMode mode,
+		uint32_t numIters, dpiErrorInfo *info);
+int godrorStmtFetchRows(dpiStmt *stmt, uint32_t maxRows,
+		uint32_t *bufferRowIndex, uint32_t *numRowsFetched, int *moreRows,
+		dpiErrorInfo *info);
+int godrorVarSetFromBytes(dpiVar *var, uint32_t pos, const char *value,
+		uint32_t valueLength, dpiErrorInfo *info);
+
+#endif
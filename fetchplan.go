@@ -0,0 +1,169 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"sync"
+	"unsafe"
+)
+
+const (
+	// maxAdaptiveFetchArraySize is the largest FetchArraySize AdaptiveFetch chooses.
+	maxAdaptiveFetchArraySize = 1 << 16
+	// maxAdaptiveFetchStats is the number of SQL texts whose fetches are recorded.
+	maxAdaptiveFetchStats = 4096
+)
+
+// fetchPlan is the FetchArraySize and PrefetchCount chosen by AdaptiveFetch for one execution.
+type fetchPlan struct {
+	arraySize, prefetchCount int
+}
+
+// fetchStat is the recorded fetches of a query.
+type fetchStat struct {
+	rows  uint64 // rows read, the maximum decaying towards the later executions
+	width int    // bytes of the fetch buffers of one row
+}
+
+// plan returns the FetchArraySize and PrefetchCount for reading all the rows
+// in the execute round trip, if they fit into budget.
+//
+// A sixteenth of the budget is left for the other allocations of the execution
+// (statement, column descriptions).
+func (s fetchStat) plan(budget int) fetchPlan {
+	budget -= budget / 16
+	n := 2
+	if s.rows >= maxAdaptiveFetchArraySize {
+		n = maxAdaptiveFetchArraySize
+	} else if s.rows >= 2 {
+		n = int(s.rows) + 1
+	}
+	if s.width > 0 && budget/s.width < n {
+		if n = budget / s.width; n < 2 {
+			n = 2
+		}
+	}
+	return fetchPlan{arraySize: n, prefetchCount: n}
+}
+
+type fetchStats struct {
+	m map[string]fetchStat
+	sync.Mutex
+}
+
+// adaptiveFetchStats holds the fetch statistics of the queries executed with AdaptiveFetch.
+var adaptiveFetchStats fetchStats
+
+func (fs *fetchStats) get(qry string) (fetchStat, bool) {
+	fs.Lock()
+	s, ok := fs.m[qry]
+	fs.Unlock()
+	return s, ok
+}
+
+// record the rows read by an execution of qry.
+// A smaller execution lowers the recorded rows by only a quarter of the difference,
+// to not shrink the arrays after each short read.
+func (fs *fetchStats) record(qry string, rows uint64, width int) {
+	fs.Lock()
+	defer fs.Unlock()
+	old, ok := fs.m[qry]
+	if ok && old.rows > rows {
+		rows = old.rows - (old.rows-rows)/4
+	}
+	if fs.m == nil {
+		fs.m = make(map[string]fetchStat)
+	} else if !ok && len(fs.m) >= maxAdaptiveFetchStats {
+		for k := range fs.m {
+			delete(fs.m, k)
+			break
+		}
+	}
+	fs.m[qry] = fetchStat{rows: rows, width: width}
+}
+
+// rowWidth returns the size of the ODPI-C fetch buffers of one row of the vars.
+func rowWidth(vars []*C.dpiVar) int {
+	var n int
+	for _, v := range vars {
+		if v != nil {
+			n += varRowWidth(v)
+		}
+	}
+	return n
+}
+
+// varRowWidth returns the size of the buffers of one row of v, as allocated by dpiVar__initBuffer:
+// the value (or its dynamic bytes), and the per-cell arrays of the indicators, lengths, return codes,
+// NUMBER-as-text conversions, dpiData and references.
+func varRowWidth(v *C.dpiVar) int {
+	b := &v.buffer
+	n := int(unsafe.Sizeof(C.int16_t(0)))
+	if v.isDynamic != 0 {
+		n += int(unsafe.Sizeof(C.dpiDynamicBytes{}))
+	} else {
+		n += int(v.sizeInBytes)
+	}
+	if b.actualLength32 != nil {
+		n += int(unsafe.Sizeof(C.uint32_t(0)))
+	} else if b.actualLength16 != nil {
+		n += int(unsafe.Sizeof(C.uint16_t(0)))
+	}
+	if b.returnCode != nil {
+		n += int(unsafe.Sizeof(C.uint16_t(0)))
+	}
+	if b.tempBuffer != nil {
+		if v.env.charsetId == C.DPI_CHARSET_ID_UTF16 {
+			n += 2 * C.DPI_NUMBER_AS_TEXT_CHARS
+		} else {
+			n += C.DPI_NUMBER_AS_TEXT_CHARS
+		}
+	}
+	if b.externalData != nil {
+		n += int(unsafe.Sizeof(C.dpiData{}))
+	}
+	if b.references != nil {
+		n += int(unsafe.Sizeof(C.dpiReferenceBuffer{}))
+	}
+	if b.objectIndicator != nil {
+		n += int(unsafe.Sizeof(unsafe.Pointer(nil)))
+	}
+	return n
+}
+
+// planFetch returns the fetchPlan of AdaptiveFetch for the next execution of st,
+// which is zero if AdaptiveFetch is not used, FetchArraySize or PrefetchCount is set,
+// or the query has not been executed yet.
+func (st *statement) planFetch() fetchPlan {
+	if st.adaptiveFetch == 0 || st.fetchArraySize != 0 || st.prefetchCount != 0 {
+		return fetchPlan{}
+	}
+	s, ok := adaptiveFetchStats.get(st.query)
+	if !ok {
+		return fetchPlan{}
+	}
+	return s.plan(st.adaptiveFetch)
+}
+
+// FetchArraySize returns the FetchArraySize of the current execution.
+func (st *statement) FetchArraySize() int {
+	if n := st.fetchPlan.arraySize; n > 0 {
+		return n
+	}
+	return st.stmtOptions.FetchArraySize()
+}
+
+// PrefetchCount returns the PrefetchCount of the current execution.
+func (st *statement) PrefetchCount() int {
+	if n := st.fetchPlan.prefetchCount; n > 0 {
+		return n
+	}
+	return st.stmtOptions.PrefetchCount()
+}
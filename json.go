@@ -228,6 +228,9 @@ import (
 	"errors"
 	"fmt"
 	"reflect"
+	"runtime"
+	"strconv"
+	"strings"
 	"time"
 	"unsafe"
 )
@@ -242,6 +245,7 @@ type JSONOption uint8
 
 var ErrInvalidJSON = errors.New("invalid JSON Document")
 var ErrInvalidType = errors.New("invalid JSON Scalar Type")
+var ErrJSONPathNotFound = errors.New("JSON path not found")
 
 const (
 	JSONOptDefault        = JSONOption(C.DPI_JSON_OPT_DEFAULT)
@@ -303,6 +307,102 @@ func (j JSON) GetJSONScalar(opts JSONOption) (JSONScalar, error) {
 	return JSONScalar{dpiJsonNode: node}, nil
 }
 
+// GetPath retrieves the JSONScalar at path (such as $.a.b[3] or $."first name".x)
+// based on option, opts, decoding only that part of the JSON document.
+//
+// It returns ErrJSONPathNotFound if there is no value at path.
+// The returned value is valid until the JSON is released,
+// or its whole value is retrieved (by Get, GetValue or the other GetJSON methods).
+func (j JSON) GetPath(path string, opts JSONOption) (JSONScalar, error) {
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	steps, err := parseJSONPath(path, &pinner)
+	if err != nil {
+		return JSONScalar{}, err
+	}
+	var stepsPtr *C.dpiJsonPathStep
+	if len(steps) != 0 {
+		stepsPtr = &steps[0]
+	}
+	var node *C.dpiJsonNode
+	if C.dpiJson_getValueAtPath(j.dpiJson, C.uint32_t(opts), C.uint32_t(len(steps)), stepsPtr, &node) == C.DPI_FAILURE {
+		return JSONScalar{}, ErrInvalidJSON
+	}
+	if node == nil {
+		return JSONScalar{}, fmt.Errorf("%q: %w", path, ErrJSONPathNotFound)
+	}
+	return JSONScalar{dpiJsonNode: node}, nil
+}
+
+// parseJSONPath splits path into the steps of .name, ."quoted name" and [index].
+//
+// The names point into path (or to their unquoted copy), pinned by pinner.
+func parseJSONPath(path string, pinner *runtime.Pinner) ([]C.dpiJsonPathStep, error) {
+	p := strings.TrimPrefix(strings.TrimSpace(path), "$")
+	if p == "" {
+		return nil, nil
+	}
+	pinner.Pin(unsafe.StringData(p))
+	nameStep := func(name string) C.dpiJsonPathStep {
+		ptr := unsafe.StringData(name)
+		if ptr == nil { // the name of the step must not be NULL
+			ptr = unsafe.StringData(p)
+		}
+		return C.dpiJsonPathStep{name: (*C.char)(unsafe.Pointer(ptr)), nameLength: C.uint32_t(len(name))}
+	}
+	steps := make([]C.dpiJsonPathStep, 0, strings.Count(p, ".")+strings.Count(p, "["))
+	for p != "" {
+		switch p[0] {
+		case '.':
+			p = p[1:]
+			if p == "" || p[0] != '"' {
+				i := strings.IndexAny(p, ".[")
+				if i < 0 {
+					i = len(p)
+				}
+				if i == 0 {
+					return nil, fmt.Errorf("%q: empty name", path)
+				}
+				steps, p = append(steps, nameStep(p[:i])), p[i:]
+				continue
+			}
+			i := 1
+			for ; i < len(p) && p[i] != '"'; i++ {
+				if p[i] == '\\' {
+					i++
+				}
+			}
+			if i >= len(p) {
+				return nil, fmt.Errorf("%q: unterminated quoted name", path)
+			}
+			name := p[1:i]
+			if strings.IndexByte(name, '\\') >= 0 {
+				var err error
+				if name, err = strconv.Unquote(p[:i+1]); err != nil {
+					return nil, fmt.Errorf("%q: %w", path, err)
+				}
+				if name != "" {
+					pinner.Pin(unsafe.StringData(name))
+				}
+			}
+			steps, p = append(steps, nameStep(name)), p[i+1:]
+		case '[':
+			i := strings.IndexByte(p, ']')
+			if i < 0 {
+				return nil, fmt.Errorf("%q: unterminated array index", path)
+			}
+			n, err := strconv.ParseUint(strings.TrimSpace(p[1:i]), 10, 32)
+			if err != nil {
+				return nil, fmt.Errorf("%q: array index: %w", path, err)
+			}
+			steps, p = append(steps, C.dpiJsonPathStep{index: C.uint32_t(n)}), p[i+1:]
+		default:
+			return nil, fmt.Errorf("%q: unexpected %q", path, p[:1])
+		}
+	}
+	return steps, nil
+}
+
 // GetValue converts the native DB type stored in JSON into an interface value.
 // The scalar values stored in JSON get converted as below.
 //
@@ -12,15 +12,20 @@ import "C"
 import (
 	"bufio"
 	"context"
+	"database/sql"
+	"database/sql/driver"
 	"errors"
 	"fmt"
 	"io"
 	"runtime"
 	"strings"
 	"sync"
+	"sync/atomic"
 	"unicode/utf16"
 	"unicode/utf8"
 	"unsafe"
+
+	"golang.org/x/sync/errgroup"
 )
 
 // Lob is for reading/writing a LOB.
@@ -118,14 +123,32 @@ type dpiLobReader struct {
 	chunkSize           C.uint32_t
 	bufR, bufW          int
 	finished            bool
+	typeChecked, isFile bool
 	IsClob              bool
+	hasRef              bool // holds a reference to dpiLob, taken by rows.Next
+	fetched             bool // dpiLob is of the fetch buffer, so it is not closed, to be reused by the next fetch
 }
 
 // WriteTo writes data to w until there's no more data to write or when an error occurs.
 // The return value n is the number of bytes written. Any error encountered during the write is also returned.
 //
 // Uses efficient, multiple-of-LOB-chunk-size buffered reads.
+// BLOBs and BFILEs are read ahead: the next part is read into C memory
+// while the previous one is written to w (straight from that memory, without copying),
+// and BFILEs are kept open meanwhile.
 func (dlr *dpiLobReader) WriteTo(w io.Writer) (n int64, err error) {
+	dlr.mu.Lock()
+	ahead, err := dlr.canReadAhead()
+	if err == nil && ahead {
+		n, err = dlr.readAhead(w)
+		dlr.mu.Unlock()
+		return n, err
+	}
+	dlr.mu.Unlock()
+	if err != nil {
+		return 0, err
+	}
+
 	size := dlr.ChunkSize()
 	const minBufferSize = 1 << 20
 	if size <= 0 {
@@ -148,6 +171,9 @@ func (dlr *dpiLobReader) WriteTo(w io.Writer) (n int64, err error) {
 func (dlr *dpiLobReader) ChunkSize() int {
 	dlr.mu.Lock()
 	defer dlr.mu.Unlock()
+	return dlr.getChunkSize()
+}
+func (dlr *dpiLobReader) getChunkSize() int {
 	if dlr.chunkSize != 0 {
 		return int(dlr.chunkSize)
 	}
@@ -160,6 +186,148 @@ func (dlr *dpiLobReader) ChunkSize() int {
 	return int(dlr.chunkSize)
 }
 
+// canReadAhead reports whether the LOB can be read by readAhead: it is not a CLOB
+// (whose offsets count characters), and it has not been finished yet.
+func (dlr *dpiLobReader) canReadAhead() (bool, error) {
+	if dlr.finished || dlr.dpiLob == nil {
+		return false, nil
+	}
+	if !dlr.typeChecked {
+		var lobType C.dpiOracleTypeNum
+		if err := dlr.checkExec(func() C.int {
+			return C.dpiLob_getType(dlr.dpiLob, &lobType)
+		}); err != nil {
+			return false, err
+		}
+		dlr.typeChecked = true
+		dlr.IsClob = lobType == C.DPI_ORACLE_TYPE_CLOB || lobType == C.DPI_ORACLE_TYPE_NCLOB
+		dlr.isFile = lobType == C.DPI_ORACLE_TYPE_BFILE
+	}
+	if dlr.IsClob {
+		return false, nil
+	}
+	if err := dlr.getSize(); err != nil {
+		var coder interface{ Code() int }
+		if errors.As(err, &coder) && coder.Code() == 22922 || strings.Contains(err.Error(), "invalid dpiLob handle") {
+			return false, nil
+		}
+		return false, err
+	}
+	return dlr.getChunkSize() > 0, nil
+}
+
+// lobPart is a part of the LOB read by readAhead into the idx-th buffer.
+type lobPart struct {
+	err error
+	idx int
+	n   int
+}
+
+// readAhead writes the rest of the (binary) LOB to w, with double buffering:
+// a goroutine reads the next chunk-size aligned part into one C buffer,
+// while the previous part is written to w from the other.
+func (dlr *dpiLobReader) readAhead(w io.Writer) (int64, error) {
+	var n int64
+	// what Read has already buffered
+	if dlr.bufR < dlr.bufW {
+		k, err := w.Write(dlr.buf[dlr.bufR:dlr.bufW])
+		n += int64(k)
+		if dlr.bufR += k; err != nil {
+			return n, err
+		}
+	}
+	dlr.bufR, dlr.bufW = 0, 0
+	if dlr.offset+1 >= dlr.sizePlusOne {
+		return n, nil
+	}
+
+	const readAheadSize = 1 << 20
+	cs := int(dlr.chunkSize)
+	size := maxI(1, readAheadSize/cs) * cs
+	defer func() {
+		if dlr.finished {
+			dlr.closeAtEnd()
+		}
+	}()
+	if dlr.isFile {
+		if err := dlr.checkExec(func() C.int { return C.dpiLob_openResource(dlr.dpiLob) }); err != nil {
+			return n, fmt.Errorf("openResource: %w", err)
+		}
+		defer func() { _ = dlr.checkExec(func() C.int { return C.dpiLob_closeResource(dlr.dpiLob) }) }()
+	}
+	var bufs [2]unsafe.Pointer
+	for i := range bufs {
+		bufs[i] = C.malloc(C.size_t(size))
+		defer C.free(bufs[i])
+	}
+
+	free := make(chan int, len(bufs))
+	for i := range bufs {
+		free <- i
+	}
+	filled := make(chan lobPart)
+	stop := make(chan struct{})
+	var wg sync.WaitGroup
+	wg.Add(1)
+	go func(offset, sizePlusOne C.uint64_t) {
+		defer wg.Done()
+		runtime.LockOSThread()
+		defer runtime.UnlockOSThread()
+		for {
+			var idx int
+			select {
+			case <-stop:
+				return
+			case idx = <-free:
+			}
+			amount := C.uint64_t(size)
+			if rest := sizePlusOne - 1 - offset; rest < amount {
+				amount = rest
+			}
+			k := amount
+			part := lobPart{idx: idx}
+			if part.err = dlr.drv.checkExecNoLOT(func() C.int {
+				return C.dpiLob_readBytes(dlr.dpiLob, offset+1, amount, (*C.char)(bufs[idx]), &k)
+			}); part.err != nil {
+				part.err = fmt.Errorf("dpiLob_readbytes(lob=%p offset=%d amount=%d): %w", dlr.dpiLob, offset, amount, part.err)
+			}
+			part.n = int(k)
+			offset += k
+			if part.err == nil && (k == 0 || offset+1 >= sizePlusOne) {
+				part.err = io.EOF
+			}
+			select {
+			case <-stop:
+				return
+			case filled <- part:
+			}
+			if part.err != nil {
+				return
+			}
+		}
+	}(dlr.offset, dlr.sizePlusOne)
+	defer func() { close(stop); wg.Wait() }()
+
+	for {
+		part := <-filled
+		if part.n != 0 {
+			k, err := w.Write(unsafe.Slice((*byte)(bufs[part.idx]), part.n))
+			n += int64(k)
+			dlr.offset += C.uint64_t(k)
+			if err != nil {
+				return n, err
+			}
+		}
+		if part.err == io.EOF {
+			dlr.finished = true
+			return n, nil
+		} else if part.err != nil {
+			return n, part.err
+		}
+		free <- part.idx
+	}
+}
+
 // Read from LOB. It does buffer the reading internally against short buffers (io.ReadAll).
 func (dlr *dpiLobReader) Read(p []byte) (int, error) {
 	dlr.mu.Lock()
@@ -239,8 +407,7 @@ func (dlr *dpiLobReader) getSize() error {
 		return C.dpiLob_getSize(dlr.dpiLob, &dlr.sizePlusOne)
 	}); err != nil {
 		err = fmt.Errorf("getSize: %w", err)
-		C.dpiLob_close(dlr.dpiLob)
-		dlr.dpiLob = nil
+		dlr.closeAtEnd()
 	}
 	runtime.UnlockOSThread()
 	dlr.sizePlusOne++
@@ -320,8 +487,7 @@ func (dlr *dpiLobReader) read(p []byte) (int, error) {
 			}
 		}
 		if err != nil {
-			C.dpiLob_close(dlr.dpiLob)
-			dlr.dpiLob = nil
+			dlr.closeAtEnd()
 			if dlr.finished = codeErr != nil && codeErr.Code() == 1403; dlr.finished {
 				dlr.offset += n
 				return int(n), io.EOF
@@ -359,8 +525,7 @@ func (dlr *dpiLobReader) read(p []byte) (int, error) {
 	}
 	var err error
 	if amount != 0 && n == 0 || !dlr.IsClob && dlr.offset+1 >= dlr.sizePlusOne {
-		C.dpiLob_close(dlr.dpiLob)
-		dlr.dpiLob = nil
+		dlr.closeAtEnd()
 		dlr.finished = true
 		err = io.EOF
 	}
@@ -387,6 +552,40 @@ func (dlr *dpiLobReader) ReadAt(p []byte, off int64) (int, error) {
 	}
 	return int(n), err
 }
+
+// closeAtEnd closes the LOB after reading it (or failing to), releasing the reference of rows.Next.
+//
+// A fetched LOB is not closed, as that would free its locator, which the next fetch can reuse.
+func (dlr *dpiLobReader) closeAtEnd() {
+	if !dlr.fetched {
+		C.dpiLob_close(dlr.dpiLob)
+	}
+	if dlr.hasRef {
+		C.dpiLob_release(dlr.dpiLob)
+		dlr.hasRef = false
+	}
+	dlr.dpiLob = nil
+}
+
+// releaseRef releases the reference of rows.Next, if the LOB has not been read till its end or closed.
+// The Lob cannot be read after this.
+func (dlr *dpiLobReader) releaseRef() {
+	dlr.mu.Lock()
+	defer dlr.mu.Unlock()
+	if dlr.hasRef && dlr.dpiLob != nil {
+		dlr.hasRef = false
+		C.dpiLob_release(dlr.dpiLob)
+		dlr.dpiLob = nil
+	}
+}
+
+// holdsRef reports whether the reference of rows.Next is still held.
+func (dlr *dpiLobReader) holdsRef() bool {
+	dlr.mu.Lock()
+	defer dlr.mu.Unlock()
+	return dlr.hasRef && dlr.dpiLob != nil
+}
+
 func (dlr *dpiLobReader) Close() error {
 	if dlr == nil || dlr.dpiLob == nil {
 		return nil
@@ -613,6 +812,153 @@ func (dl *DirectLob) GetFileName() (dir, file string, err error) {
 	return dir, file, nil
 }
 
+// ParallelLobOptions are the options of DirectLob.ParallelReadAt and DirectLob.CopyTo.
+type ParallelLobOptions struct {
+	// DB provides the additional connections.
+	DB *sql.DB
+	// Query selects the same LOB (as the first column of its first row), with Args.
+	// LOB locators are bound to their session, so every additional connection
+	// needs its own, acquired by executing this query.
+	Query string
+	Args  []interface{}
+	// Parallelism is the number of concurrent readers, including the DirectLob itself. Defaults to 4.
+	Parallelism int
+	// RangeSize is the size of the ranges read at once by a reader,
+	// rounded up to a multiple of the LOB's chunk size. Defaults to 8MiB.
+	RangeSize int
+}
+
+// CopyTo copies the whole (binary) LOB to w, reading ranges of it concurrently
+// over opts.Parallelism connections, and writing each at its own offset.
+//
+// Returns the number of bytes written.
+func (dl *DirectLob) CopyTo(ctx context.Context, w io.WriterAt, opts ParallelLobOptions) (int64, error) {
+	size, err := dl.Size()
+	if err != nil {
+		return 0, err
+	}
+	return dl.parallelRead(ctx, w, 0, size, opts)
+}
+
+// ParallelReadAt reads len(p) bytes into p from the (binary) LOB at offset,
+// reading ranges concurrently over opts.Parallelism connections.
+func (dl *DirectLob) ParallelReadAt(ctx context.Context, p []byte, offset int64, opts ParallelLobOptions) (int, error) {
+	n, err := dl.parallelRead(ctx, sliceWriterAt{p: p, offset: offset}, offset, int64(len(p)), opts)
+	return int(n), err
+}
+
+// parallelRead reads length bytes from offset, and writes them to w at their offset.
+func (dl *DirectLob) parallelRead(ctx context.Context, w io.WriterAt, offset, length int64, opts ParallelLobOptions) (int64, error) {
+	if dl.isClob {
+		return 0, ErrCLOB
+	}
+	if length <= 0 {
+		return 0, nil
+	}
+	if opts.Parallelism <= 0 {
+		opts.Parallelism = 4
+	}
+	if opts.RangeSize <= 0 {
+		opts.RangeSize = 8 << 20
+	}
+	var chunkSize C.uint32_t
+	if err := dl.drv.checkExec(func() C.int { return C.dpiLob_getChunkSize(dl.dpiLob, &chunkSize) }); err != nil {
+		return 0, fmt.Errorf("getChunkSize: %w", err)
+	}
+	rangeSize := int64(opts.RangeSize)
+	if cs := int64(chunkSize); cs > 0 {
+		rangeSize = (rangeSize + cs - 1) / cs * cs
+	}
+	if numRanges := int((length + rangeSize - 1) / rangeSize); opts.Parallelism > numRanges {
+		opts.Parallelism = numRanges
+	}
+	if opts.DB == nil || opts.Query == "" {
+		opts.Parallelism = 1
+	}
+
+	grp, grpCtx := errgroup.WithContext(ctx)
+	ranges := make(chan int64)
+	grp.Go(func() error {
+		defer close(ranges)
+		for start := offset; start < offset+length; start += rangeSize {
+			select {
+			case ranges <- start:
+			case <-grpCtx.Done():
+				return grpCtx.Err()
+			}
+		}
+		return nil
+	})
+
+	var written atomic.Int64
+	readRanges := func(lob *DirectLob) error {
+		buf := make([]byte, rangeSize)
+		for start := range ranges {
+			end := start + rangeSize
+			if end > offset+length {
+				end = offset + length
+			}
+			for pos := start; pos < end; {
+				n, err := lob.ReadAt(buf[:end-pos], pos)
+				if n > 0 {
+					if _, wErr := w.WriteAt(buf[:n], pos); wErr != nil {
+						return wErr
+					}
+					written.Add(int64(n))
+					pos += int64(n)
+				}
+				if err != nil {
+					return err
+				}
+				if n == 0 {
+					return fmt.Errorf("read %d at %d: %w", end-pos, pos, io.ErrUnexpectedEOF)
+				}
+			}
+		}
+		return nil
+	}
+
+	grp.Go(func() error { return readRanges(dl) })
+	for i := 1; i < opts.Parallelism; i++ {
+		grp.Go(func() error {
+			return queryRaw(grpCtx, opts.DB, opts.Query, opts.Args, func(r *rows) error {
+				dest := make([]driver.Value, len(r.columns))
+				if err := r.Next(dest); err != nil {
+					if errors.Is(err, io.EOF) {
+						return fmt.Errorf("%s: %w", opts.Query, sql.ErrNoRows)
+					}
+					return err
+				}
+				lob, ok := dest[0].(*Lob)
+				if !ok {
+					return fmt.Errorf("%s: got %T, wanted a LOB", opts.Query, dest[0])
+				}
+				lr, ok := lob.Reader.(*dpiLobReader)
+				if !ok {
+					return fmt.Errorf("%s: got %T, wanted a LOB", opts.Query, lob.Reader)
+				}
+				// the locator lives till the rows are closed
+				return readRanges(&DirectLob{drv: lr.drv, dpiLob: lr.dpiLob})
+			})
+		})
+	}
+	err := grp.Wait()
+	return written.Load(), err
+}
+
+// sliceWriterAt is an io.WriterAt writing into p, which starts at offset.
+type sliceWriterAt struct {
+	p      []byte
+	offset int64
+}
+
+func (sw sliceWriterAt) WriteAt(p []byte, off int64) (int, error) {
+	if off < sw.offset || off-sw.offset+int64(len(p)) > int64(len(sw.p)) {
+		return 0, io.ErrShortWrite
+	}
+	return copy(sw.p[off-sw.offset:], p), nil
+}
+
 func maxI(a, b int) int {
 	if a < b {
 		return b
@@ -0,0 +1,1156 @@
+//go:build godror_mockoci
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dpiImpl.h"
+#include "mockoci.h"
+
+// This is an in-memory implementation of the subset of the OCI library that
+// standalone connections, statement execution, query describe and fetch use,
+// served to ODPI-C by dpiOci__loadSymbol (with DPI_MOCK_OCI defined).
+// The queries return the synthetic rows registered with godrorMockOCIQuery,
+// the other statements succeed without doing anything.
+
+#define GODROR_MOCK_VERSION 19
+#define GODROR_MOCK_RELEASE 24
+#define GODROR_MOCK_MAX_BINDS 256
+
+typedef struct {
+	char *name;
+	uint32_t nameLength;
+	uint16_t dataType;
+	uint32_t size;
+	int16_t precision;
+	int8_t scale;
+	uint64_t cardinality;
+} godrorMockColumn;
+
+struct godrorMockQuery {
+	godrorMockQuery *next;
+	char *sql;
+	uint32_t sqlLength;
+	uint64_t numRows;
+	uint32_t numColumns;
+	godrorMockColumn *columns;
+};
+
+typedef int32_t (*godrorMockDefineCallback)(void *octxp, void *defnp,
+		uint32_t iter, void **bufpp, uint32_t **alenpp, uint8_t *piecep,
+		void **indpp, uint16_t **rcodepp);
+
+typedef struct {
+	char *value;
+	uint64_t valueSize;
+	uint16_t dataType;
+	int16_t *indicator;
+	uint32_t *returnLength;
+	uint16_t *returnCode;
+	// dynamic define
+	void *callbackContext;
+	godrorMockDefineCallback callback;
+} godrorMockDefine;
+
+typedef struct godrorMockHandle godrorMockHandle;
+struct godrorMockHandle {
+	uint32_t type;
+	// error handle
+	int32_t errorCode;
+	char errorMessage[512];
+	// service context
+	godrorMockHandle *server, *session;
+	// statement
+	const godrorMockQuery *query;
+	uint16_t statementType;
+	uint64_t nextRow, rowCount;
+	uint32_t rowsFetched;
+	godrorMockDefine *defines;
+	char *bindText;
+	uint32_t numBinds;
+	char *bindNames[GODROR_MOCK_MAX_BINDS];
+	uint8_t bindNameLengths[GODROR_MOCK_MAX_BINDS];
+	uint8_t bindIsDuplicate[GODROR_MOCK_MAX_BINDS];
+	// parameter (column) descriptor, and LOB locator
+	const godrorMockColumn *column;
+	// LOB locator
+	uint64_t row;
+};
+
+static pthread_mutex_t godrorMockMutex = PTHREAD_MUTEX_INITIALIZER;
+static godrorMockQuery *godrorMockQueries;
+
+// godrorMockError sets the error of the error handle and returns OCI_ERROR.
+static int godrorMockError(void *errhp, int32_t code, const char *message) {
+	godrorMockHandle *e = errhp;
+	if (e) {
+		e->errorCode = code;
+		snprintf(e->errorMessage, sizeof(e->errorMessage), "ORA-%05d: %s",
+				code, message);
+	}
+	return DPI_OCI_ERROR;
+}
+
+static godrorMockHandle *godrorMockNewHandle(uint32_t type) {
+	godrorMockHandle *h = calloc(1, sizeof(godrorMockHandle));
+	if (h)
+		h->type = type;
+	return h;
+}
+
+static void godrorMockFreeHandle(godrorMockHandle *h) {
+	if (h) {
+		free(h->defines);
+		free(h->bindText);
+		free(h);
+	}
+}
+
+godrorMockQuery *godrorMockOCIQuery(const char *sql, uint32_t sqlLength,
+		uint64_t numRows) {
+	godrorMockQuery *q;
+	uint32_t i;
+
+	pthread_mutex_lock(&godrorMockMutex);
+	for (q = godrorMockQueries; q; q = q->next) {
+		if (q->sqlLength == sqlLength && memcmp(q->sql, sql, sqlLength) == 0)
+			break;
+	}
+	if (q) {
+		for (i = 0; i < q->numColumns; i++)
+			free(q->columns[i].name);
+		free(q->columns);
+		q->columns = NULL;
+		q->numColumns = 0;
+	} else if ((q = calloc(1, sizeof(godrorMockQuery)))) {
+		q->sql = malloc(sqlLength);
+		memcpy(q->sql, sql, sqlLength);
+		q->sqlLength = sqlLength;
+		q->next = godrorMockQueries;
+		godrorMockQueries = q;
+	}
+	if (q)
+		q->numRows = numRows;
+	pthread_mutex_unlock(&godrorMockMutex);
+	return q;
+}
+
+void godrorMockOCIColumn(godrorMockQuery *q, const char *name,
+		uint32_t nameLength, uint16_t dataType, uint32_t size,
+		int16_t precision, int8_t scale, uint64_t cardinality) {
+	godrorMockColumn *columns, *c;
+
+	pthread_mutex_lock(&godrorMockMutex);
+	columns = realloc(q->columns,
+			(q->numColumns + 1) * sizeof(godrorMockColumn));
+	if (columns) {
+		q->columns = columns;
+		c = &columns[q->numColumns++];
+		c->name = malloc(nameLength);
+		memcpy(c->name, name, nameLength);
+		c->nameLength = nameLength;
+		c->dataType = dataType;
+		c->size = size;
+		c->precision = precision;
+		c->scale = scale;
+		c->cardinality = cardinality;
+	}
+	pthread_mutex_unlock(&godrorMockMutex);
+}
+
+// godrorMockFindQuery returns the registered query of sql, or NULL.
+static const godrorMockQuery *godrorMockFindQuery(const char *sql,
+		uint32_t sqlLength) {
+	const godrorMockQuery *q;
+
+	pthread_mutex_lock(&godrorMockMutex);
+	for (q = godrorMockQueries; q; q = q->next) {
+		if (q->sqlLength == sqlLength && memcmp(q->sql, sql, sqlLength) == 0)
+			break;
+	}
+	pthread_mutex_unlock(&godrorMockMutex);
+	return q;
+}
+
+// godrorMockStatementType returns the type of the statement from its first
+// keyword.
+static uint16_t godrorMockStatementType(const char *sql, uint32_t sqlLength) {
+	static const struct {
+		const char *keyword;
+		uint16_t type;
+	} keywords[] = {
+		{"SELECT", DPI_STMT_TYPE_SELECT}, {"WITH", DPI_STMT_TYPE_SELECT},
+		{"UPDATE", DPI_STMT_TYPE_UPDATE}, {"DELETE", DPI_STMT_TYPE_DELETE},
+		{"INSERT", DPI_STMT_TYPE_INSERT}, {"MERGE", DPI_STMT_TYPE_MERGE},
+		{"BEGIN", DPI_STMT_TYPE_BEGIN}, {"DECLARE", DPI_STMT_TYPE_DECLARE},
+		{"CALL", DPI_STMT_TYPE_CALL}, {"COMMIT", DPI_STMT_TYPE_COMMIT},
+		{"ROLLBACK", DPI_STMT_TYPE_ROLLBACK},
+		{"CREATE", DPI_STMT_TYPE_CREATE}, {"DROP", DPI_STMT_TYPE_DROP},
+		{"ALTER", DPI_STMT_TYPE_ALTER},
+	};
+	uint32_t i, j, n;
+
+	while (sqlLength > 0 && (*sql == ' ' || *sql == '\t' || *sql == '\n' ||
+			*sql == '\r' || *sql == '(')) {
+		sql++;
+		sqlLength--;
+	}
+	for (i = 0; i < sizeof(keywords) / sizeof(keywords[0]); i++) {
+		n = (uint32_t) strlen(keywords[i].keyword);
+		if (sqlLength < n)
+			continue;
+		for (j = 0; j < n; j++) {
+			if ((sql[j] & ~0x20) != keywords[i].keyword[j])
+				break;
+		}
+		if (j == n)
+			return keywords[i].type;
+	}
+	return DPI_STMT_TYPE_UNKNOWN;
+}
+
+//-----------------------------------------------------------------------------
+// the mocked OCI functions
+//-----------------------------------------------------------------------------
+
+static void godrorMockClientVersion(int *major, int *minor, int *update,
+		int *patch, int *portUpdate) {
+	*major = GODROR_MOCK_VERSION;
+	*minor = 0;
+	*update = GODROR_MOCK_RELEASE;
+	*patch = 0;
+	*portUpdate = 0;
+}
+
+static void godrorMockThreadProcessInit(void) {
+}
+
+static int godrorMockThreadKeyInit(void *hndl, void *err, void **key,
+		void *destFn) {
+	pthread_key_t *k = malloc(sizeof(pthread_key_t));
+	if (!k || pthread_key_create(k, (void (*)(void*)) destFn) != 0) {
+		free(k);
+		return godrorMockError(err, 1019, "unable to allocate thread key");
+	}
+	*key = k;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockThreadKeyDestroy(void *hndl, void *err, void **key) {
+	pthread_key_t *k = *key;
+	if (k) {
+		pthread_key_delete(*k);
+		free(k);
+		*key = NULL;
+	}
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockThreadKeyGet(void *hndl, void *err, void *key,
+		void **value) {
+	*value = pthread_getspecific(*(pthread_key_t*) key);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockThreadKeySet(void *hndl, void *err, void *key,
+		void *value) {
+	pthread_setspecific(*(pthread_key_t*) key, value);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockEnvNlsCreate(void **envp, uint32_t mode, void *ctxp,
+		void *malocfp, void *ralocfp, void *mfreefp, size_t xtramemSize,
+		void **usrmempp, uint16_t charset, uint16_t ncharset) {
+	if (!(*envp = godrorMockNewHandle(DPI_OCI_HTYPE_ENV)))
+		return DPI_OCI_ERROR;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockHandleAlloc(const void *parent, void **handle,
+		const uint32_t type, const size_t xtramemSize, void **usrmempp) {
+	if (!(*handle = godrorMockNewHandle(type)))
+		return DPI_OCI_ERROR;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockHandleFree(void *handle, const uint32_t type) {
+	godrorMockFreeHandle(handle);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockDescriptorAlloc(const void *parent, void **descriptor,
+		const uint32_t type, const size_t xtramemSize, void **usrmempp) {
+	return godrorMockHandleAlloc(parent, descriptor, type, xtramemSize,
+			usrmempp);
+}
+
+static int godrorMockDescriptorFree(void *descriptor, const uint32_t type) {
+	return godrorMockHandleFree(descriptor, type);
+}
+
+static int godrorMockErrorGet(void *handle, uint32_t recordNum, char *sqlState,
+		int32_t *errorCode, char *buffer, uint32_t bufferSize, uint32_t type) {
+	godrorMockHandle *e = handle;
+	if (recordNum != 1 || !e || e->errorCode == 0)
+		return DPI_OCI_NO_DATA;
+	*errorCode = e->errorCode;
+	snprintf(buffer, bufferSize, "%s", e->errorMessage);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNlsCharSetIdToName(void *envhp, char *buffer,
+		size_t bufferLength, uint16_t id) {
+	snprintf(buffer, bufferLength, "%s", "AL32UTF8");
+	return DPI_OCI_SUCCESS;
+}
+
+static uint16_t godrorMockNlsCharSetNameToId(void *envhp, const char *name) {
+	return DPI_CHARSET_ID_UTF8;
+}
+
+static int godrorMockNlsNameMap(void *envhp, char *buffer, size_t bufferLength,
+		const char *source, uint32_t flag) {
+	snprintf(buffer, bufferLength, "%s",
+			(flag == DPI_OCI_NLS_CS_ORA_TO_IANA) ? "UTF-8" : "AL32UTF8");
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNlsNumericInfoGet(void *envhp, void *errhp, int32_t *value,
+		uint16_t item) {
+	switch (item) {
+		case DPI_OCI_NLS_CHARSET_MAXBYTESZ:
+			*value = 4;
+			break;
+		case DPI_OCI_NLS_CHARSET_ID:
+		case DPI_OCI_NLS_NCHARSET_ID:
+			*value = DPI_CHARSET_ID_UTF8;
+			break;
+		default:
+			return godrorMockError(errhp, 1, "unsupported NLS numeric item");
+	}
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNlsEnvironmentVariableGet(void *value, size_t size,
+		uint16_t item, uint16_t charset, size_t *rsize) {
+	*(uint16_t*) value = DPI_CHARSET_ID_UTF8;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockServerAttach(void *server, void *errhp,
+		const char *dblink, int32_t dblinkLength, uint32_t mode) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockServerDetach(void *server, void *errhp, uint32_t mode) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockSessionBegin(void *svchp, void *errhp, void *session,
+		uint32_t credentials, uint32_t mode) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockSessionEnd(void *svchp, void *errhp, void *session,
+		uint32_t mode) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockSessionGet(void *envhp, void *errhp, void **svchp,
+		void *authhp, const char *poolName, uint32_t poolNameLength,
+		const char *tagInfo, uint32_t tagInfoLength, const char **retTagInfo,
+		uint32_t *retTagInfoLength, int *found, uint32_t mode) {
+	godrorMockHandle *svc = godrorMockNewHandle(DPI_OCI_HTYPE_SVCCTX);
+	if (!svc)
+		return godrorMockError(errhp, 1019, "unable to allocate memory");
+	svc->server = godrorMockNewHandle(DPI_OCI_HTYPE_SERVER);
+	svc->session = godrorMockNewHandle(DPI_OCI_HTYPE_SESSION);
+	*svchp = svc;
+	if (retTagInfo) {
+		*retTagInfo = NULL;
+		*retTagInfoLength = 0;
+	}
+	if (found)
+		*found = 0;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockSessionRelease(void *svchp, void *errhp, const char *tag,
+		uint32_t tagLength, uint32_t mode) {
+	godrorMockHandle *svc = svchp;
+	godrorMockFreeHandle(svc->server);
+	godrorMockFreeHandle(svc->session);
+	godrorMockFreeHandle(svc);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockServerRelease2(void *handle, void *errhp, char *buffer,
+		uint32_t bufferSize, uint8_t handleType, uint32_t *version,
+		uint32_t mode) {
+	snprintf(buffer, bufferSize, "Oracle Database %d mock Release %d.%d",
+			GODROR_MOCK_VERSION, GODROR_MOCK_VERSION, GODROR_MOCK_RELEASE);
+	*version = (uint32_t) DPI_ORACLE_VERSION_TO_NUMBER(GODROR_MOCK_VERSION,
+			0, GODROR_MOCK_RELEASE, 0, 0);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockServerRelease(void *handle, void *errhp, char *buffer,
+		uint32_t bufferSize, uint8_t handleType, uint32_t *version) {
+	return godrorMockServerRelease2(handle, errhp, buffer, bufferSize,
+			handleType, version, 0);
+}
+
+static int godrorMockPing(void *svchp, void *errhp, uint32_t mode) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockBreak(void *handle, void *errhp) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockTransCommit(void *svchp, void *errhp, uint32_t flags) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockTransRollback(void *svchp, void *errhp, uint32_t flags) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockContextGetValue(void *handle, void *errhp,
+		const char *key, uint8_t keyLength, void **value) {
+	*value = NULL;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockContextSetValue(void *handle, void *errhp,
+		uint16_t duration, const char *key, uint8_t keyLength, void *value) {
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockMemoryAlloc(void *handle, void *errhp, void **memory,
+		uint16_t duration, uint32_t size, uint32_t flags) {
+	if (!(*memory = calloc(1, size)))
+		return godrorMockError(errhp, 1019, "unable to allocate memory");
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockMemoryFree(void *handle, void *errhp, void *memory) {
+	free(memory);
+	return DPI_OCI_SUCCESS;
+}
+
+// godrorMockParseBinds collects the (upper case) names of the placeholders of
+// sql into the statement, skipping the string literals and comments.
+static void godrorMockParseBinds(godrorMockHandle *stmt, const char *sql,
+		uint32_t sqlLength) {
+	uint32_t i, start, j;
+	char *text;
+
+	if (!(text = stmt->bindText = malloc(sqlLength + 1)))
+		return;
+	for (i = 0; i < sqlLength; i++) {
+		if (sql[i] == '\'') {
+			while (++i < sqlLength && sql[i] != '\'');
+			continue;
+		} else if (sql[i] == '-' && i + 1 < sqlLength && sql[i + 1] == '-') {
+			while (++i < sqlLength && sql[i] != '\n');
+			continue;
+		} else if (sql[i] == '/' && i + 1 < sqlLength && sql[i + 1] == '*') {
+			for (i += 2; i + 1 < sqlLength &&
+					!(sql[i] == '*' && sql[i + 1] == '/'); i++);
+			i++;
+			continue;
+		} else if (sql[i] != ':' || stmt->numBinds == GODROR_MOCK_MAX_BINDS)
+			continue;
+		for (start = ++i; i < sqlLength && (sql[i] == '_' || sql[i] == '$' ||
+				sql[i] == '#' || (sql[i] >= '0' && sql[i] <= '9') ||
+				(sql[i] >= 'a' && sql[i] <= 'z') ||
+				(sql[i] >= 'A' && sql[i] <= 'Z')); i++)
+			*text++ = (sql[i] >= 'a' && sql[i] <= 'z') ? sql[i] - 32 : sql[i];
+		if (i == start || i - start > 128) {
+			text -= i - start;
+			i--;
+			continue;
+		}
+		stmt->bindNames[stmt->numBinds] = text - (i - start);
+		stmt->bindNameLengths[stmt->numBinds] = (uint8_t) (i - start);
+		for (j = 0; j < stmt->numBinds; j++) {
+			if (stmt->bindNameLengths[j] == i - start &&
+					memcmp(stmt->bindNames[j],
+							stmt->bindNames[stmt->numBinds], i - start) == 0) {
+				stmt->bindIsDuplicate[stmt->numBinds] = 1;
+				break;
+			}
+		}
+		stmt->numBinds++;
+		i--;
+	}
+}
+
+static int godrorMockStmtPrepare2(void *svchp, void **stmtp, void *errhp,
+		const char *sql, uint32_t sqlLength, const char *key,
+		uint32_t keyLength, uint32_t language, uint32_t mode) {
+	godrorMockHandle *stmt = godrorMockNewHandle(DPI_OCI_HTYPE_STMT);
+	if (!stmt)
+		return godrorMockError(errhp, 1019, "unable to allocate memory");
+	stmt->statementType = godrorMockStatementType(sql, sqlLength);
+	godrorMockParseBinds(stmt, sql, sqlLength);
+	if (stmt->statementType == DPI_STMT_TYPE_SELECT) {
+		if (!(stmt->query = godrorMockFindQuery(sql, sqlLength))) {
+			godrorMockFreeHandle(stmt);
+			return godrorMockError(errhp, 942,
+					"table or view does not exist (query is not mocked)");
+		}
+		stmt->defines = calloc(stmt->query->numColumns + 1,
+				sizeof(godrorMockDefine));
+	}
+	*stmtp = stmt;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockStmtRelease(void *stmtp, void *errhp, const char *key,
+		uint32_t keyLength, uint32_t mode) {
+	godrorMockFreeHandle(stmtp);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockStmtExecute(void *svchp, void *stmtp, void *errhp,
+		uint32_t iters, uint32_t rowOffset, const void *snapIn,
+		void *snapOut, uint32_t mode) {
+	godrorMockHandle *stmt = stmtp;
+	stmt->nextRow = 0;
+	stmt->rowsFetched = 0;
+	stmt->rowCount = (stmt->statementType == DPI_STMT_TYPE_SELECT) ? 0 : iters;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockStmtGetNextResult(void *stmtp, void *errhp,
+		void **result, uint32_t *resultType, uint32_t mode) {
+	return DPI_OCI_NO_DATA;
+}
+
+static int godrorMockStmtGetBindInfo(void *stmtp, void *errhp, uint32_t size,
+		uint32_t startLoc, int32_t *found, char *bindNames[],
+		uint8_t bindNameLengths[], char *indicatorNames[],
+		uint8_t indicatorNameLengths[], uint8_t duplicate[], void **binds) {
+	const godrorMockHandle *stmt = stmtp;
+	uint32_t i;
+
+	*found = 0;
+	if (startLoc < 1 || startLoc > stmt->numBinds)
+		return DPI_OCI_NO_DATA;
+	for (i = 0; i < size && startLoc - 1 + i < stmt->numBinds; i++) {
+		bindNames[i] = stmt->bindNames[startLoc - 1 + i];
+		bindNameLengths[i] = stmt->bindNameLengths[startLoc - 1 + i];
+		indicatorNames[i] = NULL;
+		indicatorNameLengths[i] = 0;
+		duplicate[i] = stmt->bindIsDuplicate[startLoc - 1 + i];
+		binds[i] = NULL;
+	}
+	*found = (startLoc - 1 + i < stmt->numBinds) ?
+			-(int32_t) stmt->numBinds : (int32_t) stmt->numBinds;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockParamGet(const void *handle, uint32_t handleType,
+		void *errhp, void **param, uint32_t pos) {
+	const godrorMockHandle *stmt = handle;
+	godrorMockHandle *p;
+	if (!stmt->query || pos < 1 || pos > stmt->query->numColumns)
+		return godrorMockError(errhp, 24334, "no descriptor for position");
+	if (!(p = godrorMockNewHandle(DPI_OCI_DTYPE_PARAM)))
+		return godrorMockError(errhp, 1019, "unable to allocate memory");
+	p->column = &stmt->query->columns[pos - 1];
+	*param = p;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockDefineByPos2(void *stmtp, void **defnp, void *errhp,
+		uint32_t position, void *value, uint64_t valueSize, uint16_t dataType,
+		void *indicator, uint32_t *returnLength, uint16_t *returnCode,
+		uint32_t mode) {
+	godrorMockHandle *stmt = stmtp;
+	godrorMockDefine *d;
+	if (!stmt->query || position < 1 || position > stmt->query->numColumns)
+		return godrorMockError(errhp, 1007, "variable not in select list");
+	d = &stmt->defines[position - 1];
+	d->value = value;
+	d->valueSize = valueSize;
+	d->dataType = dataType;
+	d->indicator = indicator;
+	d->returnLength = returnLength;
+	d->returnCode = returnCode;
+	*defnp = d;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockDefineDynamic(void *defnp, void *errhp, void *octxp,
+		void *ocbfp) {
+	godrorMockDefine *d = defnp;
+	d->callbackContext = octxp;
+	d->callback = (godrorMockDefineCallback) ocbfp;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockBindByPos2(void *stmtp, void **bindp, void *errhp,
+		uint32_t position, void *value, int64_t valueSize, uint16_t dataType,
+		void *indicator, uint32_t *actualLength, uint16_t *returnCode,
+		uint32_t maxArrayLength, uint32_t *currentArrayLength, uint32_t mode) {
+	*bindp = stmtp;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockBindByName2(void *stmtp, void **bindp, void *errhp,
+		const char *placeholder, int32_t placeholderLength, void *value,
+		int64_t valueSize, uint16_t dataType, void *indicator,
+		uint32_t *actualLength, uint16_t *returnCode, uint32_t maxArrayLength,
+		uint32_t *currentArrayLength, uint32_t mode) {
+	*bindp = stmtp;
+	return DPI_OCI_SUCCESS;
+}
+
+// godrorMockNumberFromText encodes the decimal text (without exponent) as an
+// Oracle NUMBER into the OCINumber (length byte, exponent byte and base 100
+// mantissa digits).
+static void godrorMockNumberFromText(const char *text, uint8_t *number) {
+	uint8_t digits[64], pairs[DPI_OCI_NUMBER_SIZE];
+	int isNegative = (*text == '-'), numDigits = 0, pointIndex = -1;
+	int numPairs = 0, exponent, i, first;
+
+	for (text += isNegative; *text && numDigits < 60; text++) {
+		if (*text == '.')
+			pointIndex = numDigits;
+		else if (*text >= '0' && *text <= '9')
+			digits[numDigits++] = (uint8_t) (*text - '0');
+	}
+	if (pointIndex < 0)
+		pointIndex = numDigits;
+
+	// pair up the digits around the decimal point
+	first = (pointIndex % 2) ? -1 : 0;
+	exponent = (pointIndex - first) / 2 - 1;
+	for (i = first; i < numDigits && numPairs < 20; i += 2)
+		pairs[numPairs++] = (uint8_t) (((i < 0) ? 0 : digits[i]) * 10 +
+				((i + 1 < numDigits) ? digits[i + 1] : 0));
+	for (i = 0; i < numPairs && pairs[i] == 0; i++)
+		exponent--;
+	numPairs -= i;
+	memmove(pairs, pairs + i, numPairs);
+	while (numPairs > 0 && pairs[numPairs - 1] == 0)
+		numPairs--;
+	if (numPairs == 0) {
+		number[0] = 1;
+		number[1] = 0x80;
+		return;
+	}
+
+	number[0] = (uint8_t) (numPairs + 1);
+	if (isNegative) {
+		number[1] = (uint8_t) ~(0xc1 + exponent);
+		for (i = 0; i < numPairs; i++)
+			number[i + 2] = (uint8_t) (101 - pairs[i]);
+		if (numPairs < 20)
+			number[number[0]++ + 1] = 102;
+	} else {
+		number[1] = (uint8_t) (0xc1 + exponent);
+		for (i = 0; i < numPairs; i++)
+			number[i + 2] = (uint8_t) (pairs[i] + 1);
+	}
+}
+
+// godrorMockNumberValue decodes the Oracle NUMBER of the OCINumber.
+static double godrorMockNumberValue(const uint8_t *number) {
+	int isNegative = !(number[1] & 0x80), numPairs = number[0] - 1, i;
+	int exponent;
+	double value = 0, scale;
+
+	if (numPairs <= 0)
+		return 0;
+	if (isNegative) {
+		exponent = (uint8_t) ~number[1] - 0xc1;
+		if (number[numPairs + 1] == 102)
+			numPairs--;
+	} else
+		exponent = number[1] - 0xc1;
+	for (i = 0, scale = 1; i < exponent; i++)
+		scale *= 100;
+	for (i = exponent; i < 0; i++)
+		scale /= 100;
+	for (i = 0; i < numPairs; i++, scale /= 100)
+		value += scale * (isNegative ? 101 - number[i + 2] :
+				number[i + 2] - 1);
+	return isNegative ? -value : value;
+}
+
+static int godrorMockNumberFromInt(void *errhp, const void *value,
+		unsigned int valueLength, unsigned int flags, void *number) {
+	char text[32];
+	if (!(flags & DPI_OCI_NUMBER_SIGNED))
+		snprintf(text, sizeof(text), "%llu",
+				(unsigned long long) *(const uint64_t*) value);
+	else
+		snprintf(text, sizeof(text), "%lld",
+				(long long) *(const int64_t*) value);
+	godrorMockNumberFromText(text, number);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNumberFromReal(void *errhp, const void *value,
+		unsigned int valueLength, void *number) {
+	char text[400];
+	snprintf(text, sizeof(text), "%f", *(const double*) value);
+	godrorMockNumberFromText(text, number);
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNumberToInt(void *errhp, const void *number,
+		unsigned int valueLength, unsigned int flags, void *value) {
+	double v = godrorMockNumberValue(number);
+	if (!(flags & DPI_OCI_NUMBER_SIGNED))
+		*(uint64_t*) value = (uint64_t) v;
+	else
+		*(int64_t*) value = (int64_t) v;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockNumberToReal(void *errhp, const void *number,
+		unsigned int valueLength, void *value) {
+	*(double*) value = godrorMockNumberValue(number);
+	return DPI_OCI_SUCCESS;
+}
+
+// godrorMockValue writes the value of the column of the row into the buffer
+// of the define, and returns its length, or -1 if the type is not supported.
+static int64_t godrorMockValue(const godrorMockColumn *column, uint64_t row,
+		uint32_t columnNum, const godrorMockDefine *d, char *buffer) {
+	int64_t value;
+	char text[64];
+	int n;
+
+	if (column->cardinality)
+		row %= column->cardinality;
+	value = (int64_t) (row + columnNum);
+
+	switch (d->dataType) {
+		case DPI_SQLT_VNU:
+			if (column->scale > 0)
+				snprintf(text, sizeof(text), "%lld.%0*d", (long long) value,
+						(int) column->scale, 5);
+			else
+				snprintf(text, sizeof(text), "%lld", (long long) value);
+			godrorMockNumberFromText(text, (uint8_t*) buffer);
+			return DPI_OCI_NUMBER_SIZE;
+		case DPI_SQLT_CHR:
+		case DPI_SQLT_AFC:
+			if (column->dataType == DPI_SQLT_CHR ||
+					column->dataType == DPI_SQLT_AFC)
+				n = snprintf(text, sizeof(text), "row %llu column %u",
+						(unsigned long long) row, columnNum);
+			else if (column->scale > 0)
+				n = snprintf(text, sizeof(text), "%lld.%0*d",
+						(long long) value, (int) column->scale, 5);
+			else
+				n = snprintf(text, sizeof(text), "%lld", (long long) value);
+			if ((uint64_t) n > d->valueSize)
+				n = (int) d->valueSize;
+			memcpy(buffer, text, n);
+			return n;
+		case DPI_SQLT_INT:
+		case DPI_SQLT_UIN:
+			memcpy(buffer, &value, sizeof(value));
+			return sizeof(value);
+		case DPI_SQLT_BDOUBLE: {
+			double v = (double) value + 0.5;
+			memcpy(buffer, &v, sizeof(v));
+			return sizeof(v);
+		}
+		case DPI_SQLT_BFLOAT: {
+			float v = (float) value + 0.5f;
+			memcpy(buffer, &v, sizeof(v));
+			return sizeof(v);
+		}
+		case DPI_SQLT_CLOB:
+		case DPI_SQLT_BLOB: {
+			godrorMockHandle *locator = *(godrorMockHandle**) buffer;
+			if (!locator)
+				return -1;
+			locator->column = column;
+			locator->row = row;
+			return sizeof(void*);
+		}
+	}
+	return -1;
+}
+
+// godrorMockDynamicValue writes the value of the (LONG) column of the row
+// piecewise into the buffers the callback of the dynamic define returns:
+// column->size bytes of a letter of the row.
+static int32_t godrorMockDynamicValue(const godrorMockColumn *column,
+		uint64_t row, uint32_t iter, const godrorMockDefine *d) {
+	uint8_t piece = DPI_OCI_ONE_PIECE;
+	uint64_t offset = 0, n;
+	uint16_t *returnCode;
+	void *buffer, *indicator;
+	uint32_t *length;
+	int32_t status;
+
+	if (column->cardinality)
+		row %= column->cardinality;
+	do {
+		status = d->callback(d->callbackContext, (void*) d, iter, &buffer,
+				&length, &piece, &indicator, &returnCode);
+		if (status != DPI_OCI_CONTINUE)
+			return status;
+		n = column->size - offset;
+		if (n > *length)
+			n = *length;
+		memset(buffer, 'a' + (int) (row % 26), n);
+		*length = (uint32_t) n;
+		*(int16_t*) indicator = 0;
+		offset += n;
+	} while (offset < column->size);
+	return DPI_OCI_CONTINUE;
+}
+
+static int godrorMockStmtFetch2(void *stmtp, void *errhp, uint32_t numRows,
+		uint16_t orientation, int32_t offset, uint32_t mode) {
+	godrorMockHandle *stmt = stmtp;
+	const godrorMockQuery *q = stmt->query;
+	const godrorMockDefine *d;
+	uint64_t remaining;
+	uint32_t i, c;
+	int64_t n;
+
+	stmt->rowsFetched = 0;
+	if (!q)
+		return godrorMockError(errhp, 24374, "define not done before fetch");
+	remaining = q->numRows - stmt->nextRow;
+	if (numRows > remaining)
+		numRows = (uint32_t) remaining;
+	for (i = 0; i < numRows; i++) {
+		for (c = 0; c < q->numColumns; c++) {
+			d = &stmt->defines[c];
+			if (d->callback) {
+				if (godrorMockDynamicValue(&q->columns[c], stmt->nextRow + i,
+						i, d) != DPI_OCI_CONTINUE)
+					return godrorMockError(errhp, 1019,
+							"unable to allocate memory (define callback)");
+				continue;
+			}
+			if (!d->value)
+				continue;
+			n = godrorMockValue(&q->columns[c], stmt->nextRow + i, c, d,
+					d->value + i * d->valueSize);
+			if (n < 0)
+				return godrorMockError(errhp, 932,
+						"inconsistent datatypes (define type is not mocked)");
+			if (d->indicator)
+				d->indicator[i] = 0;
+			if (d->returnLength)
+				d->returnLength[i] = (uint32_t) n;
+			if (d->returnCode)
+				d->returnCode[i] = 0;
+		}
+	}
+	stmt->nextRow += numRows;
+	stmt->rowCount = stmt->nextRow;
+	stmt->rowsFetched = numRows;
+	return (stmt->nextRow < q->numRows) ? DPI_OCI_SUCCESS : DPI_OCI_NO_DATA;
+}
+
+// godrorMockLobGetLength2 returns the length of the LOB: column->size (bytes
+// or characters, as its value is ASCII).
+static int godrorMockLobGetLength2(void *svchp, void *errhp, void *locp,
+		uint64_t *lenp) {
+	const godrorMockHandle *locator = locp;
+	if (!locator->column)
+		return godrorMockError(errhp, 22275, "invalid LOB locator specified");
+	*lenp = locator->column->size;
+	return DPI_OCI_SUCCESS;
+}
+
+// godrorMockLobRead2 reads the value of the LOB: column->size bytes of a
+// letter of the row, as godrorMockDynamicValue.
+static int godrorMockLobRead2(void *svchp, void *errhp, void *locp,
+		uint64_t *byte_amtp, uint64_t *char_amtp, uint64_t offset, void *bufp,
+		uint64_t bufl, uint8_t piece, void *ctxp, void *cbfp, uint16_t csid,
+		uint8_t csfrm) {
+	const godrorMockHandle *locator = locp;
+	uint64_t amount = (*char_amtp) ? *char_amtp : *byte_amtp, n = 0;
+
+	if (!locator->column)
+		return godrorMockError(errhp, 22275, "invalid LOB locator specified");
+	if (offset >= 1 && offset <= locator->column->size) {
+		n = locator->column->size - (offset - 1);
+		if (n > bufl)
+			n = bufl;
+		if (amount && n > amount)
+			n = amount;
+		memset(bufp, 'a' + (int) (locator->row % 26), n);
+	}
+	*byte_amtp = n;
+	*char_amtp = n;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockLobGetChunkSize(void *svchp, void *errhp, void *locp,
+		uint32_t *chunksizep) {
+	*chunksizep = 8132;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockLobIsTemporary(void *envp, void *errhp, void *locp,
+		int *is_temporary) {
+	*is_temporary = 0;
+	return DPI_OCI_SUCCESS;
+}
+
+static int godrorMockLobFreeTemporary(void *svchp, void *errhp, void *locp) {
+	return DPI_OCI_SUCCESS;
+}
+
+// godrorMockString sets the string attribute.
+static void godrorMockString(void *attribute, uint32_t *size,
+		const char *value, uint32_t length) {
+	*(const char**) attribute = value;
+	if (size)
+		*size = length;
+}
+
+static int godrorMockAttrGet(const void *handle, uint32_t handleType,
+		void *attribute, uint32_t *size, uint32_t attributeType, void *errhp) {
+	const godrorMockHandle *h = handle;
+	const godrorMockColumn *column;
+	char message[128];
+
+	switch (handleType) {
+		case DPI_OCI_HTYPE_SVCCTX:
+			switch (attributeType) {
+				case DPI_OCI_ATTR_SERVER:
+					*(void**) attribute = h->server;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_SESSION:
+					*(void**) attribute = h->session;
+					return DPI_OCI_SUCCESS;
+			}
+			break;
+		case DPI_OCI_HTYPE_SERVER:
+			switch (attributeType) {
+				case DPI_OCI_ATTR_SERVER_STATUS:
+					*(uint32_t*) attribute = 1; // OCI_SERVER_NORMAL
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_CHARSET_ID:
+				case DPI_OCI_ATTR_NCHARSET_ID:
+					*(uint16_t*) attribute = DPI_CHARSET_ID_UTF8;
+					return DPI_OCI_SUCCESS;
+			}
+			break;
+		case DPI_OCI_HTYPE_SESSION:
+			switch (attributeType) {
+				case DPI_OCI_ATTR_TRANSACTION_IN_PROGRESS:
+					*(int*) attribute = 0;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_MAX_IDENTIFIER_LEN:
+					*(uint32_t*) attribute = 128;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_MAX_OPEN_CURSORS:
+					*(uint32_t*) attribute = 300;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_CURRENT_SCHEMA:
+				case DPI_OCI_ATTR_EDITION:
+				case DPI_OCI_ATTR_DBDOMAIN:
+				case DPI_OCI_ATTR_DBNAME:
+				case DPI_OCI_ATTR_SERVICENAME:
+				case DPI_OCI_ATTR_INSTNAME:
+				case DPI_OCI_ATTR_LTXID:
+					godrorMockString(attribute, size, "", 0);
+					return DPI_OCI_SUCCESS;
+			}
+			break;
+		case DPI_OCI_HTYPE_STMT:
+			switch (attributeType) {
+				case DPI_OCI_ATTR_STMT_TYPE:
+					*(uint16_t*) attribute = h->statementType;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_PARAM_COUNT:
+					*(uint32_t*) attribute = h->query ? h->query->numColumns : 0;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_ROWS_FETCHED:
+					*(uint32_t*) attribute = h->rowsFetched;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_ROW_COUNT:
+					*(uint32_t*) attribute = (uint32_t) h->rowCount;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_UB8_ROW_COUNT:
+					*(uint64_t*) attribute = h->rowCount;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_BIND_COUNT:
+					*(uint32_t*) attribute = h->numBinds;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_NUM_DML_ERRORS:
+					*(uint32_t*) attribute = 0;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_STMT_IS_RETURNING:
+					*(uint8_t*) attribute = 0;
+					return DPI_OCI_SUCCESS;
+			}
+			break;
+		case DPI_OCI_HTYPE_DESCRIBE:
+		case DPI_OCI_DTYPE_PARAM:
+			column = h->column;
+			switch (attributeType) {
+				case DPI_OCI_ATTR_NAME:
+					godrorMockString(attribute, size, column->name,
+							column->nameLength);
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_DATA_TYPE:
+					*(uint16_t*) attribute = column->dataType;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_DATA_SIZE:
+					*(uint16_t*) attribute = (uint16_t) column->size;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_CHAR_SIZE:
+					*(uint16_t*) attribute =
+							(column->dataType == DPI_SQLT_CHR ||
+							column->dataType == DPI_SQLT_AFC) ?
+							(uint16_t) column->size : 0;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_PRECISION:
+					*(int16_t*) attribute = column->precision;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_SCALE:
+					*(int8_t*) attribute = column->scale;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_IS_NULL:
+					*(uint8_t*) attribute = 1;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_CHARSET_FORM:
+					*(uint8_t*) attribute = DPI_SQLCS_IMPLICIT;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_JSON_COL:
+				case DPI_OCI_ATTR_OSON_COL:
+					*(uint8_t*) attribute = 0;
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_TYPE_NAME:
+				case DPI_OCI_ATTR_SCHEMA_NAME:
+				case DPI_OCI_ATTR_DOMAIN_SCHEMA:
+				case DPI_OCI_ATTR_DOMAIN_NAME:
+					godrorMockString(attribute, size, "", 0);
+					return DPI_OCI_SUCCESS;
+				case DPI_OCI_ATTR_NUM_ANNOTATIONS:
+					*(uint16_t*) attribute = 0;
+					return DPI_OCI_SUCCESS;
+			}
+			break;
+	}
+	snprintf(message, sizeof(message),
+			"attribute %u of handle type %u is not mocked", attributeType,
+			handleType);
+	return godrorMockError(errhp, 24315, message);
+}
+
+static int godrorMockAttrSet(void *handle, uint32_t handleType,
+		void *attribute, uint32_t size, uint32_t attributeType, void *errhp) {
+	godrorMockHandle *h = handle;
+
+	if (handleType == DPI_OCI_HTYPE_SVCCTX) {
+		switch (attributeType) {
+			case DPI_OCI_ATTR_SERVER:
+				h->server = attribute;
+				break;
+			case DPI_OCI_ATTR_SESSION:
+				h->session = attribute;
+				break;
+		}
+	}
+	return DPI_OCI_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+// godrorMockOCIAllocations returns the number of allocations of ODPI-C.
+//-----------------------------------------------------------------------------
+uint32_t godrorMockOCIAllocations(void) {
+	return dpiAtomic__load(&dpiUtils__numAllocations);
+}
+
+//-----------------------------------------------------------------------------
+// godrorMockOCIAllocatedBytes returns the number of bytes allocated by
+// ODPI-C, wrapping around.
+//-----------------------------------------------------------------------------
+uint32_t godrorMockOCIAllocatedBytes(void) {
+	return dpiAtomic__load(&dpiUtils__allocatedBytes);
+}
+
+//-----------------------------------------------------------------------------
+// godrorMockOCISymbol returns the mocked function of name, or NULL.
+//-----------------------------------------------------------------------------
+void *godrorMockOCISymbol(const char *name) {
+	static const struct {
+		const char *name;
+		void *fn;
+	} symbols[] = {
+		{"OCIAttrGet", (void*) godrorMockAttrGet},
+		{"OCIAttrSet", (void*) godrorMockAttrSet},
+		{"OCIBindByName2", (void*) godrorMockBindByName2},
+		{"OCIBindByPos2", (void*) godrorMockBindByPos2},
+		{"OCIBreak", (void*) godrorMockBreak},
+		{"OCIClientVersion", (void*) godrorMockClientVersion},
+		{"OCIContextGetValue", (void*) godrorMockContextGetValue},
+		{"OCIContextSetValue", (void*) godrorMockContextSetValue},
+		{"OCIDefineByPos2", (void*) godrorMockDefineByPos2},
+		{"OCIDefineDynamic", (void*) godrorMockDefineDynamic},
+		{"OCIDescriptorAlloc", (void*) godrorMockDescriptorAlloc},
+		{"OCIDescriptorFree", (void*) godrorMockDescriptorFree},
+		{"OCIEnvNlsCreate", (void*) godrorMockEnvNlsCreate},
+		{"OCIErrorGet", (void*) godrorMockErrorGet},
+		{"OCIHandleAlloc", (void*) godrorMockHandleAlloc},
+		{"OCIHandleFree", (void*) godrorMockHandleFree},
+		{"OCILobFreeTemporary", (void*) godrorMockLobFreeTemporary},
+		{"OCILobGetChunkSize", (void*) godrorMockLobGetChunkSize},
+		{"OCILobGetLength2", (void*) godrorMockLobGetLength2},
+		{"OCILobIsTemporary", (void*) godrorMockLobIsTemporary},
+		{"OCILobRead2", (void*) godrorMockLobRead2},
+		{"OCIMemoryAlloc", (void*) godrorMockMemoryAlloc},
+		{"OCIMemoryFree", (void*) godrorMockMemoryFree},
+		{"OCINlsCharSetIdToName", (void*) godrorMockNlsCharSetIdToName},
+		{"OCINlsCharSetNameToId", (void*) godrorMockNlsCharSetNameToId},
+		{"OCINlsEnvironmentVariableGet",
+				(void*) godrorMockNlsEnvironmentVariableGet},
+		{"OCINlsNameMap", (void*) godrorMockNlsNameMap},
+		{"OCINlsNumericInfoGet", (void*) godrorMockNlsNumericInfoGet},
+		{"OCINumberFromInt", (void*) godrorMockNumberFromInt},
+		{"OCINumberFromReal", (void*) godrorMockNumberFromReal},
+		{"OCINumberToInt", (void*) godrorMockNumberToInt},
+		{"OCINumberToReal", (void*) godrorMockNumberToReal},
+		{"OCIParamGet", (void*) godrorMockParamGet},
+		{"OCIPing", (void*) godrorMockPing},
+		{"OCIServerAttach", (void*) godrorMockServerAttach},
+		{"OCIServerDetach", (void*) godrorMockServerDetach},
+		{"OCIServerRelease", (void*) godrorMockServerRelease},
+		{"OCIServerRelease2", (void*) godrorMockServerRelease2},
+		{"OCISessionBegin", (void*) godrorMockSessionBegin},
+		{"OCISessionEnd", (void*) godrorMockSessionEnd},
+		{"OCISessionGet", (void*) godrorMockSessionGet},
+		{"OCISessionRelease", (void*) godrorMockSessionRelease},
+		{"OCIStmtExecute", (void*) godrorMockStmtExecute},
+		{"OCIStmtFetch2", (void*) godrorMockStmtFetch2},
+		{"OCIStmtGetBindInfo", (void*) godrorMockStmtGetBindInfo},
+		{"OCIStmtGetNextResult", (void*) godrorMockStmtGetNextResult},
+		{"OCIStmtPrepare2", (void*) godrorMockStmtPrepare2},
+		{"OCIStmtRelease", (void*) godrorMockStmtRelease},
+		{"OCIThreadKeyDestroy", (void*) godrorMockThreadKeyDestroy},
+		{"OCIThreadKeyGet", (void*) godrorMockThreadKeyGet},
+		{"OCIThreadKeyInit", (void*) godrorMockThreadKeyInit},
+		{"OCIThreadKeySet", (void*) godrorMockThreadKeySet},
+		{"OCIThreadProcessInit", (void*) godrorMockThreadProcessInit},
+		{"OCITransCommit", (void*) godrorMockTransCommit},
+		{"OCITransRollback", (void*) godrorMockTransRollback},
+	};
+	size_t i;
+
+	for (i = 0; i < sizeof(symbols) / sizeof(symbols[0]); i++) {
+		if (strcmp(symbols[i].name, name) == 0)
+			return symbols[i].fn;
+	}
+	return NULL;
+}
@@ -0,0 +1,78 @@
+//go:build godror_mockoci
+
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#cgo CFLAGS: -DDPI_MOCK_OCI
+#include <stdlib.h>
+#include "dpiImpl.h"
+#include "mockoci.h"
+*/
+import "C"
+import "unsafe"
+
+// MockType is the (describe) data type of a MockColumn.
+type MockType uint16
+
+const (
+	// MockVarchar is VARCHAR2, with the "row <row> column <column>" value.
+	MockVarchar = MockType(C.DPI_SQLT_CHR)
+	// MockNumber is NUMBER, with the row+column value
+	// (and a fraction of 5 if Scale is not zero).
+	MockNumber = MockType(C.DPI_SQLT_NUM)
+	// MockBinaryDouble is BINARY_DOUBLE, with the row+column+0.5 value.
+	MockBinaryDouble = MockType(C.DPI_SQLT_IBDOUBLE)
+	// MockLong is LONG, Size bytes of a letter of the row, fetched piecewise (as CLOBs read as string).
+	MockLong = MockType(C.DPI_SQLT_LNG)
+	// MockClob is CLOB, and MockBlob is BLOB, with the value of MockLong, read from the LOB locator.
+	MockClob = MockType(C.DPI_SQLT_CLOB)
+	MockBlob = MockType(C.DPI_SQLT_BLOB)
+)
+
+// MockColumn is a column of a query registered with MockQuery.
+type MockColumn struct {
+	Name             string
+	Type             MockType
+	Size             int
+	Precision, Scale int
+	// Cardinality is the number of distinct values (of the first rows), zero means all distinct.
+	Cardinality int
+}
+
+// MockQuery registers the result of qry for the mock OCI library:
+// rows rows of the columns, the values generated from the row and column index.
+// Registering the same qry again replaces its result.
+//
+// With the godror_mockoci build tag, the driver does not load the Oracle Client library,
+// but uses an in-memory mock of it, which needs no database: the queries return
+// the rows registered with MockQuery, and the other statements succeed without doing anything.
+// This is for benchmarking and profiling the driver itself (not for testing it), as
+//
+//	DO_NOT_CONNECT=1 go test -tags godror_mockoci -run=^$ -bench=Mock -benchmem
+//
+// The mock supports standalone connections only (standaloneConnection=1),
+// with a fixed timezone (timezone=UTC), as it cannot answer the timezone query.
+func MockQuery(qry string, rows int, columns ...MockColumn) {
+	cQry := C.CString(qry)
+	q := C.godrorMockOCIQuery(cQry, C.uint32_t(len(qry)), C.uint64_t(rows))
+	C.free(unsafe.Pointer(cQry))
+	for _, col := range columns {
+		cName := C.CString(col.Name)
+		C.godrorMockOCIColumn(q, cName, C.uint32_t(len(col.Name)), C.uint16_t(col.Type),
+			C.uint32_t(col.Size), C.int16_t(col.Precision), C.int8_t(col.Scale), C.uint64_t(col.Cardinality))
+		C.free(unsafe.Pointer(cName))
+	}
+}
+
+// MockAllocations returns the number of memory allocations ODPI-C has made,
+// for checking the allocations of the fetch path in the benchmarks.
+func MockAllocations() int { return int(C.godrorMockOCIAllocations()) }
+
+// MockAllocatedBytes returns the number of bytes ODPI-C has allocated, wrapping around
+// (so only the difference of two calls is meaningful).
+func MockAllocatedBytes() uint32 { return uint32(C.godrorMockOCIAllocatedBytes()) }
@@ -0,0 +1,33 @@
+//go:build godror_mockoci
+
+#ifndef GODROR_MOCKOCI
+#define GODROR_MOCKOCI
+
+#include <stdint.h>
+
+typedef struct godrorMockQuery godrorMockQuery;
+
+// godrorMockOCISymbol returns the implementation of the named OCI function,
+// or NULL if it is not mocked.
+void *godrorMockOCISymbol(const char *name);
+
+// godrorMockOCIQuery registers (or replaces) the synthetic result of the sql
+// statement: numRows rows of the columns added with godrorMockOCIColumn.
+godrorMockQuery *godrorMockOCIQuery(const char *sql, uint32_t sqlLength,
+		uint64_t numRows);
+
+// godrorMockOCIColumn adds a column of the (Oracle, SQLT_*) dataType to q,
+// with the values repeating after cardinality rows (if not zero).
+void godrorMockOCIColumn(godrorMockQuery *q, const char *name,
+		uint32_t nameLength, uint16_t dataType, uint32_t size,
+		int16_t precision, int8_t scale, uint64_t cardinality);
+
+// godrorMockOCIAllocations returns the number of memory allocations ODPI-C
+// has made.
+uint32_t godrorMockOCIAllocations(void);
+
+// godrorMockOCIAllocatedBytes returns the number of bytes ODPI-C has
+// allocated, wrapping around.
+uint32_t godrorMockOCIAllocatedBytes(void);
+
+#endif
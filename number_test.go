@@ -6,7 +6,10 @@
 package godror_test
 
 import (
+	"context"
+	"strings"
 	"testing"
+	"time"
 
 	godror "github.com/godror/godror"
 )
@@ -42,3 +45,49 @@ func TestNumberDeCompose(t *testing.T) {
 		}
 	}
 }
+
+func TestNumberAsText(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("NumberAsText"), 30*time.Second)
+	defer cancel()
+	for i, tc := range []struct {
+		Literal, Want string
+	}{
+		{"0", "0"},
+		{"1", "1"},
+		{"-1", "-1"},
+		{"7", "7"},
+		{"10", "10"},
+		{"-10", "-10"},
+		{"100", "100"},
+		{"1200", "1200"},
+		{"-1234567", "-1234567"},
+		{"0.5", "0.5"},
+		{"-0.5", "-0.5"},
+		{"0.05", "0.05"},
+		{"0.1", "0.1"},
+		{"-0.01", "-0.01"},
+		{"1.5", "1.5"},
+		{"10.5", "10.5"},
+		{"99.99", "99.99"},
+		{"1.01", "1.01"},
+		{"123.456", "123.456"},
+		{"-123.456", "-123.456"},
+		{"3.14159265358979", "3.14159265358979"},
+		{"0.0000000001", "0.0000000001"},
+		{"-9.87654321e-10", "-0.000000000987654321"},
+		{"1e30", "1" + strings.Repeat("0", 30)},
+		{"-1e-30", "-0." + strings.Repeat("0", 29) + "1"},
+		{"12345678901234567890123456789012345678", "12345678901234567890123456789012345678"},
+		{"-1234567890123456789.0123456789", "-1234567890123456789.0123456789"},
+	} {
+		qry := "SELECT " + tc.Literal + " FROM DUAL"
+		var s string
+		if err := testDb.QueryRowContext(ctx, qry, godror.NumberAsString()).Scan(&s); err != nil {
+			t.Fatalf("%d. %s: %+v", i, qry, err)
+		}
+		if s != tc.Want {
+			t.Errorf("%d. %s: got %q, wanted %q", i, tc.Literal, s, tc.Want)
+		}
+	}
+}
@@ -25,6 +25,7 @@ import (
 	"sort"
 	"strings"
 	"sync"
+	"sync/atomic"
 	"time"
 	"unsafe"
 
@@ -42,6 +43,9 @@ var _ = fmt.Printf
 type Object struct {
 	dpiObject *C.dpiObject
 	*ObjectType
+	// sharedType is true when ObjectType is the cached one of the connection,
+	// referenced for this Object (see wrapObject).
+	sharedType bool
 }
 
 // ErrNoSuchKey is the error for missing key in lookup.
@@ -267,6 +271,10 @@ func (O *Object) Close() error {
 	if err := O.drv.checkExec(func() C.int { return C.dpiObject_release(obj) }); err != nil {
 		return fmt.Errorf("error on close object: %w", err)
 	}
+	if O.sharedType {
+		O.sharedType = false
+		return O.ObjectType.Close()
+	}
 
 	return nil
 }
@@ -281,12 +289,13 @@ func (O *Object) AsMap(recursive bool) (map[string]interface{}, error) {
 	}
 	logger := getLogger(context.TODO())
 	m := make(map[string]interface{}, len(O.ObjectType.Attributes))
-	data := scratch.Get()
-	defer scratch.Put(data)
-	for a, ot := range O.ObjectType.Attributes {
-		if err := O.GetAttribute(data, a); err != nil {
-			return m, fmt.Errorf("%q: %w", a, err)
-		}
+	set := O.ObjectType.allAttributes()
+	values, err := set.get(O, nil)
+	if err != nil {
+		return m, err
+	}
+	for i := range values {
+		data, ot, a := &values[i], set.attrs[i], set.attrs[i].Name
 		d := data.Get()
 		if d == nil {
 			continue
@@ -399,15 +408,13 @@ var ErrNotExist = errors.New("not exist")
 //
 // This is horrendously inefficient, use it only as a guide!
 func (O ObjectCollection) AsMapSlice(recursive bool) ([]map[string]interface{}, error) {
-	length, err := O.Len()
+	items, err := O.GetItems(nil)
 	if err != nil {
-		return nil, fmt.Errorf("Len: %w", err)
+		return nil, fmt.Errorf("GetItems: %w", err)
 	}
-	m := make([]map[string]interface{}, 0, length)
-	for curr, err := O.First(); err == nil; curr, err = O.Next(curr) {
-		if v, err := O.Get(curr); err != nil {
-			return m, fmt.Errorf("Get(%v): %w", curr, err)
-		} else if v == nil {
+	m := make([]map[string]interface{}, 0, len(items))
+	for curr := range items {
+		if v := items[curr].Get(); v == nil {
 			m = append(m, nil)
 		} else if o, ok := v.(*Object); ok {
 			r, err := o.AsMap(recursive)
@@ -421,10 +428,15 @@ func (O ObjectCollection) AsMapSlice(recursive bool) ([]map[string]interface{},
 }
 
 // FromSlice read from a slice of primitives.
+//
+// Slices of only integers, float64s, strings or []bytes are appended with one call.
 func (O ObjectCollection) FromSlice(v []interface{}) error {
 	if O.dpiObject == nil {
 		return nil
 	}
+	if ok, err := O.appendSlice(v); ok {
+		return err
+	}
 	logger := getLogger(context.TODO())
 
 	data := scratch.Get()
@@ -678,15 +690,12 @@ func (O ObjectCollection) AsSlice(dest interface{}) (interface{}, error) {
 	if !needsInit {
 		dr = reflect.ValueOf(dest)
 	}
-	d := scratch.Get()
-	defer scratch.Put(d)
-	for i, err := O.First(); err == nil; i, err = O.Next(i) {
-		if O.CollectionOf.IsObject() {
-			d.ObjectType = O.CollectionOf
-		}
-		if err = O.GetItem(d, i); err != nil {
-			return dest, err
-		}
+	items, err := O.GetItems(nil)
+	if err != nil {
+		return dest, err
+	}
+	for i := range items {
+		d := &items[i]
 		v := d.Get()
 		if !d.IsObject() {
 			v = maybeString(v, O.CollectionOf)
@@ -694,11 +703,7 @@ func (O ObjectCollection) AsSlice(dest interface{}) (interface{}, error) {
 		vr := reflect.ValueOf(v)
 		if needsInit {
 			needsInit = false
-			length, lengthErr := O.Len()
-			if lengthErr != nil {
-				return dr.Interface(), lengthErr
-			}
-			dr = reflect.MakeSlice(reflect.SliceOf(vr.Type()), 0, length)
+			dr = reflect.MakeSlice(reflect.SliceOf(vr.Type()), 0, len(items))
 		}
 		dr = reflect.Append(dr, vr)
 	}
@@ -925,6 +930,12 @@ type ObjectType struct {
 	OracleTypeNum                       C.dpiOracleTypeNum
 	NativeTypeNum                       C.dpiNativeTypeNum
 	DomainAnnotation
+	// attrSet and structMaps are the cached precompiled attribute sets (see objbulk.go).
+	attrSet    atomic.Pointer[attrSet]
+	structMaps sync.Map
+	// refs is the number of ObjectAttributes and collections sharing this ObjectType,
+	// besides its first owner (see sharedObjectType).
+	refs        atomic.Int32
 	Precision   int16
 	Scale       int8
 	FsPrecision uint8
@@ -946,16 +957,20 @@ func (t *ObjectType) String() string {
 	if t == nil {
 		return ""
 	}
-	if t.Schema == "" {
-		if t.PackageName == "" {
-			return t.Name
+	return objectTypeName(t.Schema, t.PackageName, t.Name)
+}
+
+func objectTypeName(schema, packageName, name string) string {
+	if schema == "" {
+		if packageName == "" {
+			return name
 		}
-		return t.PackageName + "." + t.Name
+		return packageName + "." + name
 	}
-	if t.PackageName == "" {
-		return t.Schema + "." + t.Name
+	if packageName == "" {
+		return schema + "." + name
 	}
-	return t.Schema + "." + t.PackageName + "." + t.Name
+	return schema + "." + packageName + "." + name
 }
 
 func (t *ObjectType) IsObject() bool { return t != nil && t.NativeTypeNum == C.DPI_NATIVE_TYPE_OBJECT }
@@ -1092,6 +1107,9 @@ func (t *ObjectType) Close() error {
 	if t == nil {
 		return nil
 	}
+	if t.refs.Add(-1) >= 0 { // still shared
+		return nil
+	}
 	//var a [4096]byte
 	//stack := a[:runtime.Stack(a[:], false)]
 	//fmt.Printf("ObjectType %p[%q].Close(): %s\n", t, t.Name, stack)
@@ -1135,13 +1153,18 @@ func wrapObject(c *conn, objectType *C.dpiObjectType, object *C.dpiObject) (*Obj
 	if err := c.checkExec(func() C.int { return C.dpiObject_addRef(object) }); err != nil {
 		return nil, err
 	}
+	c.mu.RLock()
+	defer c.mu.RUnlock()
+	// each Object holds a reference to the cached ObjectType, released by Close
+	if t := sharedObjectType(objectType, c.objTypes); t != nil {
+		t.refs.Add(1)
+		return &Object{ObjectType: t, dpiObject: object, sharedType: true}, nil
+	}
 	o := &Object{
 		ObjectType: &ObjectType{dpiObjectType: objectType, drv: c.drv},
 		dpiObject:  object,
 	}
-	c.mu.RLock()
 	err := o.ObjectType.init(c.objTypes)
-	c.mu.RUnlock()
 	if err != nil {
 		_ = o.Close()
 		return nil, err
@@ -1176,15 +1199,16 @@ func (t *ObjectType) init(cache map[string]*ObjectType) error {
 	t.CollectionOf = nil
 
 	if info.isCollection == 1 {
-		t.CollectionOf = &ObjectType{drv: t.drv}
-		if err := t.CollectionOf.fromDataTypeInfo(info.elementTypeInfo, cache); err != nil {
+		cof, shared, err := objectTypeFromDataTypeInfo(t.drv, info.elementTypeInfo, cache)
+		t.CollectionOf = cof
+		if err != nil {
 			return err
 		}
 		if t.CollectionOf.Name == "" {
 			t.CollectionOf.Schema = t.Schema
 			t.CollectionOf.Name = t.Name
 		}
-		if t.CollectionOf.dpiObjectType != nil {
+		if t.CollectionOf.dpiObjectType != nil && !shared {
 			C.dpiObjectType_addRef(t.CollectionOf.dpiObjectType)
 		}
 	}
@@ -1226,7 +1250,7 @@ func (t *ObjectType) init(cache map[string]*ObjectType) error {
 		}
 
 		typ := attrInfo.typeInfo
-		sub, err := objectTypeFromDataTypeInfo(t.drv, typ, cache)
+		sub, shared, err := objectTypeFromDataTypeInfo(t.drv, typ, cache)
 		if err != nil {
 			return err
 		}
@@ -1236,7 +1260,7 @@ func (t *ObjectType) init(cache map[string]*ObjectType) error {
 			ObjectType:    sub,
 			Sequence:      uint32(i),
 		}
-		if sub.dpiObjectType != nil {
+		if sub.dpiObjectType != nil && !shared {
 			C.dpiObjectType_addRef(sub.dpiObjectType)
 		}
 		//fmt.Printf("%d=%q. typ=%+v sub=%+v\n", i, objAttr.Name, typ, sub)
@@ -1274,16 +1298,52 @@ func (t *ObjectType) fromDataTypeInfo(typ C.dpiDataTypeInfo, cache map[string]*O
 	return t.init(cache)
 }
 
-func objectTypeFromDataTypeInfo(d *drv, typ C.dpiDataTypeInfo, cache map[string]*ObjectType) (*ObjectType, error) {
+// objectTypeFromDataTypeInfo returns the ObjectType of typ,
+// and whether it is an already described one of cache, shared.
+func objectTypeFromDataTypeInfo(d *drv, typ C.dpiDataTypeInfo, cache map[string]*ObjectType) (*ObjectType, bool, error) {
 	if d == nil {
 		panic("drv is nil")
 	}
 	if typ.oracleTypeNum == 0 {
 		panic("typ is nil")
 	}
+	if typ.objectType != nil {
+		if t := sharedObjectType(typ.objectType, cache); t != nil {
+			t.refs.Add(1)
+			return t, true, nil
+		}
+	}
 	t := &ObjectType{drv: d}
 	err := t.fromDataTypeInfo(typ, cache)
-	return t, err
+	return t, false, err
+}
+
+// sharedObjectType returns the live ObjectType of cache with the same name as ot, if any,
+// so the same type is described only once per connection,
+// not for each attribute, collection or fetched object of it.
+func sharedObjectType(ot *C.dpiObjectType, cache map[string]*ObjectType) *ObjectType {
+	if len(cache) == 0 {
+		return nil
+	}
+	var info C.dpiObjectTypeInfo
+	if C.dpiObjectType_getInfo(ot, &info) == C.DPI_FAILURE {
+		return nil
+	}
+	t := cache[objectTypeName(
+		C.GoStringN(info.schema, C.int(info.schemaLength)),
+		C.GoStringN(info.packageName, C.int(info.packageNameLength)),
+		C.GoStringN(info.name, C.int(info.nameLength)),
+	)]
+	if t == nil {
+		return nil
+	}
+	t.mu.RLock()
+	live := t.drv != nil && t.dpiObjectType != nil && t.Attributes != nil
+	t.mu.RUnlock()
+	if !live {
+		return nil
+	}
+	return t
 }
 
 // ObjectAttribute is an attribute of an Object.
@@ -0,0 +1,425 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"fmt"
+	"reflect"
+	"runtime"
+	"strings"
+	"unsafe"
+)
+
+// numberBufSize is the size of the buffer for a NUMBER got as bytes.
+const numberBufSize = 39
+
+// attrSet is a precompiled set of attributes of an ObjectType, to get them with one call.
+type attrSet struct {
+	attrs   []ObjectAttribute
+	handles []*C.dpiObjectAttr
+	natives []C.dpiNativeTypeNum
+	// numbers is the number of NUMBERs got as bytes.
+	numbers int
+}
+
+func newAttrSet(attrs []ObjectAttribute) *attrSet {
+	s := attrSet{
+		attrs:   attrs,
+		handles: make([]*C.dpiObjectAttr, len(attrs)),
+		natives: make([]C.dpiNativeTypeNum, len(attrs)),
+	}
+	for i, a := range attrs {
+		s.handles[i], s.natives[i] = a.dpiObjectAttr, a.NativeTypeNum
+		if needsNumberBuf(a.ObjectType) {
+			s.numbers++
+		}
+	}
+	return &s
+}
+
+// needsNumberBuf reports whether the values of ot are NUMBERs got as bytes,
+// for which the buffer must be supplied.
+func needsNumberBuf(ot *ObjectType) bool {
+	return ot != nil && ot.NativeTypeNum == C.DPI_NATIVE_TYPE_BYTES && ot.OracleTypeNum == C.DPI_ORACLE_TYPE_NUMBER
+}
+
+// bulkBuffers prepares n dpiData for getting values with one call:
+// the NUMBERs got as bytes (isNumber) get their part of one buffer, pinned with pinner.
+func bulkBuffers(n, numbers int, pinner *runtime.Pinner, isNumber func(int) bool) ([]C.dpiData, []byte) {
+	data := make([]C.dpiData, n)
+	if numbers == 0 {
+		return data, nil
+	}
+	buf := make([]byte, numbers*numberBufSize)
+	pinner.Pin(&buf[0])
+	var k int
+	for i := range data {
+		if !isNumber(i) {
+			continue
+		}
+		b := (*C.dpiBytes)(unsafe.Pointer(&data[i].value))
+		b.ptr, b.length = (*C.char)(unsafe.Pointer(&buf[k*numberBufSize])), numberBufSize
+		k++
+	}
+	return data, buf
+}
+
+// get the attributes of the set of O into dest (resized to the number of attributes), with one call.
+func (s *attrSet) get(O *Object, dest []Data) ([]Data, error) {
+	dest = resize(dest, len(s.attrs))
+	for i, a := range s.attrs {
+		d := &dest[i]
+		d.reset()
+		d.NativeTypeNum, d.ObjectType, d.implicitObj = a.NativeTypeNum, a.ObjectType, true
+	}
+	if len(s.attrs) == 0 {
+		return dest, nil
+	}
+	if O.dpiObject == nil {
+		return dest, nil
+	}
+
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	data, buf := bulkBuffers(len(s.attrs), s.numbers, &pinner, func(i int) bool { return needsNumberBuf(s.attrs[i].ObjectType) })
+	if err := O.drv.checkExec(func() C.int {
+		return C.dpiObject_getAttributeValues(O.dpiObject, C.uint32_t(len(s.attrs)), &s.handles[0], &s.natives[0], &data[0])
+	}); err != nil {
+		return dest, fmt.Errorf("getAttributeValues(obj=%s, attrs=%d): %w", O.Name, len(s.attrs), err)
+	}
+	for i := range dest {
+		dest[i].dpiData, dest[i].buf = data[i], buf
+	}
+	return dest, nil
+}
+
+// releaseObjects releases the objects of the values got with one call, which are not used
+// (as after a conversion error): their Get would return an *Object that must be closed.
+func releaseObjects(values []Data) {
+	for i := range values {
+		d := &values[i]
+		if !d.implicitObj || d.NativeTypeNum != C.DPI_NATIVE_TYPE_OBJECT || d.IsNull() {
+			continue
+		}
+		if o := C.dpiData_getObject(&d.dpiData); o != nil {
+			C.dpiObject_release(o)
+		}
+	}
+}
+
+// allAttributes returns the attrSet of all the attributes of t, in AttributeNames order.
+func (t *ObjectType) allAttributes() *attrSet {
+	if s := t.attrSet.Load(); s != nil {
+		return s
+	}
+	names := t.AttributeNames()
+	attrs := make([]ObjectAttribute, len(names))
+	for i, nm := range names {
+		attrs[i] = t.Attributes[nm]
+	}
+	s := newAttrSet(attrs)
+	t.attrSet.Store(s)
+	return s
+}
+
+// GetAttributes gets all the attributes of the Object (in AttributeNames order) into dest
+// (resized as needed) with one call, and returns dest.
+func (O *Object) GetAttributes(dest []Data) ([]Data, error) {
+	if O == nil {
+		panic("nil Object")
+	}
+	return O.ObjectType.allAttributes().get(O, dest)
+}
+
+// GetItems gets all the elements of the collection (in index order) into dest
+// (resized as needed) with one call, and returns dest.
+func (O ObjectCollection) GetItems(dest []Data) ([]Data, error) {
+	length, err := O.Len()
+	if err != nil || length == 0 {
+		return dest[:0], err
+	}
+	ot := O.CollectionOf
+	var numbers int
+	if needsNumberBuf(ot) {
+		numbers = length
+	}
+
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	data, buf := bulkBuffers(length, numbers, &pinner, func(int) bool { return true })
+	var n C.uint32_t
+	if err = O.drv.checkExec(func() C.int {
+		return C.dpiObject_getElementValues(O.dpiObject, ot.NativeTypeNum, C.uint32_t(length), &data[0], &n)
+	}); err != nil {
+		return dest[:0], fmt.Errorf("getElementValues(%d): %w", length, err)
+	}
+	dest = resize(dest, int(n))
+	for i := range dest {
+		dest[i] = Data{
+			ObjectType: ot, NativeTypeNum: ot.NativeTypeNum, implicitObj: true,
+			dpiData: data[i], buf: buf,
+		}
+	}
+	return dest, nil
+}
+
+// structMapping maps the fields of a struct type to the attributes of an ObjectType.
+type structMapping struct {
+	set    *attrSet
+	fields []structField
+}
+
+type structField struct {
+	reflect.StructField
+	name, fieldTag string
+}
+
+// structMapping returns the (cached) mapping of the fields of the struct type rt to the attributes of t.
+func (t *ObjectType) structMapping(rt reflect.Type) (*structMapping, error) {
+	if sm, ok := t.structMaps.Load(rt); ok {
+		return sm.(*structMapping), nil
+	}
+	var sm structMapping
+	var attrs []ObjectAttribute
+	for i, n := 0, rt.NumField(); i < n; i++ {
+		f := rt.Field(i)
+		if !f.IsExported() || fieldIsObjectTypeName(f) {
+			continue
+		}
+		nm, typ, _ := parseStructTag(f.Tag)
+		if nm == "-" {
+			continue
+		}
+		fieldTag := typ
+		if fieldTag == "" {
+			fieldTag = nm
+		}
+		if nm == "" {
+			nm = strings.ToUpper(f.Name)
+		}
+		attr, ok := t.Attributes[nm]
+		if !ok {
+			return nil, fmt.Errorf("GetAttribute(%q): get %s[%s]: %w (have: %q)", nm, t.Name, nm, ErrNoSuchKey, t.AttributeNames())
+		}
+		attrs = append(attrs, attr)
+		sm.fields = append(sm.fields, structField{StructField: f, name: nm, fieldTag: fieldTag})
+	}
+	sm.set = newAttrSet(attrs)
+	actual, _ := t.structMaps.LoadOrStore(rt, &sm)
+	return actual.(*structMapping), nil
+}
+
+// GetInt64s gets all the elements of the numeric collection (in index order)
+// into dest (resized as needed), as one contiguous array with one call, and returns dest.
+// NULL elements are returned as 0.
+func (O ObjectCollection) GetInt64s(dest []int64) ([]int64, error) {
+	return getElementArray(O, C.DPI_NATIVE_TYPE_INT64, dest)
+}
+
+// GetFloat64s gets all the elements of the numeric collection (in index order)
+// into dest (resized as needed), as one contiguous array with one call, and returns dest.
+// NULL elements are returned as 0.
+func (O ObjectCollection) GetFloat64s(dest []float64) ([]float64, error) {
+	return getElementArray(O, C.DPI_NATIVE_TYPE_DOUBLE, dest)
+}
+
+func getElementArray[T int64 | float64](O ObjectCollection, nativeTypeNum C.dpiNativeTypeNum, dest []T) ([]T, error) {
+	length, err := O.Len()
+	if err != nil || length == 0 {
+		return dest[:0], err
+	}
+	dest = resize(dest, length)
+	var n C.uint32_t
+	if err = O.drv.checkExec(func() C.int {
+		return C.dpiObject_getElementArray(O.dpiObject, nativeTypeNum, C.uint32_t(length), unsafe.Pointer(&dest[0]), nil, &n)
+	}); err != nil {
+		return dest[:0], fmt.Errorf("getElementArray(%d[%d]): %w", length, nativeTypeNum, err)
+	}
+	return dest[:n], nil
+}
+
+// GetStrings gets all the elements of the collection (in index order) into dest
+// (resized as needed) with one call, and returns dest.
+// The strings share one allocation; NULL elements are returned as "".
+func (O ObjectCollection) GetStrings(dest []string) ([]string, error) {
+	var all string
+	var offs []int
+	n, err := O.getBytes(func(buf []byte, offsets []int) {
+		all, offs = unsafe.String(unsafe.SliceData(buf), len(buf)), offsets
+	})
+	if err != nil || n == 0 {
+		return dest[:0], err
+	}
+	dest = resize(dest, n)
+	for i := range dest {
+		dest[i] = all[offs[i]:offs[i+1]]
+	}
+	return dest, nil
+}
+
+// GetByteSlices gets all the elements of the collection (in index order) into dest
+// (resized as needed) with one call, and returns dest.
+// The slices share one allocation; NULL elements are returned as nil.
+func (O ObjectCollection) GetByteSlices(dest [][]byte) ([][]byte, error) {
+	var all []byte
+	var offs []int
+	n, err := O.getBytes(func(buf []byte, offsets []int) { all, offs = buf, offsets })
+	if err != nil || n == 0 {
+		return dest[:0], err
+	}
+	dest = resize(dest, n)
+	for i := range dest {
+		if offs[i] == offs[i+1] {
+			dest[i] = nil
+		} else {
+			dest[i] = all[offs[i]:offs[i+1]:offs[i+1]]
+		}
+	}
+	return dest, nil
+}
+
+// getBytes gets all the elements as bytes, copied into one buffer,
+// and calls f with it and the offsets (len=n+1) of the elements in it.
+func (O ObjectCollection) getBytes(f func(buf []byte, offsets []int)) (int, error) {
+	items, err := O.GetItems(nil)
+	if err != nil || len(items) == 0 {
+		return 0, err
+	}
+	offsets := make([]int, len(items)+1)
+	for i := range items {
+		offsets[i+1] = offsets[i] + len(items[i].GetBytes())
+	}
+	buf := make([]byte, 0, offsets[len(items)])
+	for i := range items {
+		buf = append(buf, items[i].GetBytes()...)
+	}
+	f(buf, offsets)
+	return len(items), nil
+}
+
+// AppendInt64s appends the values to the collection with one call.
+func (O ObjectCollection) AppendInt64s(v []int64) error {
+	data := make([]C.dpiData, len(v))
+	for i, x := range v {
+		*((*int64)(unsafe.Pointer(&data[i].value))) = x
+	}
+	return O.appendElements(C.DPI_NATIVE_TYPE_INT64, data)
+}
+
+// AppendFloat64s appends the values to the collection with one call.
+func (O ObjectCollection) AppendFloat64s(v []float64) error {
+	data := make([]C.dpiData, len(v))
+	for i, x := range v {
+		*((*float64)(unsafe.Pointer(&data[i].value))) = x
+	}
+	return O.appendElements(C.DPI_NATIVE_TYPE_DOUBLE, data)
+}
+
+// AppendStrings appends the values to the collection with one call. The empty string is NULL.
+func (O ObjectCollection) AppendStrings(v []string) error {
+	return O.appendBytes(len(v), func(i int) []byte { return unsafe.Slice(unsafe.StringData(v[i]), len(v[i])) })
+}
+
+// AppendByteSlices appends the values to the collection with one call. An empty slice is NULL.
+func (O ObjectCollection) AppendByteSlices(v [][]byte) error {
+	return O.appendBytes(len(v), func(i int) []byte { return v[i] })
+}
+
+// appendBytes appends the n values returned by get, copied into one pinned buffer.
+func (O ObjectCollection) appendBytes(n int, get func(int) []byte) error {
+	var length int
+	for i := 0; i < n; i++ {
+		length += len(get(i))
+	}
+	data := make([]C.dpiData, n)
+	buf := make([]byte, 0, length)
+	var pinner runtime.Pinner
+	defer pinner.Unpin()
+	if length != 0 {
+		pinner.Pin(unsafe.SliceData(buf[:1]))
+	}
+	for i := range data {
+		b := get(i)
+		if len(b) == 0 {
+			data[i].isNull = 1
+			continue
+		}
+		start := len(buf)
+		buf = append(buf, b...)
+		db := (*C.dpiBytes)(unsafe.Pointer(&data[i].value))
+		db.ptr, db.length = (*C.char)(unsafe.Pointer(&buf[start])), C.uint32_t(len(b))
+	}
+	return O.appendElements(C.DPI_NATIVE_TYPE_BYTES, data)
+}
+
+func (O ObjectCollection) appendElements(nativeTypeNum C.dpiNativeTypeNum, data []C.dpiData) error {
+	if len(data) == 0 {
+		return nil
+	}
+	if err := O.drv.checkExec(func() C.int {
+		return C.dpiObject_appendElements(O.dpiObject, nativeTypeNum, C.uint32_t(len(data)), &data[0])
+	}); err != nil {
+		return fmt.Errorf("appendElements(%d[%d]): %w", len(data), nativeTypeNum, err)
+	}
+	return nil
+}
+
+// appendSlice appends v with one call, if all its elements are of the same
+// integer, float64, string or []byte type; and reports whether it did.
+func (O ObjectCollection) appendSlice(v []interface{}) (bool, error) {
+	if len(v) == 0 {
+		return false, nil
+	}
+	switch v[0].(type) {
+	case int, int32, int64:
+		ints := make([]int64, len(v))
+		for i, x := range v {
+			switch x := x.(type) {
+			case int:
+				ints[i] = int64(x)
+			case int32:
+				ints[i] = int64(x)
+			case int64:
+				ints[i] = x
+			default:
+				return false, nil
+			}
+		}
+		return true, O.AppendInt64s(ints)
+	case float64:
+		floats := make([]float64, len(v))
+		for i, x := range v {
+			f, ok := x.(float64)
+			if !ok {
+				return false, nil
+			}
+			floats[i] = f
+		}
+		return true, O.AppendFloat64s(floats)
+	case string:
+		for _, x := range v {
+			if _, ok := x.(string); !ok {
+				return false, nil
+			}
+		}
+		return true, O.appendBytes(len(v), func(i int) []byte {
+			s := v[i].(string)
+			return unsafe.Slice(unsafe.StringData(s), len(s))
+		})
+	case []byte:
+		for _, x := range v {
+			if _, ok := x.([]byte); !ok {
+				return false, nil
+			}
+		}
+		return true, O.appendBytes(len(v), func(i int) []byte { return v[i].([]byte) })
+	}
+	return false, nil
+}
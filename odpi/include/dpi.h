@@ -478,6 +478,7 @@ typedef struct dpiSubscrMessage dpiSubscrMessage;
 typedef struct dpiSubscrMessageQuery dpiSubscrMessageQuery;
 typedef struct dpiSubscrMessageRow dpiSubscrMessageRow;
 typedef struct dpiSubscrMessageTable dpiSubscrMessageTable;
+typedef struct dpiVarArrays dpiVarArrays;
 typedef struct dpiVectorInfo dpiVectorInfo;
 typedef union dpiVectorDimensionBuffer dpiVectorDimensionBuffer;
 typedef struct dpiVersionInfo dpiVersionInfo;
@@ -540,6 +541,15 @@ typedef struct {
     dpiDataBuffer *elementValues;
 } dpiJsonArray;
 
+// structure used for navigating JSON values with dpiJson_getValueAtPath(); a
+// step is the field of an object with the given name or, if the name is NULL,
+// the element of an array at the given index
+typedef struct {
+    const char *name;
+    uint32_t nameLength;
+    uint32_t index;
+} dpiJsonPathStep;
+
 // structure used for transferring dates to/from ODPI-C
 typedef struct {
     int16_t year;
@@ -915,6 +925,14 @@ struct dpiSubscrMessageTable {
     uint32_t numRows;
 };
 
+// structure used for transferring the raw arrays of a compact variable
+struct dpiVarArrays {
+    void *values;
+    int16_t *indicators;
+    uint32_t *lengths;
+    uint32_t valueSize;
+};
+
 // structure used for transferring version information
 struct dpiVersionInfo {
     int versionNum;
@@ -1123,6 +1141,11 @@ DPI_EXPORT int dpiConn_getStmtCacheSize(dpiConn *conn, uint32_t *cacheSize);
 DPI_EXPORT int dpiConn_getTransactionInProgress(dpiConn *conn,
         int *txnInProgress);
 
+// create a new compact variable (without dpiData structures) for defining
+DPI_EXPORT int dpiConn_newCompactVar(dpiConn *conn,
+        dpiOracleTypeNum oracleTypeNum, dpiNativeTypeNum nativeTypeNum,
+        uint32_t maxArraySize, uint32_t size, int sizeIsBytes, dpiVar **var);
+
 // create a new dequeue options object and return it
 DPI_EXPORT int dpiConn_newDeqOptions(dpiConn *conn, dpiDeqOptions **options);
 
@@ -1482,6 +1505,10 @@ DPI_EXPORT int dpiJson_addRef(dpiJson *json);
 DPI_EXPORT int dpiJson_getValue(dpiJson *json, uint32_t options,
         dpiJsonNode **topNode);
 
+// return the node at the given path of the JSON value, decoding only it
+DPI_EXPORT int dpiJson_getValueAtPath(dpiJson *json, uint32_t options,
+        uint32_t numSteps, const dpiJsonPathStep *steps, dpiJsonNode **node);
+
 // release a reference to the JSON
 DPI_EXPORT int dpiJson_release(dpiJson *json);
 
@@ -1664,6 +1691,10 @@ DPI_EXPORT int dpiObject_addRef(dpiObject *obj);
 DPI_EXPORT int dpiObject_appendElement(dpiObject *obj,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// append the elements to the collection in one call
+DPI_EXPORT int dpiObject_appendElements(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, uint32_t numElements, dpiData *data);
+
 // copy the object and return the copied object
 DPI_EXPORT int dpiObject_copy(dpiObject *obj, dpiObject **copiedObj);
 
@@ -1674,6 +1705,17 @@ DPI_EXPORT int dpiObject_deleteElementByIndex(dpiObject *obj, int32_t index);
 DPI_EXPORT int dpiObject_getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// get the values of the specified attributes of an object in one call
+DPI_EXPORT int dpiObject_getAttributeValues(dpiObject *obj, uint32_t numAttrs,
+        dpiObjectAttr **attrs, const dpiNativeTypeNum *nativeTypeNums,
+        dpiData *data);
+
+// get the values of the elements of a collection (in index order) into a
+// contiguous array of native values in one call
+DPI_EXPORT int dpiObject_getElementArray(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxElements, void *values,
+        int8_t *nullIndicators, uint32_t *numElements);
+
 // return whether an element exists in a collection at the specified index
 DPI_EXPORT int dpiObject_getElementExistsByIndex(dpiObject *obj, int32_t index,
         int *exists);
@@ -1682,6 +1724,11 @@ DPI_EXPORT int dpiObject_getElementExistsByIndex(dpiObject *obj, int32_t index,
 DPI_EXPORT int dpiObject_getElementValueByIndex(dpiObject *obj, int32_t index,
         dpiNativeTypeNum nativeTypeNum, dpiData *value);
 
+// get the values of the elements of a collection (in index order) in one call
+DPI_EXPORT int dpiObject_getElementValues(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxElements, dpiData *data,
+        uint32_t *numElements);
+
 // return the first index used in a collection
 DPI_EXPORT int dpiObject_getFirstIndex(dpiObject *obj, int32_t *index,
         int *exists);
@@ -2271,6 +2318,9 @@ DPI_EXPORT int dpiVar_addRef(dpiVar *var);
 DPI_EXPORT int dpiVar_copyData(dpiVar *var, uint32_t pos, dpiVar *sourceVar,
         uint32_t sourcePos);
 
+// return the raw arrays of a compact variable
+DPI_EXPORT int dpiVar_getArrays(dpiVar *var, dpiVarArrays *arrays);
+
 // return the number of elements in a PL/SQL index-by table
 DPI_EXPORT int dpiVar_getNumElementsInArray(dpiVar *var,
         uint32_t *numElements);
@@ -2283,6 +2333,11 @@ DPI_EXPORT int dpiVar_getReturnedData(dpiVar *var, uint32_t pos,
 // return the size in bytes of the buffer used for fetching/binding
 DPI_EXPORT int dpiVar_getSizeInBytes(dpiVar *var, uint32_t *sizeInBytes);
 
+// get the vectors at the given positions into a contiguous buffer
+DPI_EXPORT int dpiVar_getVectorValues(dpiVar *var, uint32_t pos,
+        uint32_t numRows, uint8_t format, uint32_t numDimensions,
+        void *values);
+
 // release a reference to the variable
 DPI_EXPORT int dpiVar_release(dpiVar *var);
 
@@ -2312,6 +2367,11 @@ DPI_EXPORT int dpiVar_setFromVector(dpiVar *var, uint32_t pos,
 // set the number of elements in a PL/SQL index-by table
 DPI_EXPORT int dpiVar_setNumElementsInArray(dpiVar *var, uint32_t numElements);
 
+// set the values at the given positions from a contiguous buffer of vectors
+DPI_EXPORT int dpiVar_setVectorValues(dpiVar *var, uint32_t pos,
+        uint32_t numRows, uint8_t format, uint32_t numDimensions,
+        const void *values);
+
 //-----------------------------------------------------------------------------
 // Vector Methods (dpiVector)
 //-----------------------------------------------------------------------------
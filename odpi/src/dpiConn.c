@@ -164,16 +164,9 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
             obj = (dpiObject*) conn->objects->handles[i];
             if (!obj)
                 continue;
-            if (conn->env->threaded) {
-                dpiMutex__acquire(conn->env->mutex);
-                status = dpiGen__checkHandle(obj, DPI_HTYPE_OBJECT, NULL,
-                        NULL);
-                if (status == DPI_SUCCESS)
-                    obj->refCount += 1;
-                dpiMutex__release(conn->env->mutex);
-                if (status < 0)
-                    continue;
-            }
+            if (conn->env->threaded &&
+                    dpiGen__tryAddRef(obj, DPI_HTYPE_OBJECT) < 0)
+                continue;
             status = dpiObject__close(obj, propagateErrors, error);
             if (conn->env->threaded)
                 dpiGen__setRefCount(obj, error, -1);
@@ -192,15 +185,9 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
             stmt = (dpiStmt*) conn->openStmts->handles[i];
             if (!stmt)
                 continue;
-            if (conn->env->threaded) {
-                dpiMutex__acquire(conn->env->mutex);
-                status = dpiGen__checkHandle(stmt, DPI_HTYPE_STMT, NULL, NULL);
-                if (status == DPI_SUCCESS)
-                    stmt->refCount += 1;
-                dpiMutex__release(conn->env->mutex);
-                if (status < 0)
-                    continue;
-            }
+            if (conn->env->threaded &&
+                    dpiGen__tryAddRef(stmt, DPI_HTYPE_STMT) < 0)
+                continue;
             status = dpiStmt__close(stmt, NULL, 0, propagateErrors, error);
             if (conn->env->threaded)
                 dpiGen__setRefCount(stmt, error, -1);
@@ -218,15 +205,9 @@ static int dpiConn__close(dpiConn *conn, uint32_t mode, const char *tag,
             lob = (dpiLob*) conn->openLobs->handles[i];
             if (!lob)
                 continue;
-            if (conn->env->threaded) {
-                dpiMutex__acquire(conn->env->mutex);
-                status = dpiGen__checkHandle(lob, DPI_HTYPE_LOB, NULL, NULL);
-                if (status == DPI_SUCCESS)
-                    lob->refCount += 1;
-                dpiMutex__release(conn->env->mutex);
-                if (status < 0)
-                    continue;
-            }
+            if (conn->env->threaded &&
+                    dpiGen__tryAddRef(lob, DPI_HTYPE_LOB) < 0)
+                continue;
             status = dpiLob__close(lob, propagateErrors, error);
             if (conn->env->threaded)
                 dpiGen__setRefCount(lob, error, -1);
@@ -2295,6 +2276,26 @@ int dpiConn_getStmtCacheSize(dpiConn *conn, uint32_t *cacheSize)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiConn_newCompactVar() [PUBLIC]
+//   Create a new compact variable (see dpiVar_getArrays()) and return it.
+//-----------------------------------------------------------------------------
+int dpiConn_newCompactVar(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
+        int sizeIsBytes, dpiVar **var)
+{
+    dpiError error;
+    int status;
+
+    if (dpiConn__check(conn, __func__, &error) < 0)
+        return dpiGen__endPublicFn(conn, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(conn, var)
+    status = dpiVar__allocateCompact(conn, oracleTypeNum, nativeTypeNum,
+            maxArraySize, size, sizeIsBytes, var, &error);
+    return dpiGen__endPublicFn(conn, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiConn_newDeqOptions() [PUBLIC]
 //   Create a new dequeue options object and return it.
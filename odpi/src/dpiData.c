@@ -120,22 +120,28 @@ int dpiDataBuffer__fromOracleIntervalYM(dpiDataBuffer *data, dpiEnv *env,
 
 //-----------------------------------------------------------------------------
 // dpiDataBuffer__fromOracleNumberAsDouble() [INTERNAL]
-//   Populate the data from an OCINumber structure as a double.
+//   Populate the data from an OCINumber structure as a double. The mantissa
+// is decoded directly if the result is exact; otherwise, OCI is used.
 //-----------------------------------------------------------------------------
 int dpiDataBuffer__fromOracleNumberAsDouble(dpiDataBuffer *data,
         dpiError *error, void *oracleValue)
 {
+    if (dpiUtils__oracleNumberToDouble(oracleValue, &data->asDouble))
+        return DPI_SUCCESS;
     return dpiOci__numberToReal(&data->asDouble, oracleValue, error);
 }
 
 
 //-----------------------------------------------------------------------------
 // dpiDataBuffer__fromOracleNumberAsInteger() [INTERNAL]
-//   Populate the data from an OCINumber structure as an integer.
+//   Populate the data from an OCINumber structure as an integer. The mantissa
+// is decoded directly for integers of up to 18 digits; otherwise, OCI is used.
 //-----------------------------------------------------------------------------
 int dpiDataBuffer__fromOracleNumberAsInteger(dpiDataBuffer *data,
         dpiError *error, void *oracleValue)
 {
+    if (dpiUtils__oracleNumberToInt64(oracleValue, &data->asInt64))
+        return DPI_SUCCESS;
     return dpiOci__numberToInt(oracleValue, &data->asInt64, sizeof(int64_t),
             DPI_OCI_NUMBER_SIGNED, error);
 }
@@ -155,18 +161,44 @@ int dpiDataBuffer__fromOracleNumberAsUnsignedInteger(dpiDataBuffer *data,
 
 //-----------------------------------------------------------------------------
 // dpiDataBuffer__fromOracleNumberAsText() [INTERNAL]
-//   Populate the data from an OCINumber structure as text.
+//   Populate the data from an OCINumber structure as text. Valid numbers are
+// written in a single pass by dpiUtils__oracleNumberToText(); the digit by
+// digit conversion below handles the rest (and reports the errors).
 //-----------------------------------------------------------------------------
 int dpiDataBuffer__fromOracleNumberAsText(dpiDataBuffer *data, dpiEnv *env,
         dpiError *error, void *oracleValue)
 {
     uint8_t *target, numDigits, digits[DPI_NUMBER_MAX_DIGITS];
+    char text[DPI_NUMBER_AS_TEXT_CHARS];
     int16_t decimalPointIndex, i;
     uint16_t *targetUtf16;
     uint32_t numBytes;
     dpiBytes *bytes;
     int isNegative;
 
+    // single byte encodings are written directly to the buffer; UTF-16 is
+    // widened from ASCII, using the platform endianness (see below)
+    bytes = &data->asBytes;
+    if (env->charsetId == DPI_CHARSET_ID_UTF16) {
+        numBytes = bytes->length / 2;
+        if (numBytes > DPI_NUMBER_AS_TEXT_CHARS)
+            numBytes = DPI_NUMBER_AS_TEXT_CHARS;
+        if (dpiUtils__oracleNumberToText(oracleValue, text, &numBytes)) {
+            targetUtf16 = (uint16_t*) bytes->ptr;
+            for (i = 0; i < (int16_t) numBytes; i++)
+                targetUtf16[i] = (uint8_t) text[i];
+            bytes->length = numBytes * 2;
+            return DPI_SUCCESS;
+        }
+    } else {
+        numBytes = bytes->length;
+        if (dpiUtils__oracleNumberToText(oracleValue, bytes->ptr,
+                &numBytes)) {
+            bytes->length = numBytes;
+            return DPI_SUCCESS;
+        }
+    }
+
     // parse the OCINumber structure
     if (dpiUtils__parseOracleNumber(oracleValue, &isNegative,
             &decimalPointIndex, &numDigits, digits, error) < 0)
@@ -186,7 +218,6 @@ int dpiDataBuffer__fromOracleNumberAsText(dpiDataBuffer *data, dpiEnv *env,
         numBytes *= 2;
 
     // verify that the provided buffer is large enough
-    bytes = &data->asBytes;
     if (numBytes > bytes->length)
         return dpiError__set(error, "check number to text size",
                 DPI_ERR_BUFFER_SIZE_TOO_SMALL, bytes->length);
@@ -95,6 +95,7 @@ int dpiError__set(dpiError *error, const char *action, dpiErrorNum errorNum,
     va_list varArgs;
 
     if (error) {
+        error->buffer->isDirty = 1;
         error->buffer->code = 0;
         error->buffer->isRecoverable = 0;
         error->buffer->isWarning = 0;
@@ -146,6 +147,7 @@ int dpiError__setFromOCI(dpiError *error, int status, dpiConn *conn,
                 error->buffer->fnName);
 
     // fetch OCI error
+    error->buffer->isDirty = 1;
     error->buffer->action = action;
     strcpy(error->buffer->encoding, error->env->encoding);
     if (dpiOci__errorGet(error->handle, DPI_OCI_HTYPE_ERROR,
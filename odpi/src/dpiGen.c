@@ -276,27 +276,23 @@ int dpiGen__release(void *ptr, dpiHandleTypeNum typeNum, const char *fnName)
 //-----------------------------------------------------------------------------
 // dpiGen__setRefCount() [INTERNAL]
 //   Increase or decrease the reference count by the given amount. The handle
-// is assumed to be valid at this point. If the environment is in threaded
-// mode, acquire the mutex first before making any adjustments to the reference
-// count. If the operation sets the reference count to zero, release all
-// resources and free the memory associated with the structure.
+// is assumed to be valid at this point. The reference count is adjusted
+// atomically so that no lock is needed, even if the environment is in
+// threaded mode. If the operation sets the reference count to zero, release
+// all resources and free the memory associated with the structure.
 //-----------------------------------------------------------------------------
 void dpiGen__setRefCount(void *ptr, dpiError *error, int increment)
 {
     dpiBaseType *value = (dpiBaseType*) ptr;
     unsigned localRefCount;
 
-    // if threaded need to protect modification of the refCount with a mutex;
-    // also ensure that if the reference count reaches zero that it is
-    // immediately marked invalid in order to avoid race conditions
-    if (value->env->threaded)
-        dpiMutex__acquire(value->env->mutex);
-    value->refCount += increment;
-    localRefCount = value->refCount;
+    // only the thread which takes the reference count to zero sees that
+    // value, so it alone marks the handle invalid; other threads wanting a
+    // new reference to a handle they do not already own must use
+    // dpiGen__tryAddRef(), which never resurrects a handle from zero
+    localRefCount = dpiAtomic__addFetch(&value->refCount, increment);
     if (localRefCount == 0)
         dpiUtils__clearMemory(&value->checkInt, sizeof(value->checkInt));
-    if (value->env->threaded)
-        dpiMutex__release(value->env->mutex);
 
     // reference count debugging
     if (dpiDebugLevel & DPI_DEBUG_LEVEL_REFS)
@@ -330,3 +326,35 @@ int dpiGen__startPublicFn(const void *ptr, dpiHandleTypeNum typeNum,
     error->env = value->env;
     return DPI_SUCCESS;
 }
+
+
+//-----------------------------------------------------------------------------
+// dpiGen__tryAddRef() [INTERNAL]
+//   Acquire a reference to a handle which is referenced by another structure
+// without that structure holding a reference itself (such as the handles a
+// connection keeps in its lists of open statements and LOBs). The handle is
+// checked for validity and the reference count is only increased if it has
+// not already dropped to zero, since that means the handle is in the process
+// of being freed by another thread.
+//-----------------------------------------------------------------------------
+int dpiGen__tryAddRef(void *ptr, dpiHandleTypeNum typeNum)
+{
+    dpiBaseType *value = (dpiBaseType*) ptr;
+    unsigned refCount;
+
+    if (dpiGen__checkHandle(ptr, typeNum, NULL, NULL) < 0)
+        return DPI_FAILURE;
+    refCount = dpiAtomic__load(&value->refCount);
+    while (1) {
+        if (refCount == 0)
+            return DPI_FAILURE;
+        if (dpiAtomic__compareExchange(&value->refCount, refCount,
+                refCount + 1))
+            break;
+        refCount = dpiAtomic__load(&value->refCount);
+    }
+    if (dpiDebugLevel & DPI_DEBUG_LEVEL_REFS)
+        dpiDebug__print("ref %p (%s) -> %d\n", ptr, value->typeDef->name,
+                refCount + 1);
+    return DPI_SUCCESS;
+}
@@ -51,6 +51,17 @@
         static void f(void)
 #endif
 
+// cross platform way of declaring native thread local storage; if it is not
+// available, the error buffer is looked up with OCIThreadKeyGet() every time
+#if defined(_MSC_VER)
+    #define DPI_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define DPI_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+        !defined(__STDC_NO_THREADS__)
+    #define DPI_THREAD_LOCAL _Thread_local
+#endif
+
 // a global OCI environment is used for managing error buffers in a thread-safe
 // manner; each thread is given its own error buffer; OCI error handles,
 // though, must be created within the OCI environment created for use by
@@ -59,6 +70,9 @@ static void *dpiGlobalEnvHandle = NULL;
 static void *dpiGlobalErrorHandle = NULL;
 static void *dpiGlobalThreadKey = NULL;
 static dpiErrorBuffer dpiGlobalErrorBuffer;
+#ifdef DPI_THREAD_LOCAL
+static DPI_THREAD_LOCAL dpiErrorBuffer *dpiGlobalThreadErrorBuffer = NULL;
+#endif
 static dpiVersionInfo dpiGlobalClientVersionInfo;
 static int dpiGlobalInitialized = 0;
 
@@ -77,6 +91,8 @@ static int dpiGlobal__extendedInitialize(dpiContextCreateParams *params,
         const char *fnName, dpiError *error);
 static void dpiGlobal__finalize(void);
 static int dpiGlobal__getErrorBuffer(const char *fnName, dpiError *error);
+static int dpiGlobal__lookupErrorBuffer(dpiErrorBuffer **errorBuffer,
+        dpiError *error);
 
 
 //-----------------------------------------------------------------------------
@@ -187,6 +203,9 @@ static void dpiGlobal__finalize(void)
                     dpiGlobalThreadKey, NULL, &error);
             dpiUtils__freeMemory(errorBuffer);
         }
+#ifdef DPI_THREAD_LOCAL
+        dpiGlobalThreadErrorBuffer = NULL;
+#endif
         dpiOci__threadKeyDestroy(dpiGlobalEnvHandle, dpiGlobalErrorHandle,
                 &dpiGlobalThreadKey, &error);
         dpiGlobalThreadKey = NULL;
@@ -214,37 +233,37 @@ static int dpiGlobal__getErrorBuffer(const char *fnName, dpiError *error)
 {
     dpiErrorBuffer *tempErrorBuffer;
 
-    // look up the error buffer specific to this thread
-    if (dpiOci__threadKeyGet(dpiGlobalEnvHandle, dpiGlobalErrorHandle,
-            dpiGlobalThreadKey, (void**) &tempErrorBuffer, error) < 0)
-        return DPI_FAILURE;
-
-    // if NULL, key has never been set for this thread, allocate new error
-    // buffer and set it
+#ifdef DPI_THREAD_LOCAL
+    // the error buffer of this thread is cached after the first look up
+    tempErrorBuffer = dpiGlobalThreadErrorBuffer;
     if (!tempErrorBuffer) {
-        if (dpiUtils__allocateMemory(1, sizeof(dpiErrorBuffer), 1,
-                "allocate error buffer", (void**) &tempErrorBuffer, error) < 0)
+        if (dpiGlobal__lookupErrorBuffer(&tempErrorBuffer, error) < 0)
             return DPI_FAILURE;
-        if (dpiOci__threadKeySet(dpiGlobalEnvHandle, dpiGlobalErrorHandle,
-                dpiGlobalThreadKey, tempErrorBuffer, error) < 0) {
-            dpiUtils__freeMemory(tempErrorBuffer);
-            return DPI_FAILURE;
-        }
+        dpiGlobalThreadErrorBuffer = tempErrorBuffer;
     }
+#else
+    if (dpiGlobal__lookupErrorBuffer(&tempErrorBuffer, error) < 0)
+        return DPI_FAILURE;
+#endif
 
     // if a function name has been specified, clear error
     // the only time a function name is not specified is for
-    // dpiContext_getError() when the error information is being retrieved
+    // dpiContext_getError() when the error information is being retrieved;
+    // the error information is only cleared if an error or warning has been
+    // set since it was last cleared
     if (fnName) {
-        tempErrorBuffer->code = 0;
-        tempErrorBuffer->offset = 0;
-        tempErrorBuffer->errorNum = (dpiErrorNum) 0;
-        tempErrorBuffer->isRecoverable = 0;
-        tempErrorBuffer->messageLength = 0;
         tempErrorBuffer->fnName = fnName;
         tempErrorBuffer->action = "start";
-        tempErrorBuffer->isWarning = 0;
-        strcpy(tempErrorBuffer->encoding, DPI_CHARSET_NAME_UTF8);
+        if (tempErrorBuffer->isDirty) {
+            tempErrorBuffer->code = 0;
+            tempErrorBuffer->offset = 0;
+            tempErrorBuffer->errorNum = (dpiErrorNum) 0;
+            tempErrorBuffer->isRecoverable = 0;
+            tempErrorBuffer->messageLength = 0;
+            tempErrorBuffer->isWarning = 0;
+            strcpy(tempErrorBuffer->encoding, DPI_CHARSET_NAME_UTF8);
+            tempErrorBuffer->isDirty = 0;
+        }
     }
 
     error->buffer = tempErrorBuffer;
@@ -338,6 +357,36 @@ int dpiGlobal__lookupCharSet(const char *name, uint16_t *charsetId,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiGlobal__lookupErrorBuffer() [INTERNAL]
+//   Look up the error buffer specific to this thread with OCIThreadKeyGet().
+// If the key has never been set for this thread, a new error buffer is
+// allocated and set; it is marked dirty so that it is reset before use.
+//-----------------------------------------------------------------------------
+static int dpiGlobal__lookupErrorBuffer(dpiErrorBuffer **errorBuffer,
+        dpiError *error)
+{
+    dpiErrorBuffer *tempErrorBuffer;
+
+    if (dpiOci__threadKeyGet(dpiGlobalEnvHandle, dpiGlobalErrorHandle,
+            dpiGlobalThreadKey, (void**) &tempErrorBuffer, error) < 0)
+        return DPI_FAILURE;
+    if (!tempErrorBuffer) {
+        if (dpiUtils__allocateMemory(1, sizeof(dpiErrorBuffer), 1,
+                "allocate error buffer", (void**) &tempErrorBuffer, error) < 0)
+            return DPI_FAILURE;
+        if (dpiOci__threadKeySet(dpiGlobalEnvHandle, dpiGlobalErrorHandle,
+                dpiGlobalThreadKey, tempErrorBuffer, error) < 0) {
+            dpiUtils__freeMemory(tempErrorBuffer);
+            return DPI_FAILURE;
+        }
+        tempErrorBuffer->isDirty = 1;
+    }
+    *errorBuffer = tempErrorBuffer;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiGlobal__lookupEncoding() [INTERNAL]
 //   Get the IANA character set name (encoding) given the Oracle character set
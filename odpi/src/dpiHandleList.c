@@ -31,45 +31,58 @@
 
 #include "dpiImpl.h"
 
+//-----------------------------------------------------------------------------
+// dpiHandleList__expand() [INTERNAL]
+//   Double the number of slots available in the list. The new slots are
+// pushed on to the stack of empty slots in reverse order so that the lowest
+// numbered slot is used first. The list mutex is assumed to be held.
+//-----------------------------------------------------------------------------
+static int dpiHandleList__expand(dpiHandleList *list, dpiError *error)
+{
+    uint32_t numSlots, numFreeSlots, i;
+    uint32_t *tempFreeSlots;
+    void **tempHandles;
+
+    numSlots = list->numSlots * 2;
+    if (dpiUtils__allocateMemory(numSlots, sizeof(void*), 1,
+            "allocate slots", (void**) &tempHandles, error) < 0)
+        return DPI_FAILURE;
+    if (dpiUtils__allocateMemory(numSlots, sizeof(uint32_t), 0,
+            "allocate free slots", (void**) &tempFreeSlots, error) < 0) {
+        dpiUtils__freeMemory(tempHandles);
+        return DPI_FAILURE;
+    }
+    memcpy(tempHandles, list->handles, list->numSlots * sizeof(void*));
+    numFreeSlots = list->numSlots - list->numUsedSlots;
+    memcpy(tempFreeSlots, list->freeSlots, numFreeSlots * sizeof(uint32_t));
+    for (i = numSlots; i > list->numSlots; i--)
+        tempFreeSlots[numFreeSlots++] = i - 1;
+    dpiUtils__freeMemory(list->handles);
+    dpiUtils__freeMemory(list->freeSlots);
+    list->handles = tempHandles;
+    list->freeSlots = tempFreeSlots;
+    list->numSlots = numSlots;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiHandleList__addHandle() [INTERNAL]
-//   Add a handle to the list. The list is expanded in sets of 8 handles as
-// needed. A current position is maintained to reduce the number of scans of
-// the list are required. An empty slot is designated by a NULL pointer.
+//   Add a handle to the list. An empty slot is popped from the stack of empty
+// slots; if there are none, the list is doubled in size first. An empty slot
+// is designated by a NULL pointer.
 //-----------------------------------------------------------------------------
 int dpiHandleList__addHandle(dpiHandleList *list, void *handle,
         uint32_t *slotNum, dpiError *error)
 {
-    uint32_t numSlots, i;
-    void **tempHandles;
-
     dpiMutex__acquire(list->mutex);
-    if (list->numUsedSlots == list->numSlots) {
-        numSlots = list->numSlots + 8;
-        if (dpiUtils__allocateMemory(numSlots, sizeof(void*), 1,
-                "allocate slots", (void**) &tempHandles, error) < 0) {
-            dpiMutex__release(list->mutex);
-            return DPI_FAILURE;
-        }
-        memcpy(tempHandles, list->handles, list->numSlots * sizeof(void*));
-        dpiUtils__freeMemory(list->handles);
-        list->handles = tempHandles;
-        list->numSlots = numSlots;
-        *slotNum = list->numUsedSlots++;
-        list->currentPos = list->numUsedSlots;
-    } else {
-        for (i = 0; i < list->numSlots; i++) {
-            if (!list->handles[list->currentPos])
-                break;
-            list->currentPos++;
-            if (list->currentPos == list->numSlots)
-                list->currentPos = 0;
-        }
-        list->numUsedSlots++;
-        *slotNum = list->currentPos++;
-        if (list->currentPos == list->numSlots)
-            list->currentPos = 0;
+    if (list->numUsedSlots == list->numSlots &&
+            dpiHandleList__expand(list, error) < 0) {
+        dpiMutex__release(list->mutex);
+        return DPI_FAILURE;
     }
+    *slotNum = list->freeSlots[list->numSlots - list->numUsedSlots - 1];
+    list->numUsedSlots++;
     list->handles[*slotNum] = handle;
     dpiMutex__release(list->mutex);
     return DPI_SUCCESS;
@@ -83,6 +96,7 @@ int dpiHandleList__addHandle(dpiHandleList *list, void *handle,
 int dpiHandleList__create(dpiHandleList **list, dpiError *error)
 {
     dpiHandleList *tempList;
+    uint32_t i;
 
     if (dpiUtils__allocateMemory(1, sizeof(dpiHandleList), 0,
             "allocate handle list", (void**) &tempList, error) < 0)
@@ -95,8 +109,16 @@ int dpiHandleList__create(dpiHandleList **list, dpiError *error)
         dpiUtils__freeMemory(tempList);
         return DPI_FAILURE;
     }
+    if (dpiUtils__allocateMemory(tempList->numSlots, sizeof(uint32_t), 0,
+            "allocate handle list free slots",
+            (void**) &tempList->freeSlots, error) < 0) {
+        dpiUtils__freeMemory(tempList->handles);
+        dpiUtils__freeMemory(tempList);
+        return DPI_FAILURE;
+    }
+    for (i = 0; i < tempList->numSlots; i++)
+        tempList->freeSlots[i] = tempList->numSlots - i - 1;
     dpiMutex__initialize(tempList->mutex);
-    tempList->currentPos = 0;
     *list = tempList;
     return DPI_SUCCESS;
 }
@@ -111,6 +133,10 @@ void dpiHandleList__free(dpiHandleList *list)
         dpiUtils__freeMemory(list->handles);
         list->handles = NULL;
     }
+    if (list->freeSlots) {
+        dpiUtils__freeMemory(list->freeSlots);
+        list->freeSlots = NULL;
+    }
     dpiMutex__destroy(list->mutex);
     dpiUtils__freeMemory(list);
 }
@@ -118,12 +144,14 @@ void dpiHandleList__free(dpiHandleList *list)
 
 //-----------------------------------------------------------------------------
 // dpiHandleList__removeHandle() [INTERNAL]
-//   Remove the handle at the specified location from the list.
+//   Remove the handle at the specified location from the list and push the
+// slot on to the stack of empty slots so that it is reused first.
 //-----------------------------------------------------------------------------
 void dpiHandleList__removeHandle(dpiHandleList *list, uint32_t slotNum)
 {
     dpiMutex__acquire(list->mutex);
     list->handles[slotNum] = NULL;
     list->numUsedSlots--;
+    list->freeSlots[list->numSlots - list->numUsedSlots - 1] = slotNum;
     dpiMutex__release(list->mutex);
 }
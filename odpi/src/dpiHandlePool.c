@@ -25,8 +25,13 @@
 //-----------------------------------------------------------------------------
 // dpiHandlePool.c
 //   Implementation of a pool of handles which can be acquired and released in
-// a thread-safe manner. The pool is a circular queue where handles are
-// acquired from the front and released to the back.
+// a thread-safe manner. The pool is a bounded lock-free circular queue where
+// handles are acquired from the front and released to the back. Each slot
+// carries a sequence number which tells whether the slot is ready to be
+// acquired from or released to for the current lap around the ring, so that
+// neither operation ever needs to take a lock or reallocate. A slot which is
+// not ready while another thread is part way through acquiring or releasing
+// it is retried rather than treated as an empty or full pool.
 //-----------------------------------------------------------------------------
 
 #include "dpiImpl.h"
@@ -40,35 +45,36 @@
 // expected to create a new handle and return it to the pool when it is
 // finished with it.
 //-----------------------------------------------------------------------------
-int dpiHandlePool__acquire(dpiHandlePool *pool, void **handle, dpiError *error)
+int dpiHandlePool__acquire(dpiHandlePool *pool, void **handle,
+        UNUSED dpiError *error)
 {
-    void **tempHandles;
-    uint32_t numSlots;
+    dpiHandlePoolSlot *slot;
+    uint32_t pos, sequence;
+    int32_t diff;
 
-    dpiMutex__acquire(pool->mutex);
-    if (pool->acquirePos != pool->releasePos) {
-        *handle = pool->handles[pool->acquirePos];
-        pool->handles[pool->acquirePos++] = NULL;
-        if (pool->acquirePos == pool->numSlots)
-            pool->acquirePos = 0;
-    } else {
-        *handle = NULL;
-        pool->numUsedSlots++;
-        if (pool->numUsedSlots > pool->numSlots) {
-            numSlots = pool->numSlots + 8;
-            if (dpiUtils__allocateMemory(numSlots, sizeof(void*), 1,
-                    "allocate slots", (void**) &tempHandles, error) < 0) {
-                dpiMutex__release(pool->mutex);
-                return DPI_FAILURE;
-            }
-            memcpy(tempHandles, pool->handles, pool->numSlots * sizeof(void*));
-            dpiUtils__freeMemory(pool->handles);
-            pool->handles = tempHandles;
-            pool->numSlots = numSlots;
+    pos = dpiAtomic__load(&pool->acquirePos);
+    while (1) {
+        slot = &pool->slots[pos & pool->mask];
+        sequence = dpiAtomic__load(&slot->sequence);
+        diff = (int32_t) (sequence - (pos + 1));
+        if (diff == 0) {
+            if (dpiAtomic__compareExchange(&pool->acquirePos, pos, pos + 1))
+                break;
+            pos = dpiAtomic__load(&pool->acquirePos);
+        } else if (diff < 0 &&
+                dpiAtomic__load(&pool->releasePos) == pos) {
+            *handle = NULL;
+            return DPI_SUCCESS;
+        } else {
+            pos = dpiAtomic__load(&pool->acquirePos);
         }
     }
-    dpiMutex__release(pool->mutex);
 
+    // the slot now belongs exclusively to this thread until its sequence
+    // number is advanced for the next lap
+    *handle = slot->handle;
+    slot->handle = NULL;
+    dpiAtomic__store(&slot->sequence, pos + pool->mask + 1);
     return DPI_SUCCESS;
 }
 
@@ -80,19 +86,20 @@ int dpiHandlePool__acquire(dpiHandlePool *pool, void **handle, dpiError *error)
 int dpiHandlePool__create(dpiHandlePool **pool, dpiError *error)
 {
     dpiHandlePool *tempPool;
+    uint32_t i;
 
-    if (dpiUtils__allocateMemory(1, sizeof(dpiHandlePool), 0,
+    if (dpiUtils__allocateMemory(1, sizeof(dpiHandlePool), 1,
             "allocate handle pool", (void**) &tempPool, error) < 0)
         return DPI_FAILURE;
-    tempPool->numSlots = 8;
-    tempPool->numUsedSlots = 0;
-    if (dpiUtils__allocateMemory(tempPool->numSlots, sizeof(void*), 1,
-            "allocate handle pool slots", (void**) &tempPool->handles,
-            error) < 0) {
+    if (dpiUtils__allocateMemory(DPI_HANDLE_POOL_SLOTS,
+            sizeof(dpiHandlePoolSlot), 1, "allocate handle pool slots",
+            (void**) &tempPool->slots, error) < 0) {
         dpiUtils__freeMemory(tempPool);
         return DPI_FAILURE;
     }
-    dpiMutex__initialize(tempPool->mutex);
+    for (i = 0; i < DPI_HANDLE_POOL_SLOTS; i++)
+        tempPool->slots[i].sequence = i;
+    tempPool->mask = DPI_HANDLE_POOL_SLOTS - 1;
     tempPool->acquirePos = 0;
     tempPool->releasePos = 0;
     *pool = tempPool;
@@ -105,11 +112,10 @@ int dpiHandlePool__create(dpiHandlePool **pool, dpiError *error)
 //-----------------------------------------------------------------------------
 void dpiHandlePool__free(dpiHandlePool *pool)
 {
-    if (pool->handles) {
-        dpiUtils__freeMemory(pool->handles);
-        pool->handles = NULL;
+    if (pool->slots) {
+        dpiUtils__freeMemory(pool->slots);
+        pool->slots = NULL;
     }
-    dpiMutex__destroy(pool->mutex);
     dpiUtils__freeMemory(pool);
 }
 
@@ -118,15 +124,38 @@ void dpiHandlePool__free(dpiHandlePool *pool)
 // dpiHandlePool__release() [INTERNAL]
 //   Release a handle back to the pool. No checks are performed on the handle
 // that is being returned to the pool; It will simply be placed back in the
-// pool. The handle is then NULLed in order to avoid multiple attempts to
-// release the handle back to the pool.
+// pool. If the pool is full the handle is freed instead. The handle is then
+// NULLed in order to avoid multiple attempts to release the handle back to
+// the pool.
 //-----------------------------------------------------------------------------
 void dpiHandlePool__release(dpiHandlePool *pool, void **handle)
 {
-    dpiMutex__acquire(pool->mutex);
-    pool->handles[pool->releasePos++] = *handle;
+    dpiHandlePoolSlot *slot;
+    uint32_t pos, sequence;
+    int32_t diff;
+
+    pos = dpiAtomic__load(&pool->releasePos);
+    while (1) {
+        slot = &pool->slots[pos & pool->mask];
+        sequence = dpiAtomic__load(&slot->sequence);
+        diff = (int32_t) (sequence - pos);
+        if (diff == 0) {
+            if (dpiAtomic__compareExchange(&pool->releasePos, pos, pos + 1))
+                break;
+            pos = dpiAtomic__load(&pool->releasePos);
+        } else if (diff < 0 &&
+                dpiAtomic__load(&pool->acquirePos) + pool->mask + 1 == pos) {
+            dpiOci__handleFree(*handle, DPI_OCI_HTYPE_ERROR);
+            *handle = NULL;
+            return;
+        } else {
+            pos = dpiAtomic__load(&pool->releasePos);
+        }
+    }
+
+    // the slot now belongs exclusively to this thread until its sequence
+    // number is advanced to make it available for acquiring
+    slot->handle = *handle;
     *handle = NULL;
-    if (pool->releasePos == pool->numSlots)
-        pool->releasePos = 0;
-    dpiMutex__release(pool->mutex);
+    dpiAtomic__store(&slot->sequence, pos + 1);
 }
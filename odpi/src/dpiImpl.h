@@ -91,6 +91,14 @@
 // define debugging level (defined in dpiGlobal.c)
 extern unsigned long dpiDebugLevel;
 
+#ifdef DPI_MOCK_OCI
+// number of memory allocations made and of bytes allocated (defined in
+// dpiUtils.c); used for measuring the allocations of the fetch path with the
+// mock OCI library
+extern uint32_t dpiUtils__numAllocations;
+extern uint32_t dpiUtils__allocatedBytes;
+#endif
+
 // define max error size
 #define DPI_MAX_ERROR_SIZE                          3072
 
@@ -115,6 +123,13 @@ extern unsigned long dpiDebugLevel;
 // define maximum buffer size permitted in variables
 #define DPI_MAX_VAR_BUFFER_SIZE                     (1024 * 1024 * 1024 - 2)
 
+// define number of collection elements got with one OCICollGetElemArray()
+#define DPI_OBJECT_ELEMENT_BATCH_SIZE               256
+
+// define number of slots in a handle pool (must be a power of 2); handles
+// released while the pool is full are freed instead of being retained
+#define DPI_HANDLE_POOL_SLOTS                       1024
+
 // define subscription grouping repeat count
 #define DPI_SUBSCR_GROUPING_FOREVER                 -1
 
@@ -253,6 +268,7 @@ extern unsigned long dpiDebugLevel;
 #define DPI_OCI_ATTR_ROWS_FETCHED                   197
 #define DPI_OCI_ATTR_SPOOL_STMTCACHESIZE            208
 #define DPI_OCI_ATTR_TYPECODE                       216
+#define DPI_OCI_ATTR_COLLECTION_TYPECODE            217
 #define DPI_OCI_ATTR_STMT_IS_RETURNING              218
 #define DPI_OCI_ATTR_CURRENT_SCHEMA                 224
 #define DPI_OCI_ATTR_SUBSCR_QOSFLAGS                225
@@ -413,6 +429,8 @@ extern unsigned long dpiDebugLevel;
 #define DPI_SQLT_INTERVAL_DS                        190
 #define DPI_SQLT_TIMESTAMP_LTZ                      232
 #define DPI_OCI_TYPECODE_SMALLINT                   246
+#define DPI_OCI_TYPECODE_VARRAY                     247
+#define DPI_OCI_TYPECODE_TABLE                      248
 #define DPI_SQLT_REC                                250
 #define DPI_SQLT_BOL                                252
 #define DPI_OCI_TYPECODE_ROWID                      262
@@ -662,6 +680,7 @@ typedef enum {
     DPI_ERR_UNSUPPORTED_VECTOR_FORMAT,
     DPI_ERR_SODA_DOC_IS_JSON,
     DPI_ERR_SODA_DOC_IS_NOT_JSON,
+    DPI_ERR_WRONG_VECTOR_DIMENSIONS,
     DPI_ERR_MAX
 } dpiErrorNum;
 
@@ -712,6 +731,50 @@ typedef enum {
 #endif
 
 
+//-----------------------------------------------------------------------------
+// Atomic definitions; these operate on plain 32-bit unsigned integers (and
+// not on C11 _Atomic types) so that structures containing them remain
+// readable by languages binding to the library; all operations are
+// sequentially consistent; the *Ptr variants operate on pointers
+//-----------------------------------------------------------------------------
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define dpiAtomic__load(p) \
+        ((uint32_t) InterlockedCompareExchange((volatile LONG*) (p), 0, 0))
+    #define dpiAtomic__store(p, v) \
+        InterlockedExchange((volatile LONG*) (p), (LONG) (v))
+    #define dpiAtomic__addFetch(p, v) \
+        ((uint32_t) InterlockedExchangeAdd((volatile LONG*) (p), (LONG) (v)) \
+                + (uint32_t) (v))
+    #define dpiAtomic__compareExchange(p, expected, desired) \
+        (InterlockedCompareExchange((volatile LONG*) (p), (LONG) (desired), \
+                (LONG) (expected)) == (LONG) (expected))
+    #define dpiAtomic__loadPtr(p) \
+        InterlockedCompareExchangePointer((void* volatile*) (p), NULL, NULL)
+    #define dpiAtomic__exchangePtr(p, v) \
+        InterlockedExchangePointer((void* volatile*) (p), (void*) (v))
+    #define dpiAtomic__compareExchangePtr(p, expected, desired) \
+        (InterlockedCompareExchangePointer((void* volatile*) (p), \
+                (void*) (desired), (void*) (expected)) == (void*) (expected))
+#else
+    #define dpiAtomic__load(p)          __atomic_load_n(p, __ATOMIC_SEQ_CST)
+    #define dpiAtomic__store(p, v) \
+        __atomic_store_n(p, v, __ATOMIC_SEQ_CST)
+    #define dpiAtomic__addFetch(p, v) \
+        __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST)
+    #define dpiAtomic__compareExchange(p, expected, desired) \
+        __sync_bool_compare_and_swap(p, expected, desired)
+    #define dpiAtomic__loadPtr(p)       __atomic_load_n(p, __ATOMIC_SEQ_CST)
+    #define dpiAtomic__exchangePtr(p, v) \
+        __atomic_exchange_n(p, v, __ATOMIC_SEQ_CST)
+    #define dpiAtomic__compareExchangePtr(p, expected, desired) \
+        __sync_bool_compare_and_swap(p, expected, desired)
+#endif
+
+// define the size of a cache line, used for padding members which are
+// modified concurrently by different threads
+#define DPI_CACHE_LINE_SIZE                         64
+
+
 //-----------------------------------------------------------------------------
 // old type definitions (to be dropped)
 //-----------------------------------------------------------------------------
@@ -1040,30 +1103,45 @@ struct dpiJznDomScalar {
 // a connection (so that they can be closed before the connection itself is
 // closed); the functions for managing this structure can be found in the file
 // dpiHandleList.c; empty slots in the array are represented by a NULL handle
+// and their indices are kept on a stack so that they can be reused without
+// scanning the array
 typedef struct {
     void **handles;                     // array of handles managed by list
+    uint32_t *freeSlots;                // stack of empty slot indices
     uint32_t numSlots;                  // length of handles array
     uint32_t numUsedSlots;              // actual number of managed handles
-    uint32_t currentPos;                // next position to search
     dpiMutexType mutex;                 // enables thread safety
 } dpiHandleList;
 
+// used to hold a single handle within a handle pool; the sequence number
+// tells acquirers and releasers whether the slot is currently filled
+typedef struct {
+    uint32_t sequence;                  // sequence number of slot
+    void *handle;                       // handle stored in slot
+} dpiHandlePoolSlot;
+
 // used to manage a pool of shared handles in a thread-safe manner; currently
 // used for managing the pool of error handles in the dpiEnv structure; the
-// functions for managing this structure are found in the file dpiHandlePool.c
+// pool is a bounded lock-free ring and the acquire and release positions are
+// kept on separate cache lines; the functions for managing this structure are
+// found in the file dpiHandlePool.c
 typedef struct {
-    void **handles;                     // array of handles managed by pool
-    uint32_t numSlots;                  // length of handles array
-    uint32_t numUsedSlots;              // actual number of managed handles
+    dpiHandlePoolSlot *slots;           // ring of slots managed by pool
+    uint32_t mask;                      // number of slots - 1
+    char pad1[DPI_CACHE_LINE_SIZE];     // padding (avoid false sharing)
     uint32_t acquirePos;                // position from which to acquire
+    char pad2[DPI_CACHE_LINE_SIZE];     // padding (avoid false sharing)
     uint32_t releasePos;                // position to place released handles
-    dpiMutexType mutex;                 // enables thread safety
+    char pad3[DPI_CACHE_LINE_SIZE];     // padding (avoid false sharing)
 } dpiHandlePool;
 
 // used to save error information internally; one of these is stored for each
 // thread using OCIThreadKeyGet() and OCIThreadKeySet() with a globally created
-// OCI environment handle; it is also used when getting batch error information
-// with the function dpiStmt_getBatchErrors()
+// OCI environment handle (and cached in native thread local storage, where
+// available); it is also used when getting batch error information with the
+// function dpiStmt_getBatchErrors(); it is only reset at the start of a
+// public function if an error or warning has been set since the last reset
+// (isDirty)
 typedef struct {
     int32_t code;                       // Oracle error code or 0
     uint32_t offset;                    // parse error offset or row offset
@@ -1075,6 +1153,7 @@ typedef struct {
     uint32_t messageLength;             // length of message in buffer
     int isRecoverable;                  // is recoverable?
     int isWarning;                      // is a warning?
+    int isDirty;                        // set since last reset?
 } dpiErrorBuffer;
 
 // represents an OCI environment; a pointer to this structure is stored on each
@@ -1284,6 +1363,7 @@ typedef struct {
     void **indicators;                  // array of indicator pointers
     int16_t *scalarIndicators;          // array of scalar indicator buffers
     void **msgIds;                      // array of OCI message ids
+    dpiJson **jsonPayloads;             // array of pooled JSON payloads
 } dpiQueueBuffer;
 
 
@@ -1386,6 +1466,7 @@ struct dpiStmt {
     int isReturning;                    // statement has RETURNING clause?
     int deleteFromCache;                // drop from statement cache on close?
     int closing;                        // statement is being closed?
+    int holdsCursor;                    // REF CURSOR fetched into handle?
 };
 
 // represents memory areas used for transferring data to and from the database
@@ -1401,12 +1482,22 @@ struct dpiVar {
     int isArray;                        // is an index-by table (array)?
     uint32_t sizeInBytes;               // size in bytes of each row
     int isDynamic;                      // dynamically bound or defined?
+    int isCompact;                      // without dpiData (define only)?
     dpiObjectType *objectType;          // object type (or NULL)
     dpiVarBuffer buffer;                // main buffer for data
     dpiVarBuffer *dynBindBuffers;       // array of buffers (DML returning)
     dpiError *error;                    // error (only for dynamic bind/define)
 };
 
+// structure used for the chunks of memory the native nodes of JSON values are
+// allocated from; the memory of the chunk follows this header
+typedef struct dpiJsonArenaChunk dpiJsonArenaChunk;
+struct dpiJsonArenaChunk {
+    dpiJsonArenaChunk *next;            // previously allocated chunk
+    size_t size;                        // size of the chunk memory
+    size_t used;                        // used size of the chunk memory
+};
+
 // represents JSON values and is exposed publicly as a handle of type
 // DPI_HTYPE_JSON; the implementation for this is found in the file dpiJson.c
 struct dpiJson {
@@ -1415,10 +1506,7 @@ struct dpiJson {
     void *handle;                       // OCI JSON descriptor
     dpiJsonNode topNode;                // top level node
     dpiDataBuffer topNodeBuffer;        // top level node data buffer
-    char **tempBuffers;                 // array of temp buffers
-    uint32_t allocatedTempBuffers;      // allocated number of temp buffers
-    uint32_t numTempBuffers;            // used number of temp buffers
-    uint32_t tempBufferUsed;            // used size of current temp buffer
+    dpiJsonArenaChunk *arena;           // memory of the native nodes
     void *convTimestamp;                // timestamp (for conversions)
     void *convIntervalDS;               // interval DS (for conversions)
     void *convIntervalYM;               // interval YM (for conversions)
@@ -1436,6 +1524,7 @@ struct dpiLob {
     void *locator;                      // OCI LOB locator descriptor
     char *buffer;                       // stores dir alias/name for BFILE
     int closing;                        // is LOB being closed?
+    int isResourceOpen;                 // opened by dpiLob_openResource()?
 };
 
 // represents object attributes of the types created by the SQL command CREATE
@@ -1466,6 +1555,7 @@ struct dpiObjectType {
     uint32_t nameLength;                // length of name of type
     dpiDataTypeInfo elementTypeInfo;    // type info of elements of collection
     int isCollection;                   // is type a collection?
+    uint16_t collectionTypeCode;        // OCI type code of collection
     uint16_t numAttributes;             // number of attributes type has
 };
 
@@ -1712,6 +1802,7 @@ int dpiGen__release(void *ptr, dpiHandleTypeNum typeNum, const char *fnName);
 void dpiGen__setRefCount(void *ptr, dpiError *error, int increment);
 int dpiGen__startPublicFn(const void *ptr, dpiHandleTypeNum typeNum,
         const char *fnName, dpiError *error);
+int dpiGen__tryAddRef(void *ptr, dpiHandleTypeNum typeNum);
 
 
 //-----------------------------------------------------------------------------
@@ -1782,6 +1873,11 @@ int dpiVar__allocate(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
         dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
         int sizeIsBytes, int isArray, dpiObjectType *objType, dpiVar **var,
         dpiData **data, dpiError *error);
+int dpiVar__allocateCompact(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
+        int sizeIsBytes, dpiVar **var, dpiError *error);
+int dpiVar__checkReturnCodes(dpiVar *var, uint32_t numRows,
+        dpiError *error);
 int dpiVar__convertToLob(dpiVar *var, dpiError *error);
 int dpiVar__copyData(dpiVar *var, uint32_t pos, dpiData *sourceData,
         dpiError *error);
@@ -1820,6 +1916,7 @@ int dpiLob__allocate(dpiConn *conn, const dpiOracleType *type, dpiLob **lob,
         dpiError *error);
 int dpiLob__close(dpiLob *lob, int propagateErrors, dpiError *error);
 void dpiLob__free(dpiLob *lob, dpiError *error);
+int dpiLob__prepareReuse(dpiLob *lob, dpiError *error);
 int dpiLob__readBytes(dpiLob *lob, uint64_t offset, uint64_t amount,
         char *value, uint64_t *valueLength, dpiError *error);
 int dpiLob__setFromBytes(dpiLob *lob, const char *value, uint64_t valueLength,
@@ -1979,6 +2076,9 @@ int dpiOci__collAssignElem(dpiConn *conn, int32_t index, const void *elem,
         const void *elemInd, void *coll, dpiError *error);
 int dpiOci__collGetElem(dpiConn *conn, void *coll, int32_t index, int *exists,
         void **elem, void **elemInd, dpiError *error);
+int dpiOci__collGetElemArray(dpiConn *conn, void *coll, int32_t index,
+        int *exists, void **elems, void **elemInds, uint32_t *numElems,
+        dpiError *error);
 int dpiOci__collSize(dpiConn *conn, void *coll, int32_t *size,
         dpiError *error);
 int dpiOci__collTrim(dpiConn *conn, uint32_t numToTrim, void *coll,
@@ -2256,6 +2356,8 @@ int dpiOci__vectorFromArray(dpiVector *vector, dpiVectorInfo *info,
 int dpiOci__vectorFromSparseArray(dpiVector *vector, dpiVectorInfo *info,
         dpiError *error);
 int dpiOci__vectorToArray(dpiVector *vector, dpiError *error);
+int dpiOci__vectorToArrayBuffer(dpiVector *vector, uint8_t format,
+        uint32_t *numDimensions, void *buffer, dpiError *error);
 int dpiOci__vectorToSparseArray(dpiVector *vector, dpiError *error);
 
 
@@ -2321,6 +2423,10 @@ int dpiUtils__getAttrStringWithDup(const char *action, const void *ociHandle,
 int dpiUtils__getWindowsError(DWORD errorNum, char **buffer,
         size_t *bufferLength, dpiError *error);
 #endif
+int dpiUtils__oracleNumberToDouble(void *oracleValue, double *value);
+int dpiUtils__oracleNumberToInt64(void *oracleValue, int64_t *value);
+int dpiUtils__oracleNumberToText(void *oracleValue, char *text,
+        uint32_t *textLength);
 int dpiUtils__parseNumberString(const char *value, uint32_t valueLength,
         uint16_t charsetId, int *isNegative, int16_t *decimalPointIndex,
         uint8_t *numDigits, uint8_t *digits, dpiError *error);
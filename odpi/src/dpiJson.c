@@ -32,11 +32,19 @@
 // define number of nodes which are processed in each batch
 #define DPI_JSON_BATCH_NODES            64
 
-// define batch size of space allocated for temporary buffers used for
-// converting numbers to text
-#define DPI_JSON_TEMP_BUFFER_SIZE       1024
+// define size of the first chunk of the arena the native nodes are allocated
+// from; each further chunk is twice as large as the previous one
+#define DPI_JSON_ARENA_CHUNK_SIZE       16384
+
+// define alignment of the memory allocated from the arena
+#define DPI_JSON_ARENA_ALIGNMENT        sizeof(dpiDataBuffer)
+#define DPI_JSON_ARENA_ALIGN(size)      (((size) + DPI_JSON_ARENA_ALIGNMENT - \
+        1) / DPI_JSON_ARENA_ALIGNMENT * DPI_JSON_ARENA_ALIGNMENT)
 
 // forward declarations of internal functions only used in this file
+static int dpiJson__allocateNodeMemory(dpiJson *json, uint32_t numMembers,
+        size_t memberSize, const char *action, void **ptr, dpiError *error);
+static void dpiJson__resetArena(dpiJson *json, int freeAll);
 static int dpiJsonNode__fromOracleArrayToNative(dpiJson *json,
         dpiJsonNode *node, dpiJznDomDoc *domDoc, void *oracleNode,
         uint32_t options, dpiError *error);
@@ -89,6 +97,40 @@ int dpiJson__allocate(dpiConn *conn, void *handle, dpiJson **json,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson__allocateNodeMemory() [INTERNAL]
+//   Allocate zeroed memory for the native nodes of the JSON value from its
+// arena, adding a new chunk to the arena when the current one is full. The
+// memory is freed all at once, when the arena is reset.
+//-----------------------------------------------------------------------------
+static int dpiJson__allocateNodeMemory(dpiJson *json, uint32_t numMembers,
+        size_t memberSize, const char *action, void **ptr, dpiError *error)
+{
+    dpiJsonArenaChunk *chunk = json->arena;
+    size_t size, chunkSize;
+
+    size = DPI_JSON_ARENA_ALIGN((size_t) numMembers * memberSize);
+    if (!chunk || chunk->size - chunk->used < size) {
+        chunkSize = (chunk) ? chunk->size * 2 : DPI_JSON_ARENA_CHUNK_SIZE;
+        if (chunkSize < size)
+            chunkSize = size;
+        if (dpiUtils__allocateMemory(1,
+                DPI_JSON_ARENA_ALIGN(sizeof(dpiJsonArenaChunk)) + chunkSize, 0,
+                action, (void**) &chunk, error) < 0)
+            return DPI_FAILURE;
+        chunk->next = json->arena;
+        chunk->size = chunkSize;
+        chunk->used = 0;
+        json->arena = chunk;
+    }
+    *ptr = (char*) chunk + DPI_JSON_ARENA_ALIGN(sizeof(dpiJsonArenaChunk)) +
+            chunk->used;
+    chunk->used += size;
+    memset(*ptr, 0, size);
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJsonNode__fromOracleArrayToNative() [INTERNAL]
 //   Populate an array node from the Oracle JSON node.
@@ -115,12 +157,12 @@ static int dpiJsonNode__fromOracleArrayToNative(dpiJson *json,
         return DPI_SUCCESS;
 
     // allocate memory
-    if (dpiUtils__allocateMemory(array->numElements, sizeof(dpiJsonNode), 1,
-            "allocate JSON array element nodes", (void**) &array->elements,
-            error) < 0)
+    if (dpiJson__allocateNodeMemory(json, array->numElements,
+            sizeof(dpiJsonNode), "allocate JSON array element nodes",
+            (void**) &array->elements, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(array->numElements, sizeof(dpiDataBuffer), 1,
-            "allocate JSON array element values",
+    if (dpiJson__allocateNodeMemory(json, array->numElements,
+            sizeof(dpiDataBuffer), "allocate JSON array element values",
             (void**) &array->elementValues, error) < 0)
         return DPI_FAILURE;
 
@@ -169,21 +211,21 @@ static int dpiJsonNode__fromOracleObjectToNative(dpiJson *json,
         return DPI_SUCCESS;
 
     // allocate memory
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(char*), 1,
+    if (dpiJson__allocateNodeMemory(json, obj->numFields, sizeof(char*),
             "allocate JSON object field names", (void**) &obj->fieldNames,
             error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(uint32_t), 1,
+    if (dpiJson__allocateNodeMemory(json, obj->numFields, sizeof(uint32_t),
             "allocate JSON object field name lengths",
             (void**) &obj->fieldNameLengths, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(dpiJsonNode), 1,
-            "allocate JSON object field nodes", (void**) &obj->fields,
-            error) < 0)
+    if (dpiJson__allocateNodeMemory(json, obj->numFields,
+            sizeof(dpiJsonNode), "allocate JSON object field nodes",
+            (void**) &obj->fields, error) < 0)
         return DPI_FAILURE;
-    if (dpiUtils__allocateMemory(obj->numFields, sizeof(dpiDataBuffer), 1,
-            "allocate JSON object field values", (void**) &obj->fieldValues,
-            error) < 0)
+    if (dpiJson__allocateNodeMemory(json, obj->numFields,
+            sizeof(dpiDataBuffer), "allocate JSON object field values",
+            (void**) &obj->fieldValues, error) < 0)
         return DPI_FAILURE;
 
     // process all of the nodes in the object in batches
@@ -209,49 +251,16 @@ static int dpiJsonNode__fromOracleObjectToNative(dpiJson *json,
 
 //-----------------------------------------------------------------------------
 // dpiJsonNode__fromOracleNumberAsText() [INTERNAL]
-//   Populate a scalar number as a text buffer. Temporary buffers are allocated
-// as needed and an array of these are stored in the JSON object. Each
-// temporary buffer contains as many numbers as can be fit before a new
-// temporary buffer is allocated.
+//   Populate a scalar number as a text buffer, allocated from the arena of the
+// JSON value.
 //-----------------------------------------------------------------------------
 static int dpiJsonNode__fromOracleNumberAsText(dpiJson *json,
         dpiJsonNode *node, uint8_t *numBuffer, dpiError *error)
 {
-    char **tempBuffers;
-
-    // if there is no room in the current temporary buffer, allocate a new one
-    if (json->tempBufferUsed + DPI_NUMBER_AS_TEXT_CHARS <
-            DPI_JSON_TEMP_BUFFER_SIZE) {
-
-        // if no room is available in the temp buffer array, increase the size
-        // of the array
-        if (json->numTempBuffers == json->allocatedTempBuffers) {
-            json->allocatedTempBuffers += 16;
-            if (dpiUtils__allocateMemory(json->allocatedTempBuffers,
-                    sizeof(char*), 0, "allocate JSON temp buffer array",
-                    (void**) &tempBuffers, error) < 0)
-                return DPI_FAILURE;
-            if (json->numTempBuffers > 0) {
-                memcpy(tempBuffers, json->tempBuffers,
-                        json->numTempBuffers * sizeof(char*));
-                dpiUtils__freeMemory(json->tempBuffers);
-            }
-            json->tempBuffers = tempBuffers;
-        }
-
-        // allocate a new temporary buffer
-        if (dpiUtils__allocateMemory(1, DPI_JSON_TEMP_BUFFER_SIZE, 0,
-                "allocate JSON temp buffer",
-                (void**) &json->tempBuffers[json->numTempBuffers], error) < 0)
-            return DPI_FAILURE;
-        json->numTempBuffers++;
-        json->tempBufferUsed = 0;
-
-    }
-
-    // perform the conversion
-    node->value->asBytes.ptr = json->tempBuffers[json->numTempBuffers - 1] +
-            json->tempBufferUsed;
+    if (dpiJson__allocateNodeMemory(json, 1, DPI_NUMBER_AS_TEXT_CHARS,
+            "allocate JSON number as text",
+            (void**) &node->value->asBytes.ptr, error) < 0)
+        return DPI_FAILURE;
     node->value->asBytes.length = DPI_NUMBER_AS_TEXT_CHARS;
     return dpiDataBuffer__fromOracleNumberAsText(node->value, json->env,
             error, numBuffer);
@@ -700,56 +709,6 @@ int dpiJson__setValue(dpiJson *json, const dpiJsonNode *topNode,
 }
 
 
-//-----------------------------------------------------------------------------
-// dpiJsonNode__free() [INTERNAL]
-//   Free the buffers allocated for the JSON node.
-//-----------------------------------------------------------------------------
-static void dpiJsonNode__free(dpiJsonNode *node)
-{
-    dpiJsonArray *array;
-    dpiJsonObject *obj;
-    uint32_t i;
-
-    if (node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_ARRAY) {
-        array = &node->value->asJsonArray;
-        if (array->elements) {
-            for (i = 0; i < array->numElements; i++) {
-                if (array->elements[i].value)
-                    dpiJsonNode__free(&array->elements[i]);
-            }
-            dpiUtils__freeMemory(array->elements);
-            array->elements = NULL;
-        }
-        if (array->elementValues) {
-            dpiUtils__freeMemory(array->elementValues);
-            array->elementValues = NULL;
-        }
-    } else if (node->oracleTypeNum == DPI_ORACLE_TYPE_JSON_OBJECT) {
-        obj = &node->value->asJsonObject;
-        if (obj->fields) {
-            for (i = 0; i < obj->numFields; i++) {
-                if (obj->fields[i].value)
-                    dpiJsonNode__free(&obj->fields[i]);
-            }
-            dpiUtils__freeMemory(obj->fields);
-            obj->fields = NULL;
-        }
-        if (obj->fieldNames) {
-            dpiUtils__freeMemory(obj->fieldNames);
-            obj->fieldNames = NULL;
-        }
-        if (obj->fieldNameLengths) {
-            dpiUtils__freeMemory(obj->fieldNameLengths);
-            obj->fieldNameLengths = NULL;
-        }
-        if (obj->fieldValues) {
-            dpiUtils__freeMemory(obj->fieldValues);
-            obj->fieldValues = NULL;
-        }
-    }
-}
-
-
 //-----------------------------------------------------------------------------
 // dpiJson__free() [INTERNAL]
 //   Free the buffers allocated for the JSON value and all of its nodes, if
@@ -757,8 +716,6 @@ static void dpiJsonNode__free(dpiJsonNode *node)
 //-----------------------------------------------------------------------------
 void dpiJson__free(dpiJson *json, dpiError *error)
 {
-    uint32_t i;
-
     if (json->handle && json->handleIsOwned) {
         dpiOci__descriptorFree(json->handle, DPI_OCI_DTYPE_JSON);
         json->handle = NULL;
@@ -767,12 +724,6 @@ void dpiJson__free(dpiJson *json, dpiError *error)
         dpiGen__setRefCount(json->conn, error, -1);
         json->conn = NULL;
     }
-    if (json->tempBuffers) {
-        for (i = 0; i < json->numTempBuffers; i++)
-            dpiUtils__freeMemory(json->tempBuffers[i]);
-        dpiUtils__freeMemory(json->tempBuffers);
-        json->tempBuffers = NULL;
-    }
     if (json->convTimestamp) {
         dpiOci__descriptorFree(json->convTimestamp, DPI_OCI_DTYPE_TIMESTAMP);
         json->convTimestamp = NULL;
@@ -787,11 +738,38 @@ void dpiJson__free(dpiJson *json, dpiError *error)
                 DPI_OCI_DTYPE_INTERVAL_YM);
         json->convIntervalYM = NULL;
     }
-    dpiJsonNode__free(&json->topNode);
+    dpiJson__resetArena(json, 1);
     dpiUtils__freeMemory(json);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson__resetArena() [INTERNAL]
+//   Free the memory allocated for the native nodes of the JSON value. All of
+// the chunks are freed if requested; otherwise the last (largest) one is kept
+// for reuse.
+//-----------------------------------------------------------------------------
+static void dpiJson__resetArena(dpiJson *json, int freeAll)
+{
+    dpiJsonArenaChunk *chunk, *next;
+
+    if (!json->arena)
+        return;
+    chunk = (freeAll) ? json->arena : json->arena->next;
+    while (chunk) {
+        next = chunk->next;
+        dpiUtils__freeMemory(chunk);
+        chunk = next;
+    }
+    if (freeAll) {
+        json->arena = NULL;
+    } else {
+        json->arena->next = NULL;
+        json->arena->used = 0;
+    }
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson_addRef() [PUBLIC]
 //   Add a reference to the JSON object.
@@ -814,7 +792,7 @@ int dpiJson_getValue(dpiJson *json, uint32_t options, dpiJsonNode **topNode)
 
     if (dpiGen__startPublicFn(json, DPI_HTYPE_JSON, __func__, &error) < 0)
         return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
-    dpiJsonNode__free(&json->topNode);
+    dpiJson__resetArena(json, 0);
     json->topNode.value = &json->topNodeBuffer;
     json->topNode.oracleTypeNum = DPI_ORACLE_TYPE_NONE;
     json->topNode.nativeTypeNum = DPI_NATIVE_TYPE_NULL;
@@ -832,6 +810,75 @@ int dpiJson_getValue(dpiJson *json, uint32_t options, dpiJsonNode **topNode)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiJson_getValueAtPath() [PUBLIC]
+//   Gets the node of the JSON value found by following the given steps from
+// the top level node; only this node (and its descendants) are decoded. If no
+// such node exists, NULL is returned. The node remains valid until the JSON
+// value is released or dpiJson_getValue() is called.
+//-----------------------------------------------------------------------------
+int dpiJson_getValueAtPath(dpiJson *json, uint32_t options,
+        uint32_t numSteps, const dpiJsonPathStep *steps, dpiJsonNode **node)
+{
+    dpiJsonNode *tempNode;
+    dpiJznDomDoc *domDoc;
+    void *oracleNode;
+    dpiError error;
+    uint32_t i;
+    int status;
+
+    if (dpiGen__startPublicFn(json, DPI_HTYPE_JSON, __func__, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(json, node)
+    if (numSteps > 0) {
+        DPI_CHECK_PTR_NOT_NULL(json, steps)
+    }
+    *node = NULL;
+    if (dpiOci__jsonDomDocGet(json, &domDoc, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    if (!domDoc)
+        return dpiGen__endPublicFn(json, DPI_SUCCESS, &error);
+
+    // navigate to the node, without decoding the nodes on the way
+    oracleNode = (*domDoc->methods->fnGetRootNode)(domDoc);
+    for (i = 0; i < numSteps && oracleNode; i++) {
+        if (steps[i].name) {
+            if ((*domDoc->methods->fnGetNodeType)(domDoc, oracleNode) !=
+                    DPI_JZNDOM_OBJECT || steps[i].nameLength > UINT16_MAX) {
+                oracleNode = NULL;
+            } else {
+                oracleNode = (*domDoc->methods->fnGetFieldByName)(domDoc,
+                        oracleNode, steps[i].name,
+                        (uint16_t) steps[i].nameLength);
+            }
+        } else if ((*domDoc->methods->fnGetNodeType)(domDoc, oracleNode) !=
+                DPI_JZNDOM_ARRAY || steps[i].index >=
+                (*domDoc->methods->fnGetArraySize)(domDoc, oracleNode)) {
+            oracleNode = NULL;
+        } else {
+            oracleNode = (*domDoc->methods->fnGetArrayElem)(domDoc,
+                    oracleNode, steps[i].index);
+        }
+    }
+    if (!oracleNode)
+        return dpiGen__endPublicFn(json, DPI_SUCCESS, &error);
+
+    // decode the node found into the arena
+    if (dpiJson__allocateNodeMemory(json, 1, sizeof(dpiJsonNode),
+            "allocate JSON path node", (void**) &tempNode, &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    if (dpiJson__allocateNodeMemory(json, 1, sizeof(dpiDataBuffer),
+            "allocate JSON path node value", (void**) &tempNode->value,
+            &error) < 0)
+        return dpiGen__endPublicFn(json, DPI_FAILURE, &error);
+    status = dpiJsonNode__fromOracleToNative(json, tempNode, domDoc,
+            oracleNode, options, &error);
+    if (status == DPI_SUCCESS)
+        *node = tempNode;
+    return dpiGen__endPublicFn(json, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiJson_release() [PUBLIC]
 //   Release a reference to the JSON object.
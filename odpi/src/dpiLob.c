@@ -103,6 +103,9 @@ int dpiLob__close(dpiLob *lob, int propagateErrors, dpiError *error)
     // perform actual work of closing LOB
     if (lob->locator) {
         if (!lob->conn->deadSession && lob->conn->handle) {
+            if (lob->isResourceOpen &&
+                    dpiOci__lobClose(lob, error) == DPI_SUCCESS)
+                lob->isResourceOpen = 0;
             status = dpiOci__lobIsTemporary(lob, &isTemporary, propagateErrors,
                     error);
             if (isTemporary && status == DPI_SUCCESS)
@@ -149,6 +152,34 @@ void dpiLob__free(dpiLob *lob, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiLob__prepareReuse() [INTERNAL]
+//   Prepares a LOB of a fetch buffer to be fetched into again, which is only
+// possible if no one but the variable holds a reference to it. The temporary
+// LOB of the previous fetch (if any) is freed. Returns whether the LOB can be
+// reused; if not, it must be released and a new one allocated.
+//-----------------------------------------------------------------------------
+int dpiLob__prepareReuse(dpiLob *lob, dpiError *error)
+{
+    int isTemporary;
+
+    if (dpiAtomic__load(&lob->refCount) != 1 || lob->closing ||
+            !lob->locator || lob->isResourceOpen || lob->conn->deadSession ||
+            !lob->conn->handle)
+        return 0;
+    if (dpiOci__lobIsTemporary(lob, &isTemporary, 0, error) < 0)
+        return 0;
+    if (isTemporary && dpiOci__lobFreeTemporary(lob->conn, lob->locator, 0,
+            error) < 0)
+        return 0;
+    if (lob->buffer) {
+        dpiUtils__freeMemory(lob->buffer);
+        lob->buffer = NULL;
+    }
+    return 1;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiLob__readBytes() [INTERNAL]
 //   Return a portion (or all) of the data in the LOB.
@@ -164,9 +195,11 @@ int dpiLob__readBytes(dpiLob *lob, uint64_t offset, uint64_t amount,
         lengthInChars = amount;
     else lengthInBytes = amount;
 
-    // for files, open the file if needed
+    // for files, open the file if needed; files opened explicitly with
+    // dpiLob_openResource() are known to be open, which avoids a round trip
     if (lob->type->oracleTypeNum == DPI_ORACLE_TYPE_BFILE) {
-        if (dpiOci__lobIsOpen(lob, &isOpen, error) < 0)
+        isOpen = lob->isResourceOpen;
+        if (!isOpen && dpiOci__lobIsOpen(lob, &isOpen, error) < 0)
             return DPI_FAILURE;
         if (!isOpen) {
             if (dpiOci__lobOpen(lob, error) < 0)
@@ -243,6 +276,8 @@ int dpiLob_closeResource(dpiLob *lob)
     if (dpiLob__check(lob, __func__, &error) < 0)
         return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
     status = dpiOci__lobClose(lob, &error);
+    if (status == DPI_SUCCESS)
+        lob->isResourceOpen = 0;
     return dpiGen__endPublicFn(lob, status, &error);
 }
 
@@ -428,6 +463,8 @@ int dpiLob_openResource(dpiLob *lob)
     if (dpiLob__check(lob, __func__, &error) < 0)
         return dpiGen__endPublicFn(lob, DPI_FAILURE, &error);
     status = dpiOci__lobOpen(lob, &error);
+    if (status == DPI_SUCCESS)
+        lob->isResourceOpen = 1;
     return dpiGen__endPublicFn(lob, status, &error);
 }
 
@@ -30,7 +30,14 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static void dpiObject__clearOracleValue(dpiObject *obj, dpiError *error,
+        dpiOracleDataBuffer *buffer, dpiLob *lob,
+        dpiOracleTypeNum oracleTypeNum);
 int dpiObject__closeHelper(dpiObject *obj, int checkError, dpiError *error);
+static int dpiObject__toOracleValue(dpiObject *obj, dpiError *error,
+        const dpiDataTypeInfo *dataTypeInfo, dpiOracleDataBuffer *buffer,
+        dpiLob **lob, void **ociValue, int16_t *valueIndicator,
+        void **objectIndicator, dpiNativeTypeNum nativeTypeNum, dpiData *data);
 
 
 //-----------------------------------------------------------------------------
@@ -76,6 +83,35 @@ int dpiObject__allocate(dpiObjectType *objType, void *instance,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject__appendElement() [INTERNAL]
+//   Append an element to the collection.
+//-----------------------------------------------------------------------------
+static int dpiObject__appendElement(dpiObject *obj,
+        dpiNativeTypeNum nativeTypeNum, dpiData *data, dpiError *error)
+{
+    dpiOracleDataBuffer valueBuffer;
+    int16_t scalarValueIndicator;
+    dpiLob *lob = NULL;
+    void *indicator;
+    void *ociValue;
+    int status;
+
+    status = dpiObject__toOracleValue(obj, error, &obj->type->elementTypeInfo,
+            &valueBuffer, &lob, &ociValue, &scalarValueIndicator,
+            (void**) &indicator, nativeTypeNum, data);
+    if (status == DPI_SUCCESS) {
+        if (!indicator)
+            indicator = &scalarValueIndicator;
+        status = dpiOci__collAppend(obj->type->conn, ociValue, indicator,
+                obj->instance, error);
+    }
+    dpiObject__clearOracleValue(obj, error, &valueBuffer, lob,
+            obj->type->elementTypeInfo.oracleTypeNum);
+    return status;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject__check() [INTERNAL]
 //   Determine if the object handle provided is available for use.
@@ -404,6 +440,85 @@ static int dpiObject__fromOracleValue(dpiObject *obj, dpiError *error,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject__getAttributeValue() [INTERNAL]
+//   Return the value of the attribute of the object, after the object has been
+// checked.
+//-----------------------------------------------------------------------------
+static int dpiObject__getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
+        dpiNativeTypeNum nativeTypeNum, dpiData *data, dpiError *error)
+{
+    int16_t scalarValueIndicator;
+    void *valueIndicator, *tdo;
+    dpiOracleData value;
+
+    // validate attribute
+    if (dpiGen__checkHandle(attr, DPI_HTYPE_OBJECT_ATTR, "get attribute value",
+            error) < 0)
+        return DPI_FAILURE;
+    if (attr->belongsToType->tdo != obj->type->tdo)
+        return dpiError__set(error, "get attribute value", DPI_ERR_WRONG_ATTR,
+                attr->nameLength, attr->name, obj->type->schemaLength,
+                obj->type->schema, obj->type->nameLength, obj->type->name);
+
+    // get attribute value
+    if (dpiOci__objectGetAttr(obj, attr, &scalarValueIndicator,
+            &valueIndicator, &value.asRaw, &tdo, error) < 0)
+        return DPI_FAILURE;
+
+    // determine the proper null indicator
+    if (!valueIndicator)
+        valueIndicator = &scalarValueIndicator;
+
+    // check to see if type is supported
+    if (!attr->typeInfo.oracleTypeNum)
+        return dpiError__set(error, "get attribute value",
+                DPI_ERR_UNHANDLED_DATA_TYPE, attr->typeInfo.ociTypeCode);
+
+    // convert to output data format
+    return dpiObject__fromOracleValue(obj, error, &attr->typeInfo, &value,
+            (int16_t*) valueIndicator, nativeTypeNum, data);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiObject__setArrayValue() [INTERNAL]
+//   Convert the element into the pos-th entry of the array of native values
+// (and of null indicators, if given), as used by dpiObject_getElementArray().
+//-----------------------------------------------------------------------------
+static int dpiObject__setArrayValue(dpiObject *obj, void *elem,
+        int16_t *indicator, dpiNativeTypeNum nativeTypeNum, void *values,
+        int8_t *nullIndicators, uint32_t pos, dpiError *error)
+{
+    dpiOracleData value;
+    dpiData data;
+
+    value.asRaw = elem;
+    if (dpiObject__fromOracleValue(obj, error, &obj->type->elementTypeInfo,
+            &value, indicator, nativeTypeNum, &data) < 0)
+        return DPI_FAILURE;
+    if (nullIndicators)
+        nullIndicators[pos] = (int8_t) data.isNull;
+    if (data.isNull)
+        memset(&data.value, 0, sizeof(data.value));
+    switch (nativeTypeNum) {
+        case DPI_NATIVE_TYPE_INT64:
+            ((int64_t*) values)[pos] = data.value.asInt64;
+            break;
+        case DPI_NATIVE_TYPE_UINT64:
+            ((uint64_t*) values)[pos] = data.value.asUint64;
+            break;
+        case DPI_NATIVE_TYPE_FLOAT:
+            ((float*) values)[pos] = data.value.asFloat;
+            break;
+        default:
+            ((double*) values)[pos] = data.value.asDouble;
+            break;
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject__toOracleValue() [INTERNAL]
 //   Convert value from external type to the OCI data type required.
@@ -602,32 +717,41 @@ int dpiObject_addRef(dpiObject *obj)
 int dpiObject_appendElement(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
         dpiData *data)
 {
-    dpiOracleDataBuffer valueBuffer;
-    int16_t scalarValueIndicator;
-    dpiLob *lob = NULL;
-    void *indicator;
     dpiError error;
-    void *ociValue;
     int status;
 
     if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
         return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
     DPI_CHECK_PTR_NOT_NULL(obj, data)
-    status = dpiObject__toOracleValue(obj, &error, &obj->type->elementTypeInfo,
-            &valueBuffer, &lob, &ociValue, &scalarValueIndicator,
-            (void**) &indicator, nativeTypeNum, data);
-    if (status == DPI_SUCCESS) {
-        if (!indicator)
-            indicator = &scalarValueIndicator;
-        status = dpiOci__collAppend(obj->type->conn, ociValue, indicator,
-                obj->instance, &error);
-    }
-    dpiObject__clearOracleValue(obj, &error, &valueBuffer, lob,
-            obj->type->elementTypeInfo.oracleTypeNum);
+    status = dpiObject__appendElement(obj, nativeTypeNum, data, &error);
     return dpiGen__endPublicFn(obj, status, &error);
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject_appendElements() [PUBLIC]
+//   Append the elements to the collection, stopping at the first failure.
+//-----------------------------------------------------------------------------
+int dpiObject_appendElements(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
+        uint32_t numElements, dpiData *data)
+{
+    dpiError error;
+    uint32_t i;
+
+    if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    if (numElements > 0) {
+        DPI_CHECK_PTR_NOT_NULL(obj, data)
+    }
+    for (i = 0; i < numElements; i++) {
+        if (dpiObject__appendElement(obj, nativeTypeNum, &data[i],
+                &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    }
+    return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject_copy() [PUBLIC]
 //   Create a copy of the object and return it. Return NULL upon error.
@@ -670,51 +794,150 @@ int dpiObject_deleteElementByIndex(dpiObject *obj, int32_t index)
 
 //-----------------------------------------------------------------------------
 // dpiObject_getAttributeValue() [PUBLIC]
-//   Get the value of the given attribute from the object.
+//   Return the value of the attribute.
 //-----------------------------------------------------------------------------
 int dpiObject_getAttributeValue(dpiObject *obj, dpiObjectAttr *attr,
         dpiNativeTypeNum nativeTypeNum, dpiData *data)
 {
-    int16_t scalarValueIndicator;
-    void *valueIndicator, *tdo;
-    dpiOracleData value;
     dpiError error;
     int status;
 
-    // validate parameters
     if (dpiObject__check(obj, __func__, &error) < 0)
         return DPI_FAILURE;
     DPI_CHECK_PTR_NOT_NULL(obj, data)
-    if (dpiGen__checkHandle(attr, DPI_HTYPE_OBJECT_ATTR, "get attribute value",
-            &error) < 0)
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
-    if (attr->belongsToType->tdo != obj->type->tdo) {
-        dpiError__set(&error, "get attribute value", DPI_ERR_WRONG_ATTR,
-                attr->nameLength, attr->name, obj->type->schemaLength,
-                obj->type->schema, obj->type->nameLength, obj->type->name);
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    status = dpiObject__getAttributeValue(obj, attr, nativeTypeNum, data,
+            &error);
+    return dpiGen__endPublicFn(obj, status, &error);
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiObject_getAttributeValues() [PUBLIC]
+//   Return the values of the specified attributes in one call. The arrays of
+// attributes, native types and data must all contain numAttrs elements. As
+// with dpiObject_getAttributeValue(), the buffers of NUMBER values returned as
+// bytes must be supplied in the data. Processing stops at the first failure.
+//-----------------------------------------------------------------------------
+int dpiObject_getAttributeValues(dpiObject *obj, uint32_t numAttrs,
+        dpiObjectAttr **attrs, const dpiNativeTypeNum *nativeTypeNums,
+        dpiData *data)
+{
+    dpiError error;
+    uint32_t i;
+
+    if (dpiObject__check(obj, __func__, &error) < 0)
+        return DPI_FAILURE;
+    if (numAttrs > 0) {
+        DPI_CHECK_PTR_NOT_NULL(obj, attrs)
+        DPI_CHECK_PTR_NOT_NULL(obj, nativeTypeNums)
+        DPI_CHECK_PTR_NOT_NULL(obj, data)
+    }
+    for (i = 0; i < numAttrs; i++) {
+        if (dpiObject__getAttributeValue(obj, attrs[i], nativeTypeNums[i],
+                &data[i], &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
     }
+    return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+}
 
-    // get attribute value
-    if (dpiOci__objectGetAttr(obj, attr, &scalarValueIndicator,
-            &valueIndicator, &value.asRaw, &tdo, &error) < 0)
-        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
 
-    // determine the proper null indicator
-    if (!valueIndicator)
-        valueIndicator = &scalarValueIndicator;
+//-----------------------------------------------------------------------------
+// dpiObject_getElementArray() [PUBLIC]
+//   Get the values of at most maxElements elements of a collection (in index
+// order) into the contiguous array of native values (int64_t, uint64_t, float
+// or double, according to the native type), with the number of elements
+// placed in numElements. If nullIndicators is not NULL, it is set to 1 for the
+// null elements (whose values are set to zero). Varrays and nested tables
+// whose indexes are contiguous (without deleted elements) are got with
+// OCICollGetElemArray(), in batches.
+//-----------------------------------------------------------------------------
+int dpiObject_getElementArray(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
+        uint32_t maxElements, void *values, int8_t *nullIndicators,
+        uint32_t *numElements)
+{
+    void *elems[DPI_OBJECT_ELEMENT_BATCH_SIZE];
+    void *inds[DPI_OBJECT_ELEMENT_BATCH_SIZE];
+    int32_t index, lastIndex, size;
+    uint32_t i, batchSize;
+    dpiError error;
+    int exists;
 
-    // check to see if type is supported
-    if (!attr->typeInfo.oracleTypeNum) {
-        dpiError__set(&error, "get attribute value",
-                DPI_ERR_UNHANDLED_DATA_TYPE, attr->typeInfo.ociTypeCode);
+    if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
         return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(obj, numElements)
+    if (maxElements > 0) {
+        DPI_CHECK_PTR_NOT_NULL(obj, values)
+    }
+    *numElements = 0;
+    switch (nativeTypeNum) {
+        case DPI_NATIVE_TYPE_INT64:
+        case DPI_NATIVE_TYPE_UINT64:
+        case DPI_NATIVE_TYPE_FLOAT:
+        case DPI_NATIVE_TYPE_DOUBLE:
+            break;
+        default:
+            dpiError__set(&error, "check native type",
+                    DPI_ERR_UNHANDLED_CONVERSION,
+                    obj->type->elementTypeInfo.oracleTypeNum, nativeTypeNum);
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
     }
+    if (dpiOci__tableSize(obj, &size, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    if (size == 0 || maxElements == 0)
+        return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+    if (dpiOci__tableFirst(obj, &index, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    if (dpiOci__tableLast(obj, &lastIndex, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
 
-    // convert to output data format
-    status = dpiObject__fromOracleValue(obj, &error, &attr->typeInfo, &value,
-            (int16_t*) valueIndicator, nativeTypeNum, data);
-    return dpiGen__endPublicFn(obj, status, &error);
+    // the elements of varrays and nested tables without deleted elements have
+    // contiguous indexes; PL/SQL index-by tables are keyed by any integers
+    if ((obj->type->collectionTypeCode == DPI_OCI_TYPECODE_VARRAY ||
+            obj->type->collectionTypeCode == DPI_OCI_TYPECODE_TABLE) &&
+            (int64_t) lastIndex - index + 1 == size) {
+        while (*numElements < maxElements &&
+                *numElements < (uint32_t) size) {
+            batchSize = maxElements - *numElements;
+            if (batchSize > DPI_OBJECT_ELEMENT_BATCH_SIZE)
+                batchSize = DPI_OBJECT_ELEMENT_BATCH_SIZE;
+            if (dpiOci__collGetElemArray(obj->type->conn, obj->instance,
+                    index + (int32_t) *numElements, &exists, elems, inds,
+                    &batchSize, &error) < 0)
+                return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+            if (!exists || batchSize == 0)
+                break;
+            for (i = 0; i < batchSize; i++, (*numElements)++) {
+                if (dpiObject__setArrayValue(obj, elems[i],
+                        (int16_t*) inds[i], nativeTypeNum, values,
+                        nullIndicators, *numElements, &error) < 0)
+                    return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+            }
+        }
+        return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+    }
+
+    // otherwise, the elements are got one by one, in index order
+    while (1) {
+        if (dpiOci__collGetElem(obj->type->conn, obj->instance, index,
+                &exists, &elems[0], &inds[0], &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (!exists) {
+            dpiError__set(&error, "get element value", DPI_ERR_INVALID_INDEX,
+                    index);
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        }
+        if (dpiObject__setArrayValue(obj, elems[0], (int16_t*) inds[0],
+                nativeTypeNum, values, nullIndicators, *numElements,
+                &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (++(*numElements) == maxElements)
+            break;
+        if (dpiOci__tableNext(obj, index, &index, &exists, &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (!exists)
+            break;
+    }
+    return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
 }
 
 
@@ -767,6 +990,59 @@ int dpiObject_getElementValueByIndex(dpiObject *obj, int32_t index,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiObject_getElementValues() [PUBLIC]
+//   Return the values of the elements of the collection in index order, in
+// one call. At most maxElements values are returned; the number returned is
+// placed in numElements. As with dpiObject_getElementValueByIndex(), the
+// buffers of NUMBER values returned as bytes must be supplied in the data.
+//-----------------------------------------------------------------------------
+int dpiObject_getElementValues(dpiObject *obj, dpiNativeTypeNum nativeTypeNum,
+        uint32_t maxElements, dpiData *data, uint32_t *numElements)
+{
+    int32_t index, size;
+    dpiOracleData value;
+    void *indicator;
+    dpiError error;
+    int exists;
+
+    if (dpiObject__checkIsCollection(obj, __func__, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(obj, numElements)
+    if (maxElements > 0) {
+        DPI_CHECK_PTR_NOT_NULL(obj, data)
+    }
+    *numElements = 0;
+    if (dpiOci__tableSize(obj, &size, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    if (size == 0 || maxElements == 0)
+        return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+    if (dpiOci__tableFirst(obj, &index, &error) < 0)
+        return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+    while (1) {
+        if (dpiOci__collGetElem(obj->type->conn, obj->instance, index,
+                &exists, &value.asRaw, &indicator, &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (!exists) {
+            dpiError__set(&error, "get element value", DPI_ERR_INVALID_INDEX,
+                    index);
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        }
+        if (dpiObject__fromOracleValue(obj, &error,
+                &obj->type->elementTypeInfo, &value, (int16_t*) indicator,
+                nativeTypeNum, &data[*numElements]) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (++(*numElements) == maxElements)
+            break;
+        if (dpiOci__tableNext(obj, index, &index, &exists, &error) < 0)
+            return dpiGen__endPublicFn(obj, DPI_FAILURE, &error);
+        if (!exists)
+            break;
+    }
+    return dpiGen__endPublicFn(obj, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiObject_getFirstIndex() [PUBLIC]
 //   Return the index of the first entry in the collection.
@@ -135,6 +135,14 @@ static int dpiObjectType__describe(dpiObjectType *objType,
     if (typeCode == DPI_SQLT_NCO) {
         objType->isCollection = 1;
 
+        // determine the kind of collection (varray, nested table or PL/SQL
+        // index-by table)
+        if (dpiOci__attrGet(param, DPI_OCI_DTYPE_PARAM,
+                &objType->collectionTypeCode, 0,
+                DPI_OCI_ATTR_COLLECTION_TYPECODE, "get collection type code",
+                error) < 0)
+            return DPI_FAILURE;
+
         // acquire collection parameter descriptor
         if (dpiOci__attrGet(param, DPI_OCI_DTYPE_PARAM, &collectionParam, 0,
                 DPI_OCI_ATTR_COLLECTION_ELEMENT, "get collection descriptor",
@@ -55,15 +55,24 @@ static void dpiOci__freeMem(void *unused, void *ptr);
 static int dpiOci__loadLibValidate(dpiContextCreateParams *params,
         dpiOciLoadLibParams *loadParams, dpiVersionInfo *versionInfo,
         dpiError *error);
+#ifndef DPI_MOCK_OCI
 static int dpiOci__loadLibWithDir(dpiOciLoadLibParams *loadParams,
         const char *dirName, size_t dirNameLength, int scanAllNames,
         dpiError *error);
 static int dpiOci__loadLibWithName(dpiOciLoadLibParams *loadParams,
         const char *libName, dpiError *error);
+#endif
 static int dpiOci__loadSymbol(const char *symbolName, void **symbol,
         dpiError *error);
 static void *dpiOci__reallocMem(void *unused, void *ptr, size_t newSize);
 
+#ifdef DPI_MOCK_OCI
+// in-memory OCI library used for benchmarking without a database (defined by
+// the embedding application); returns the implementation of the named
+// function or NULL if it is not mocked
+void *godrorMockOCISymbol(const char *symbolName);
+#endif
+
 
 // macro to simplify code for loading each symbol
 #define DPI_OCI_LOAD_SYMBOL(symbolName, symbol) \
@@ -151,6 +160,9 @@ typedef int (*dpiOciFnType__collAssignElem)(void *env, void *err,
 typedef int (*dpiOciFnType__collGetElem)(void *env, void *err,
         const void *coll, int32_t index, int *exists, void **elem,
         void **elemind);
+typedef int (*dpiOciFnType__collGetElemArray)(void *env, void *err,
+        const void *coll, int32_t index, int *exists, void **elem,
+        void **elemind, unsigned int *nelems);
 typedef int (*dpiOciFnType__collSize)(void *env, void *err, const void *coll,
         int32_t *size);
 typedef int (*dpiOciFnType__collTrim)(void *env, void *err, int32_t trim_num,
@@ -506,6 +518,7 @@ typedef int (*dpiOciFnType__vectorToSparseArray)(void *vectord, void *errhp,
 // library handle for dynamically loaded OCI library
 static void *dpiOciLibHandle = NULL;
 
+#ifndef DPI_MOCK_OCI
 // library names to search
 static const char *dpiOciLibNames[] = {
 #if defined _WIN32 || defined __CYGWIN__
@@ -529,6 +542,7 @@ static const char *dpiOciLibNames[] = {
 #endif
     NULL
 };
+#endif
 
 // subdirectory for configuration directory
 static const char *dpiOciConfigSubDir = "network/admin";
@@ -554,6 +568,7 @@ static struct {
     dpiOciFnType__collAppend fnCollAppend;
     dpiOciFnType__collAssignElem fnCollAssignElem;
     dpiOciFnType__collGetElem fnCollGetElem;
+    dpiOciFnType__collGetElemArray fnCollGetElemArray;
     dpiOciFnType__collSize fnCollSize;
     dpiOciFnType__collTrim fnCollTrim;
     dpiOciFnType__contextGetValue fnContextGetValue;
@@ -1086,6 +1101,28 @@ int dpiOci__collGetElem(dpiConn *conn, void *coll, int32_t index, int *exists,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__collGetElemArray() [INTERNAL]
+//   Wrapper for OCICollGetElemArray().
+//-----------------------------------------------------------------------------
+int dpiOci__collGetElemArray(dpiConn *conn, void *coll, int32_t index,
+        int *exists, void **elems, void **elemInds, uint32_t *numElems,
+        dpiError *error)
+{
+    unsigned int ociNumElems = *numElems;
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCICollGetElemArray",
+            dpiOciSymbols.fnCollGetElemArray)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnCollGetElemArray)(conn->env->handle,
+            error->handle, coll, index, exists, elems, elemInds,
+            &ociNumElems);
+    *numElems = ociNumElems;
+    DPI_OCI_CHECK_AND_RETURN(error, status, conn, "get element array");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__collSize() [INTERNAL]
 //   Wrapper for OCICollSize().
@@ -1692,6 +1729,7 @@ int dpiOci__jsonTextBufferParse(dpiJson *json, const char *value,
 
 #ifdef _WIN32
 
+#ifndef DPI_MOCK_OCI
 //-----------------------------------------------------------------------------
 // dpiOci__checkDllArchitecture() [INTERNAL]
 //   Check the architecture of the specified DLL name and check if it
@@ -1740,6 +1778,7 @@ static int dpiOci__checkDllArchitecture(dpiOciLoadLibParams *loadParams,
     sprintf(loadParams->errorBuffer, errorFormat, name);
     return DPI_SUCCESS;
 }
+#endif
 
 
 //-----------------------------------------------------------------------------
@@ -1828,6 +1867,7 @@ static int dpiOci__getModuleDir(void *fn, const char *moduleType,
 }
 
 
+#ifndef DPI_MOCK_OCI
 //-----------------------------------------------------------------------------
 // dpiOci__findAndCheckDllArchitecture() [INTERNAL]
 //   Attempt to find the specified DLL name using the standard search path and
@@ -1924,6 +1964,7 @@ static int dpiOci__loadLibWithName(dpiOciLoadLibParams *loadParams,
     return dpiUtils__getWindowsError(errorNum, &loadParams->errorBuffer,
             &loadParams->errorBufferLength, error);
 }
+#endif
 
 
 // for platforms other than Windows
@@ -1974,6 +2015,7 @@ static int dpiOci__getModuleDir(void *fn, const char *moduleType,
 }
 
 
+#ifndef DPI_MOCK_OCI
 //-----------------------------------------------------------------------------
 // dpiOci__loadLibWithName() [INTERNAL]
 //   Platform specific method of loading the library with a specific name.
@@ -2036,6 +2078,7 @@ static int dpiOci__loadLibWithOracleHome(dpiOciLoadLibParams *loadParams,
     dpiUtils__freeMemory(oracleHomeLibDir);
     return status;
 }
+#endif
 
 #endif
 
@@ -2085,6 +2128,7 @@ static void dpiOci__calculateConfigDir(dpiOciLoadLibParams *loadParams)
 }
 
 
+#ifndef DPI_MOCK_OCI
 //-----------------------------------------------------------------------------
 // dpiOci__loadLibWithDir() [INTERNAL]
 //   Helper function for loading the OCI library. If a directory is specified,
@@ -2157,6 +2201,7 @@ static int dpiOci__loadLibWithDir(dpiOciLoadLibParams *loadParams,
     // no attempts were successful
     return DPI_FAILURE;
 }
+#endif
 
 
 //-----------------------------------------------------------------------------
@@ -2229,6 +2274,10 @@ int dpiOci__loadLib(dpiContextCreateParams *params,
     memset(&loadLibParams, 0, sizeof(loadLibParams));
     loadLibParams.configDir = configDir;
 
+#ifdef DPI_MOCK_OCI
+    // the mock OCI library is linked in, so there is nothing to load
+    status = DPI_SUCCESS;
+#else
     // if a lib directory was specified in the create params, look for the OCI
     // library in that location only
     if (params->oracleClientLibDir) {
@@ -2270,6 +2319,7 @@ int dpiOci__loadLib(dpiContextCreateParams *params,
 #endif
 
     }
+#endif
 
     // if no attempts succeeded and no other error was reported, craft the
     // error message that will be returned
@@ -2388,7 +2438,9 @@ static int dpiOci__loadLibValidate(dpiContextCreateParams *params,
 static int dpiOci__loadSymbol(const char *symbolName, void **symbol,
         dpiError *error)
 {
-#ifdef _WIN32
+#if defined DPI_MOCK_OCI
+    *symbol = godrorMockOCISymbol(symbolName);
+#elif defined _WIN32
     *symbol = GetProcAddress(dpiOciLibHandle, symbolName);
 #else
     *symbol = dlsym(dpiOciLibHandle, symbolName);
@@ -4540,6 +4592,25 @@ int dpiOci__vectorToArray(dpiVector *vector, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiOci__vectorToArrayBuffer() [INTERNAL]
+//   Wrapper for OCIVectorToArray() which converts the vector into the given
+// format and places the dimensions in the buffer supplied by the caller,
+// bypassing the dimensions cached in the vector.
+//-----------------------------------------------------------------------------
+int dpiOci__vectorToArrayBuffer(dpiVector *vector, uint8_t format,
+        uint32_t *numDimensions, void *buffer, dpiError *error)
+{
+    int status;
+
+    DPI_OCI_LOAD_SYMBOL("OCIVectorToArray", dpiOciSymbols.fnVectorToArray)
+    DPI_OCI_ENSURE_ERROR_HANDLE(error)
+    status = (*dpiOciSymbols.fnVectorToArray)(vector->handle, error->handle,
+            format, numDimensions, buffer, DPI_OCI_DEFAULT);
+    DPI_OCI_CHECK_AND_RETURN(error, status, vector->conn, "vector to array");
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiOci__vectorToSparseArray() [INTERNAL]
 //   Wrapper for OCIVectorToSparseArray().
@@ -82,6 +82,36 @@ int dpiQueue__allocate(dpiConn *conn, const char *name, uint32_t nameLength,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiQueue__acquireJsonPayload() [INTERNAL]
+//   Acquire a JSON payload object for the specified buffer position. The queue
+// keeps a reference to the JSON payload objects it creates; when that is the
+// only reference left (the message properties that used it have been
+// released), the object and its OCI descriptor are reused instead of
+// allocating new ones for every dequeue.
+//-----------------------------------------------------------------------------
+static int dpiQueue__acquireJsonPayload(dpiQueue *queue, uint32_t pos,
+        dpiJson **json, dpiError *error)
+{
+    dpiJson *pooled = queue->buffer.jsonPayloads[pos];
+
+    if (pooled) {
+        if (dpiAtomic__load(&pooled->refCount) == 1) {
+            dpiGen__setRefCount(pooled, error, 1);
+            *json = pooled;
+            return DPI_SUCCESS;
+        }
+        queue->buffer.jsonPayloads[pos] = NULL;
+        dpiGen__setRefCount(pooled, error, -1);
+    }
+    if (dpiJson__allocate(queue->conn, NULL, json, error) < 0)
+        return DPI_FAILURE;
+    dpiGen__setRefCount(*json, error, 1);
+    queue->buffer.jsonPayloads[pos] = *json;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiQueue__allocateBuffer() [INTERNAL]
 //   Ensure there is enough space in the buffer for the specified number of
@@ -118,6 +148,12 @@ static int dpiQueue__allocateBuffer(dpiQueue *queue, uint32_t numElements,
             "allocate message ids array", (void**) &queue->buffer.msgIds,
             error) < 0)
         return DPI_FAILURE;
+    if (queue->isJson) {
+        if (dpiUtils__allocateMemory(numElements, sizeof(dpiJson*), 1,
+                "allocate JSON payloads array",
+                (void**) &queue->buffer.jsonPayloads, error) < 0)
+            return DPI_FAILURE;
+    }
 
     return DPI_SUCCESS;
 }
@@ -220,12 +256,11 @@ static int dpiQueue__deq(dpiQueue *queue, uint32_t *numProps,
                 &prop->payloadObj, error) < 0)
             return DPI_FAILURE;
 
-        // create JSON payload object, if applicable
-        if (queue->isJson) {
-            if (dpiJson__allocate(queue->conn, NULL, &prop->payloadJson,
-                    error) < 0)
-                return DPI_FAILURE;
-        }
+        // acquire JSON payload object, if applicable
+        if (queue->isJson && !prop->payloadJson &&
+                dpiQueue__acquireJsonPayload(queue, i, &prop->payloadJson,
+                error) < 0)
+            return DPI_FAILURE;
 
         // set OCI arrays
         queue->buffer.handles[i] = prop->handle;
@@ -455,6 +490,14 @@ static void dpiQueue__freeBuffer(dpiQueue *queue, dpiError *error)
         dpiUtils__freeMemory(buffer->msgIds);
         buffer->msgIds = NULL;
     }
+    if (buffer->jsonPayloads) {
+        for (i = 0; i < buffer->numElements; i++) {
+            if (buffer->jsonPayloads[i])
+                dpiGen__setRefCount(buffer->jsonPayloads[i], error, -1);
+        }
+        dpiUtils__freeMemory(buffer->jsonPayloads);
+        buffer->jsonPayloads = NULL;
+    }
 }
 
 
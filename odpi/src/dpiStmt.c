@@ -82,6 +82,10 @@ static int dpiStmt__bind(dpiStmt *stmt, dpiVar *var, uint32_t pos,
         return dpiError__set(error, "bind zero length name",
                 DPI_ERR_NOT_SUPPORTED);
 
+    // compact variables can only be defined
+    if (var->isCompact)
+        return dpiError__set(error, "bind compact", DPI_ERR_NOT_SUPPORTED);
+
     // prevent attempts to bind a statement to itself
     if (var->type->oracleTypeNum == DPI_ORACLE_TYPE_STMT) {
         for (i = 0; i < var->buffer.maxArraySize; i++) {
@@ -948,6 +952,13 @@ static int dpiStmt__postFetch(dpiStmt *stmt, dpiError *error)
 
     for (i = 0; i < stmt->numQueryVars; i++) {
         var = stmt->queryVars[i];
+        if (var->isCompact) {
+            if (dpiVar__checkReturnCodes(var, stmt->bufferRowCount,
+                    error) < 0)
+                return DPI_FAILURE;
+            var->error = NULL;
+            continue;
+        }
         for (j = 0; j < stmt->bufferRowCount; j++) {
             if (dpiVar__getValue(var, &var->buffer, j, 1, error) < 0)
                 return DPI_FAILURE;
@@ -1771,6 +1782,10 @@ int dpiStmt_getQueryValue(dpiStmt *stmt, uint32_t pos,
         dpiError__set(&error, "check fetched row", DPI_ERR_NO_ROW_FETCHED);
         return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
     }
+    if (var->isCompact) {
+        dpiError__set(&error, "check compact", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(stmt, DPI_FAILURE, &error);
+    }
     *nativeTypeNum = var->nativeTypeNum;
     *data = &var->buffer.externalData[stmt->bufferRowIndex - 1];
     return dpiGen__endPublicFn(stmt, DPI_SUCCESS, &error);
@@ -29,6 +29,13 @@
 
 #include "dpiImpl.h"
 
+#ifdef DPI_MOCK_OCI
+// number of memory allocations made
+uint32_t dpiUtils__numAllocations = 0;
+// number of bytes allocated (wraps around)
+uint32_t dpiUtils__allocatedBytes = 0;
+#endif
+
 //-----------------------------------------------------------------------------
 // dpiUtils__allocateMemory() [INTERNAL]
 //   Method for allocating memory which permits tracing and populates the error
@@ -42,6 +49,11 @@ int dpiUtils__allocateMemory(size_t numMembers, size_t memberSize,
     else *ptr = malloc(numMembers * memberSize);
     if (!*ptr)
         return dpiError__set(error, action, DPI_ERR_NO_MEMORY);
+#ifdef DPI_MOCK_OCI
+    (void) dpiAtomic__addFetch(&dpiUtils__numAllocations, 1);
+    (void) dpiAtomic__addFetch(&dpiUtils__allocatedBytes,
+            (uint32_t) (numMembers * memberSize));
+#endif
     if (dpiDebugLevel & DPI_DEBUG_LEVEL_MEM)
         dpiDebug__print("allocated %u bytes at %p (%s)\n",
                 numMembers * memberSize, *ptr, action);
@@ -415,6 +427,237 @@ int dpiUtils__parseNumberString(const char *value, uint32_t valueLength,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiUtils__decodeOracleNumber() [INTERNAL]
+//   Decode the contents of an Oracle number into an integer mantissa and a
+// base-100 exponent, such that the value is mantissa * 100^exponent. This is
+// only possible if the mantissa has at most 9 base-100 digits (and so fits in
+// 64 bits); a value of 0 is returned if it does not, 1 otherwise.
+//-----------------------------------------------------------------------------
+static int dpiUtils__decodeOracleNumber(const uint8_t *source, int isNegative,
+        uint8_t length, uint64_t *mantissa, int *exponent)
+{
+    uint64_t value = 0;
+    uint8_t i;
+
+    if (length > 9)
+        return 0;
+    for (i = 0; i < length; i++)
+        value = value * 100 +
+                (uint64_t) (isNegative ? 101 - source[i] : source[i] - 1);
+    *mantissa = value;
+    *exponent -= length - 1;
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiUtils__oracleNumberPrepare() [INTERNAL]
+//   Return the sign, mantissa length and base-100 exponent of the most
+// significant digit of an Oracle number, for use by the decode routines
+// below. A value of 0 is returned for values which cannot be handled by them
+// (zero, -1e126 and corrupted numbers), 1 otherwise.
+//-----------------------------------------------------------------------------
+static int dpiUtils__oracleNumberPrepare(const uint8_t *source,
+        int *isNegative, uint8_t *length, int *exponent)
+{
+    uint8_t ociExponent;
+
+    *length = source[0] - 1;
+    if (*length == 0 || *length > 20)
+        return 0;
+    ociExponent = source[1];
+    *isNegative = (ociExponent & 0x80) ? 0 : 1;
+    if (*isNegative) {
+        ociExponent = (uint8_t) ~ociExponent;
+        if (source[*length + 1] == 102)
+            (*length)--;
+    }
+    *exponent = (int) ociExponent - 193;
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiUtils__oracleNumberToDouble() [INTERNAL]
+//   Convert an Oracle number directly to a double, without a call to OCI,
+// when the result is exact: the decimal mantissa must fit in 53 bits and the
+// decimal exponent must be within 22, so that a single, correctly rounded,
+// multiplication or division is all that is needed. A value of 0 is returned
+// if the number cannot be converted this way, 1 otherwise.
+//-----------------------------------------------------------------------------
+int dpiUtils__oracleNumberToDouble(void *oracleValue, double *value)
+{
+    static const double powersOf10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+        1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const uint8_t *source = (const uint8_t*) oracleValue;
+    int isNegative, exponent;
+    uint64_t mantissa;
+    uint8_t length;
+    double result;
+
+    if (source[0] == 1 && source[1] == 0x80) {
+        *value = 0.0;
+        return 1;
+    }
+    if (!dpiUtils__oracleNumberPrepare(source, &isNegative, &length,
+            &exponent))
+        return 0;
+    if (!dpiUtils__decodeOracleNumber(source + 2, isNegative, length,
+            &mantissa, &exponent))
+        return 0;
+    exponent *= 2;
+    if (mantissa > ((uint64_t) 1 << 53) || exponent > 22 || exponent < -22)
+        return 0;
+    result = (double) mantissa;
+    if (exponent >= 0)
+        result *= powersOf10[exponent];
+    else result /= powersOf10[-exponent];
+    *value = (isNegative) ? -result : result;
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiUtils__oracleNumberToInt64() [INTERNAL]
+//   Convert an Oracle number directly to a 64-bit integer, without a call to
+// OCI, when it is an integer of at most 18 digits. A value of 0 is returned
+// if the number cannot be converted this way, 1 otherwise.
+//-----------------------------------------------------------------------------
+int dpiUtils__oracleNumberToInt64(void *oracleValue, int64_t *value)
+{
+    const uint8_t *source = (const uint8_t*) oracleValue;
+    int isNegative, exponent;
+    uint64_t mantissa;
+    uint8_t length;
+
+    if (source[0] == 1 && source[1] == 0x80) {
+        *value = 0;
+        return 1;
+    }
+    if (!dpiUtils__oracleNumberPrepare(source, &isNegative, &length,
+            &exponent) || exponent > 8)
+        return 0;
+    if (!dpiUtils__decodeOracleNumber(source + 2, isNegative, length,
+            &mantissa, &exponent) || exponent < 0)
+        return 0;
+    for (; exponent > 0; exponent--)
+        mantissa *= 100;
+    *value = (isNegative) ? -(int64_t) mantissa : (int64_t) mantissa;
+    return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiUtils__oracleNumberToText() [INTERNAL]
+//   Convert an Oracle number directly to its (ASCII) text representation, in
+// a single pass over the mantissa: each base-100 digit is written as two
+// characters taken from a lookup table. The decimal point always falls
+// between two base-100 digits, so it is written between them as well. On
+// entry, textLength is the size of the text buffer; on exit, it is the
+// number of characters written. A value of 0 is returned if the number cannot
+// be converted this way (-1e126 and invalid numbers) or if the buffer is
+// too small, so that the generic routine (dpiUtils__parseOracleNumber) can be
+// used instead, 1 otherwise.
+//-----------------------------------------------------------------------------
+int dpiUtils__oracleNumberToText(void *oracleValue, char *text,
+        uint32_t *textLength)
+{
+    static const char twoDigits[] =
+            "00010203040506070809101112131415161718192021222324252627282930"
+            "31323334353637383940414243444546474849505152535455565758596061"
+            "62636465666768697071727374757677787980818283848586878889909192"
+            "93949596979899";
+    int isNegative, exponent, numLeadingZeroes, numTrailingZeroes, i;
+    const uint8_t *source = (const uint8_t*) oracleValue;
+    uint8_t length, digit, firstDigit, lastDigit, dropLastZero;
+    uint32_t numChars;
+    char *target;
+
+    // zero is written as is; -1e126 and invalid lengths are left to the
+    // generic routine
+    if (source[0] == 1 && source[1] == 0x80) {
+        if (*textLength < 1)
+            return 0;
+        *text = '0';
+        *textLength = 1;
+        return 1;
+    }
+    if (!dpiUtils__oracleNumberPrepare(source, &isNegative, &length,
+            &exponent) || length == 0)
+        return 0;
+    source += 2;
+
+    // a leading zero in the first base-100 digit and a trailing zero in the
+    // last one are not written; a first base-100 digit of zero (or an out of
+    // range one) is invalid and left to the generic routine
+    firstDigit = (isNegative) ? 101 - source[0] : source[0] - 1;
+    lastDigit = (isNegative) ? 101 - source[length - 1] :
+            source[length - 1] - 1;
+    if (firstDigit == 0 || firstDigit > 99 || lastDigit > 99)
+        return 0;
+
+    // calculate the number of characters required; the decimal point goes
+    // right before base-100 digit (exponent + 1) and the trailing zero of the
+    // last base-100 digit is only kept if the number is an integer
+    dropLastZero = (exponent + 1 < length && lastDigit % 10 == 0);
+    numChars = length * 2 - (firstDigit < 10) - dropLastZero;
+    numLeadingZeroes = numTrailingZeroes = 0;
+    if (exponent < 0) {
+        numLeadingZeroes = (firstDigit < 10) - 2 * (exponent + 1);
+        numChars += numLeadingZeroes + 2;
+    } else if (exponent + 1 < length) {
+        numChars++;
+    } else {
+        numTrailingZeroes = 2 * (exponent + 1 - length);
+        numChars += numTrailingZeroes;
+    }
+    if (isNegative)
+        numChars++;
+    if (numChars > *textLength)
+        return 0;
+    *textLength = numChars;
+
+    // write the sign and any leading zeroes
+    target = text;
+    if (isNegative)
+        *target++ = '-';
+    if (exponent < 0) {
+        *target++ = '0';
+        *target++ = '.';
+        for (i = 0; i < numLeadingZeroes; i++)
+            *target++ = '0';
+    }
+
+    // write the mantissa, two characters per base-100 digit
+    if (firstDigit < 10) {
+        *target++ = (char) ('0' + firstDigit);
+    } else {
+        *target++ = twoDigits[firstDigit * 2];
+        *target++ = twoDigits[firstDigit * 2 + 1];
+    }
+    for (i = 1; i < length; i++) {
+        if (i == exponent + 1)
+            *target++ = '.';
+        digit = (isNegative) ? 101 - source[i] : source[i] - 1;
+        if (digit > 99)
+            return 0;
+        *target++ = twoDigits[digit * 2];
+        *target++ = twoDigits[digit * 2 + 1];
+    }
+
+    // drop the trailing zero or add the trailing zeroes of an integer
+    if (dropLastZero)
+        target--;
+    for (i = 0; i < numTrailingZeroes; i++)
+        *target++ = '0';
+
+    return 1;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiUtils__parseOracleNumber() [INTERNAL]
 //   Parse the contents of an Oracle number and return its constituent parts
@@ -30,6 +30,16 @@
 #include "dpiImpl.h"
 
 // forward declarations of internal functions only used in this file
+static int dpiVar__checkVectorRange(dpiVar *var, uint32_t pos,
+        uint32_t numRows, uint8_t format, uint32_t numDimensions,
+        uint32_t *rowSize, uint8_t *dimensionSize, dpiError *error);
+static int dpiVar__create(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
+        int sizeIsBytes, int isArray, int isCompact, dpiObjectType *objType,
+        dpiVar **var, dpiError *error);
+static int dpiVar__getNextChunk(dpiDynamicBytes *bytes,
+        dpiDynamicBytesChunk **chunk, dpiError *error);
+static uint32_t dpiVar__growLength(uint32_t previousLength, uint32_t size);
 static int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer,
         dpiError *error);
 static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
@@ -64,99 +74,35 @@ int dpiVar__allocate(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
         int sizeIsBytes, int isArray, dpiObjectType *objType, dpiVar **var,
         dpiData **data, dpiError *error)
 {
-    const dpiOracleType *type;
-    uint32_t sizeInBytes;
-    dpiVar *tempVar;
-
-    // validate arguments
-    *var = NULL;
-    type = dpiOracleType__getFromNum(oracleTypeNum, error);
-    if (!type)
-        return DPI_FAILURE;
-    if (maxArraySize == 0)
-        return dpiError__set(error, "check max array size",
-                DPI_ERR_ARRAY_SIZE_ZERO);
-    if (isArray && !type->canBeInArray)
-        return dpiError__set(error, "check can be in array",
-                DPI_ERR_NOT_SUPPORTED);
-    if (oracleTypeNum == DPI_ORACLE_TYPE_BOOLEAN &&
-            dpiUtils__checkClientVersion(conn->env->versionInfo, 12, 1,
-                    error) < 0)
-        return DPI_FAILURE;
-    if (nativeTypeNum != type->defaultNativeTypeNum) {
-        if (dpiVar__validateTypes(type, nativeTypeNum, error) < 0)
-            return DPI_FAILURE;
-    }
-
-    // calculate size in bytes
-    if (size == 0)
-        size = 1;
-    if (type->sizeInBytes)
-        sizeInBytes = type->sizeInBytes;
-    else if (sizeIsBytes || !type->isCharacterData)
-        sizeInBytes = size;
-    else if (type->charsetForm == DPI_SQLCS_IMPLICIT)
-        sizeInBytes = size * conn->env->maxBytesPerCharacter;
-    else sizeInBytes = size * conn->env->nmaxBytesPerCharacter;
-
-    // allocate memory for variable type
-    if (dpiGen__allocate(DPI_HTYPE_VAR, conn->env, (void**) &tempVar,
-            error) < 0)
+    if (dpiVar__create(conn, oracleTypeNum, nativeTypeNum, maxArraySize, size,
+            sizeIsBytes, isArray, 0, objType, var, error) < 0)
         return DPI_FAILURE;
-
-    // basic initialization
-    tempVar->buffer.maxArraySize = maxArraySize;
-    if (!isArray)
-        tempVar->buffer.actualArraySize = maxArraySize;
-    tempVar->sizeInBytes = sizeInBytes;
-    if (sizeInBytes > DPI_MAX_BASIC_BUFFER_SIZE) {
-        tempVar->sizeInBytes = 0;
-        tempVar->isDynamic = 1;
-        tempVar->requiresPreFetch = 1;
-    }
-    tempVar->type = type;
-    tempVar->nativeTypeNum = nativeTypeNum;
-    tempVar->isArray = isArray;
-    dpiGen__setRefCount(conn, error, 1);
-    tempVar->conn = conn;
-    if (objType) {
-        if (dpiGen__checkHandle(objType, DPI_HTYPE_OBJECT_TYPE,
-                "check object type", error) < 0) {
-            dpiVar__free(tempVar, error);
-            return DPI_FAILURE;
-        }
-        dpiGen__setRefCount(objType, error, 1);
-        tempVar->objectType = objType;
-    }
-
-    // allocate the data for the variable
-    if (dpiVar__initBuffer(tempVar, &tempVar->buffer, error) < 0) {
-        dpiVar__free(tempVar, error);
-        return DPI_FAILURE;
-    }
-
-    *var = tempVar;
-    *data = tempVar->buffer.externalData;
+    *data = (*var)->buffer.externalData;
     return DPI_SUCCESS;
 }
 
 
 //-----------------------------------------------------------------------------
 // dpiVar__allocateChunks() [INTERNAL]
-//   Allocate more chunks for handling dynamic bytes.
+//   Allocate more chunks for handling dynamic bytes. The number of chunks is
+// doubled each time so that values made up of many pieces do not require
+// repeated copying of the chunk array. All chunks (including those which are
+// not currently in use) are retained as their memory is reused by subsequent
+// fetches.
 //-----------------------------------------------------------------------------
 static int dpiVar__allocateChunks(dpiDynamicBytes *dynBytes, dpiError *error)
 {
     dpiDynamicBytesChunk *chunks;
     uint32_t allocatedChunks;
 
-    allocatedChunks = dynBytes->allocatedChunks + 8;
+    allocatedChunks = (dynBytes->allocatedChunks < 8) ? 8 :
+            dynBytes->allocatedChunks * 2;
     if (dpiUtils__allocateMemory(allocatedChunks, sizeof(dpiDynamicBytesChunk),
             1, "allocate chunks", (void**) &chunks, error) < 0)
         return DPI_FAILURE;
     if (dynBytes->chunks) {
         memcpy(chunks, dynBytes->chunks,
-                dynBytes->numChunks * sizeof(dpiDynamicBytesChunk));
+                dynBytes->allocatedChunks * sizeof(dpiDynamicBytesChunk));
         dpiUtils__freeMemory(dynBytes->chunks);
     }
     dynBytes->chunks = chunks;
@@ -165,6 +111,58 @@ static int dpiVar__allocateChunks(dpiDynamicBytes *dynBytes, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__allocateCompact() [INTERNAL]
+//   Create a new compact variable object and return it. A compact variable
+// has no dpiData structures: the values are left in the buffers filled by OCI
+// (see dpiVar_getArrays()), so only the types which need no conversion are
+// supported, and the variable can only be used for defining.
+//-----------------------------------------------------------------------------
+int dpiVar__allocateCompact(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
+        int sizeIsBytes, dpiVar **var, dpiError *error)
+{
+    int supported;
+
+    switch (oracleTypeNum) {
+        case DPI_ORACLE_TYPE_VARCHAR:
+        case DPI_ORACLE_TYPE_NVARCHAR:
+        case DPI_ORACLE_TYPE_CHAR:
+        case DPI_ORACLE_TYPE_NCHAR:
+        case DPI_ORACLE_TYPE_RAW:
+            supported = (nativeTypeNum == DPI_NATIVE_TYPE_BYTES);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+            supported = (nativeTypeNum == DPI_NATIVE_TYPE_DOUBLE);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_FLOAT:
+            supported = (nativeTypeNum == DPI_NATIVE_TYPE_FLOAT);
+            break;
+        case DPI_ORACLE_TYPE_NATIVE_INT:
+            supported = (nativeTypeNum == DPI_NATIVE_TYPE_INT64);
+            break;
+        default:
+            supported = 0;
+            break;
+    }
+
+    // 11g clients need 16-bit lengths, which are not exposed
+    if (!supported || conn->env->versionInfo->versionNum < 12)
+        return dpiError__set(error, "check compact type",
+                DPI_ERR_NOT_SUPPORTED);
+    if (dpiVar__create(conn, oracleTypeNum, nativeTypeNum, maxArraySize, size,
+            sizeIsBytes, 0, 1, NULL, var, error) < 0)
+        return DPI_FAILURE;
+    if ((*var)->isDynamic) {
+        dpiVar__free(*var, error);
+        *var = NULL;
+        return dpiError__set(error, "check compact size",
+                DPI_ERR_NOT_SUPPORTED);
+    }
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__allocateDynamicBytes() [INTERNAL]
 //   Allocate space in the dynamic bytes structure for the specified number of
@@ -174,6 +172,9 @@ static int dpiVar__allocateChunks(dpiDynamicBytes *dynBytes, dpiError *error)
 static int dpiVar__allocateDynamicBytes(dpiDynamicBytes *dynBytes,
         uint32_t size, dpiError *error)
 {
+    uint32_t i, allocatedLength;
+    dpiDynamicBytesChunk temp;
+
     // if an error occurs, none of the original space is valid
     dynBytes->numChunks = 0;
 
@@ -184,16 +185,30 @@ static int dpiVar__allocateDynamicBytes(dpiDynamicBytes *dynBytes,
 
     // at this point there should be 0 or 1 chunks as any retrieval that
     // resulted in multiple chunks would have been consolidated already
-    // make sure that chunk has enough space in it
+    // make sure that chunk has enough space in it, preferably by reusing one
+    // of the other chunks retained from previous retrievals
+    if (size > dynBytes->chunks->allocatedLength) {
+        for (i = 1; i < dynBytes->allocatedChunks; i++) {
+            if (dynBytes->chunks[i].ptr &&
+                    dynBytes->chunks[i].allocatedLength >= size) {
+                temp = dynBytes->chunks[0];
+                dynBytes->chunks[0] = dynBytes->chunks[i];
+                dynBytes->chunks[i] = temp;
+                return DPI_SUCCESS;
+            }
+        }
+    }
     if (size > dynBytes->chunks->allocatedLength) {
+        allocatedLength = dpiVar__growLength(dynBytes->chunks->allocatedLength,
+                size);
         if (dynBytes->chunks->ptr)
             dpiUtils__freeMemory(dynBytes->chunks->ptr);
-        dynBytes->chunks->allocatedLength =
-                (size + DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1) &
-                        ~(DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1);
-        if (dpiUtils__allocateMemory(1, dynBytes->chunks->allocatedLength, 0,
-                "allocate chunk", (void**) &dynBytes->chunks->ptr, error) < 0)
+        dynBytes->chunks->ptr = NULL;
+        dynBytes->chunks->allocatedLength = 0;
+        if (dpiUtils__allocateMemory(1, allocatedLength, 0, "allocate chunk",
+                (void**) &dynBytes->chunks->ptr, error) < 0)
             return DPI_FAILURE;
+        dynBytes->chunks->allocatedLength = allocatedLength;
     }
 
     return DPI_SUCCESS;
@@ -257,6 +272,74 @@ static int dpiVar__checkArraySize(dpiVar *var, uint32_t pos,
         return dpiError__set(error, "check array size",
                 DPI_ERR_INVALID_ARRAY_POSITION, pos,
                 var->buffer.maxArraySize);
+    if (var->isCompact)
+        return dpiError__set(error, "check compact", DPI_ERR_NOT_SUPPORTED);
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__checkReturnCodes() [INTERNAL]
+//   Checks the return codes of the first numRows (not null) values of a
+// compact variable, as dpiVar__getValue() does for the others.
+//-----------------------------------------------------------------------------
+int dpiVar__checkReturnCodes(dpiVar *var, uint32_t numRows, dpiError *error)
+{
+    dpiVarBuffer *buffer = &var->buffer;
+    uint32_t i;
+
+    if (!buffer->returnCode)
+        return DPI_SUCCESS;
+    for (i = 0; i < numRows; i++) {
+        if (buffer->indicator[i] != DPI_OCI_IND_NULL &&
+                buffer->returnCode[i] != 0) {
+            dpiError__set(error, "check return code", DPI_ERR_COLUMN_FETCH, i,
+                    buffer->returnCode[i]);
+            error->buffer->code = buffer->returnCode[i];
+            return DPI_FAILURE;
+        }
+    }
+    return DPI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// dpiVar__checkVectorRange() [INTERNAL]
+//   Verifies that the variable is a vector variable with numRows array
+// positions starting at pos, and that the format is supported. The size of
+// each vector of numDimensions dimensions and of each dimension (in bytes) is
+// returned.
+//-----------------------------------------------------------------------------
+static int dpiVar__checkVectorRange(dpiVar *var, uint32_t pos,
+        uint32_t numRows, uint8_t format, uint32_t numDimensions,
+        uint32_t *rowSize, uint8_t *dimensionSize, dpiError *error)
+{
+    if (numRows > var->buffer.maxArraySize - pos)
+        return dpiError__set(error, "check array size",
+                DPI_ERR_INVALID_ARRAY_POSITION, pos + numRows,
+                var->buffer.maxArraySize);
+    if (var->type->oracleTypeNum != DPI_ORACLE_TYPE_VECTOR)
+        return dpiError__set(error, "check variable type",
+                DPI_ERR_UNHANDLED_DATA_TYPE, var->type->oracleTypeNum);
+    switch (format) {
+        case DPI_VECTOR_FORMAT_BINARY:
+            *dimensionSize = sizeof(uint8_t);
+            *rowSize = numDimensions / 8;
+            return DPI_SUCCESS;
+        case DPI_VECTOR_FORMAT_FLOAT32:
+            *dimensionSize = sizeof(float);
+            break;
+        case DPI_VECTOR_FORMAT_FLOAT64:
+            *dimensionSize = sizeof(double);
+            break;
+        case DPI_VECTOR_FORMAT_INT8:
+            *dimensionSize = sizeof(int8_t);
+            break;
+        default:
+            return dpiError__set(error, "check vector format",
+                    DPI_ERR_UNSUPPORTED_VECTOR_FORMAT, format);
+    }
+    *rowSize = numDimensions * *dimensionSize;
     return DPI_SUCCESS;
 }
 
@@ -352,6 +435,93 @@ int dpiVar__copyData(dpiVar *var, uint32_t pos, dpiData *sourceData,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__create() [INTERNAL]
+//   Create a new variable object, with dpiData structures unless it is
+// compact.
+//-----------------------------------------------------------------------------
+static int dpiVar__create(dpiConn *conn, dpiOracleTypeNum oracleTypeNum,
+        dpiNativeTypeNum nativeTypeNum, uint32_t maxArraySize, uint32_t size,
+        int sizeIsBytes, int isArray, int isCompact, dpiObjectType *objType,
+        dpiVar **var, dpiError *error)
+{
+    const dpiOracleType *type;
+    uint32_t sizeInBytes;
+    dpiVar *tempVar;
+
+    // validate arguments
+    *var = NULL;
+    type = dpiOracleType__getFromNum(oracleTypeNum, error);
+    if (!type)
+        return DPI_FAILURE;
+    if (maxArraySize == 0)
+        return dpiError__set(error, "check max array size",
+                DPI_ERR_ARRAY_SIZE_ZERO);
+    if (isArray && !type->canBeInArray)
+        return dpiError__set(error, "check can be in array",
+                DPI_ERR_NOT_SUPPORTED);
+    if (oracleTypeNum == DPI_ORACLE_TYPE_BOOLEAN &&
+            dpiUtils__checkClientVersion(conn->env->versionInfo, 12, 1,
+                    error) < 0)
+        return DPI_FAILURE;
+    if (nativeTypeNum != type->defaultNativeTypeNum) {
+        if (dpiVar__validateTypes(type, nativeTypeNum, error) < 0)
+            return DPI_FAILURE;
+    }
+
+    // calculate size in bytes
+    if (size == 0)
+        size = 1;
+    if (type->sizeInBytes)
+        sizeInBytes = type->sizeInBytes;
+    else if (sizeIsBytes || !type->isCharacterData)
+        sizeInBytes = size;
+    else if (type->charsetForm == DPI_SQLCS_IMPLICIT)
+        sizeInBytes = size * conn->env->maxBytesPerCharacter;
+    else sizeInBytes = size * conn->env->nmaxBytesPerCharacter;
+
+    // allocate memory for variable type
+    if (dpiGen__allocate(DPI_HTYPE_VAR, conn->env, (void**) &tempVar,
+            error) < 0)
+        return DPI_FAILURE;
+
+    // basic initialization
+    tempVar->buffer.maxArraySize = maxArraySize;
+    if (!isArray)
+        tempVar->buffer.actualArraySize = maxArraySize;
+    tempVar->sizeInBytes = sizeInBytes;
+    if (sizeInBytes > DPI_MAX_BASIC_BUFFER_SIZE) {
+        tempVar->sizeInBytes = 0;
+        tempVar->isDynamic = 1;
+        tempVar->requiresPreFetch = 1;
+    }
+    tempVar->type = type;
+    tempVar->nativeTypeNum = nativeTypeNum;
+    tempVar->isArray = isArray;
+    tempVar->isCompact = isCompact;
+    dpiGen__setRefCount(conn, error, 1);
+    tempVar->conn = conn;
+    if (objType) {
+        if (dpiGen__checkHandle(objType, DPI_HTYPE_OBJECT_TYPE,
+                "check object type", error) < 0) {
+            dpiVar__free(tempVar, error);
+            return DPI_FAILURE;
+        }
+        dpiGen__setRefCount(objType, error, 1);
+        tempVar->objectType = objType;
+    }
+
+    // allocate the data for the variable
+    if (dpiVar__initBuffer(tempVar, &tempVar->buffer, error) < 0) {
+        dpiVar__free(tempVar, error);
+        return DPI_FAILURE;
+    }
+
+    *var = tempVar;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__defineCallback() [INTERNAL]
 //   Callback which runs during OCI statement execution and allocates the
@@ -367,24 +537,12 @@ int32_t dpiVar__defineCallback(dpiVar *var, UNUSED void *defnp, uint32_t iter,
     dpiDynamicBytesChunk *chunk;
     dpiDynamicBytes *bytes;
 
-    // allocate more chunks, if necessary
+    // acquire the next chunk
     bytes = &var->buffer.dynamicBytes[iter];
-    if (bytes->numChunks == bytes->allocatedChunks &&
-            dpiVar__allocateChunks(bytes, var->error) < 0)
+    if (dpiVar__getNextChunk(bytes, &chunk, var->error) < 0)
         return DPI_OCI_ERROR;
 
-    // allocate memory for the chunk, if needed
-    chunk = &bytes->chunks[bytes->numChunks];
-    if (!chunk->ptr) {
-        chunk->allocatedLength = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
-        if (dpiUtils__allocateMemory(1, chunk->allocatedLength, 0,
-                "allocate chunk", (void**) &chunk->ptr, var->error) < 0)
-            return DPI_OCI_ERROR;
-    }
-
     // return chunk to OCI
-    bytes->numChunks++;
-    chunk->length = chunk->allocatedLength;
     *bufpp = chunk->ptr;
     *alenpp = &chunk->length;
     *indpp = &(var->buffer.indicator[iter]);
@@ -418,9 +576,17 @@ int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
         case DPI_ORACLE_TYPE_STMT:
             for (i = 0; i < buffer->maxArraySize; i++) {
                 data = &buffer->externalData[i];
-                if (buffer->references[i].asStmt) {
-                    dpiGen__setRefCount(buffer->references[i].asStmt,
-                            error, -1);
+
+                // reuse the statement if the previous fetch did not put a
+                // cursor into its handle and no one else references it
+                stmt = buffer->references[i].asStmt;
+                if (stmt && !stmt->holdsCursor && !stmt->closing &&
+                        dpiAtomic__load(&stmt->refCount) == 1) {
+                    data->value.asStmt = stmt;
+                    continue;
+                }
+                if (stmt) {
+                    dpiGen__setRefCount(stmt, error, -1);
                     buffer->references[i].asStmt = NULL;
                 }
                 buffer->data.asStmt[i] = NULL;
@@ -451,9 +617,16 @@ int dpiVar__extendedPreFetch(dpiVar *var, dpiVarBuffer *buffer,
         case DPI_ORACLE_TYPE_BFILE:
             for (i = 0; i < buffer->maxArraySize; i++) {
                 data = &buffer->externalData[i];
-                if (buffer->references[i].asLOB) {
-                    dpiGen__setRefCount(buffer->references[i].asLOB,
-                            error, -1);
+
+                // reuse the locator if no one else references the LOB
+                lob = buffer->references[i].asLOB;
+                if (lob && !buffer->dynamicBytes &&
+                        dpiLob__prepareReuse(lob, error)) {
+                    data->value.asLOB = lob;
+                    continue;
+                }
+                if (lob) {
+                    dpiGen__setRefCount(lob, error, -1);
                     buffer->references[i].asLOB = NULL;
                 }
                 buffer->data.asLobLocator[i] = NULL;
@@ -671,6 +844,44 @@ void dpiVar__free(dpiVar *var, dpiError *error)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__getNextChunk() [INTERNAL]
+//   Return the next chunk of the dynamic bytes structure, to be filled by OCI
+// with the next piece of a value. Memory retained from previous retrievals is
+// reused; otherwise, each new chunk is as large as all of the previous chunks
+// of the value combined, so long values require only a few pieces.
+//-----------------------------------------------------------------------------
+static int dpiVar__getNextChunk(dpiDynamicBytes *bytes,
+        dpiDynamicBytesChunk **chunk, dpiError *error)
+{
+    uint32_t i, allocatedLength;
+
+    // allocate more chunks, if necessary
+    if (bytes->numChunks == bytes->allocatedChunks &&
+            dpiVar__allocateChunks(bytes, error) < 0)
+        return DPI_FAILURE;
+
+    // allocate memory for the chunk, if needed
+    *chunk = &bytes->chunks[bytes->numChunks];
+    if (!(*chunk)->ptr) {
+        allocatedLength = 0;
+        for (i = 0; i < bytes->numChunks; i++)
+            allocatedLength += bytes->chunks[i].allocatedLength;
+        allocatedLength = dpiVar__growLength(0, allocatedLength);
+        (*chunk)->allocatedLength = 0;
+        if (dpiUtils__allocateMemory(1, allocatedLength, 0, "allocate chunk",
+                (void**) &(*chunk)->ptr, error) < 0)
+            return DPI_FAILURE;
+        (*chunk)->allocatedLength = allocatedLength;
+    }
+
+    // mark chunk as in use
+    bytes->numChunks++;
+    (*chunk)->length = (*chunk)->allocatedLength;
+    return DPI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__getValue() [PRIVATE]
 //   Returns the contents of the variable in the type specified, if possible.
@@ -840,6 +1051,8 @@ int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
             break;
         case DPI_NATIVE_TYPE_STMT:
             data->value.asStmt = buffer->references[pos].asStmt;
+            if (inFetch)
+                data->value.asStmt->holdsCursor = 1;
             break;
         case DPI_NATIVE_TYPE_BOOLEAN:
             data->value.asBoolean = buffer->data.asBoolean[pos];
@@ -851,6 +1064,29 @@ int dpiVar__getValue(dpiVar *var, dpiVarBuffer *buffer, uint32_t pos,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar__growLength() [INTERNAL]
+//   Return the length to allocate for a chunk which must hold at least the
+// specified number of bytes. The length is rounded up to a multiple of the
+// chunk size and is at least double the previous length (if it fits), so a
+// series of increasing values results in only a few reallocations.
+//-----------------------------------------------------------------------------
+static uint32_t dpiVar__growLength(uint32_t previousLength, uint32_t size)
+{
+    uint32_t length;
+
+    if (size > UINT32_MAX - (DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1))
+        return size;
+    length = (size + DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1) &
+            ~(DPI_DYNAMIC_BYTES_CHUNK_SIZE - 1);
+    if (length == 0)
+        length = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
+    if (previousLength <= UINT32_MAX / 2 && length < previousLength * 2)
+        length = previousLength * 2;
+    return length;
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar__inBindCallback() [INTERNAL]
 //   Callback which runs during OCI statement execution and provides buffers to
@@ -973,7 +1209,10 @@ static int dpiVar__initBuffer(dpiVar *var, dpiVarBuffer *buffer,
         }
     }
 
-    // allocate the external data array, if needed
+    // allocate the external data array, if needed (not for compact variables
+    // whose values are left in the buffers above)
+    if (var->isCompact)
+        return DPI_SUCCESS;
     if (!buffer->externalData) {
         if (dpiUtils__allocateMemory(buffer->maxArraySize, sizeof(dpiData), 1,
                 "allocate external data", (void**) &buffer->externalData,
@@ -1103,26 +1342,14 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, UNUSED uint32_t iter,
     // index is the current index into the chunks
     if (var->isDynamic) {
 
-        // allocate more chunks, if necessary
+        // acquire the next chunk
         bytes = &buffer->dynamicBytes[index];
         if (*piecep == DPI_OCI_ONE_PIECE)
             bytes->numChunks = 0;
-        if (bytes->numChunks == bytes->allocatedChunks &&
-                dpiVar__allocateChunks(bytes, var->error) < 0)
+        if (dpiVar__getNextChunk(bytes, &chunk, var->error) < 0)
             return DPI_OCI_ERROR;
 
-        // allocate memory for the chunk, if needed
-        chunk = &bytes->chunks[bytes->numChunks];
-        if (!chunk->ptr) {
-            chunk->allocatedLength = DPI_DYNAMIC_BYTES_CHUNK_SIZE;
-            if (dpiUtils__allocateMemory(1, chunk->allocatedLength, 0,
-                    "allocate chunk", (void**) &chunk->ptr, var->error) < 0)
-                return DPI_OCI_ERROR;
-        }
-
         // return chunk to OCI
-        bytes->numChunks++;
-        chunk->length = chunk->allocatedLength;
         *bufpp = chunk->ptr;
         *alenpp = &chunk->length;
         *indpp = &(buffer->indicator[index]);
@@ -1163,12 +1390,15 @@ int32_t dpiVar__outBindCallback(dpiVar *var, void *bindp, UNUSED uint32_t iter,
 // dpiVar__setBytesFromDynamicBytes() [PRIVATE]
 //   Set the pointer and length in the dpiBytes structure to the values
 // retrieved from the database. At this point, if multiple chunks exist, they
-// are combined into one.
+// are combined into one. The largest unused chunk is used for that purpose if
+// it is large enough; the chunks that were combined are retained for reuse by
+// subsequent retrievals, so the steady state requires no allocations.
 //-----------------------------------------------------------------------------
 static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         dpiDynamicBytes *dynBytes, dpiError *error)
 {
-    uint32_t i, totalAllocatedLength;
+    uint32_t i, spare, totalLength, totalAllocatedLength;
+    dpiDynamicBytesChunk consolidated, *chunk;
 
     // if only one chunk is available, make use of it
     if (dynBytes->numChunks == 1) {
@@ -1177,33 +1407,58 @@ static int dpiVar__setBytesFromDynamicBytes(dpiBytes *bytes,
         return DPI_SUCCESS;
     }
 
-    // determine total allocated size of all chunks
-    totalAllocatedLength = 0;
-    for (i = 0; i < dynBytes->numChunks; i++)
+    // make sure there is at least one unused chunk
+    if (dynBytes->numChunks == dynBytes->allocatedChunks &&
+            dpiVar__allocateChunks(dynBytes, error) < 0)
+        return DPI_FAILURE;
+
+    // determine total size of all chunks
+    totalLength = totalAllocatedLength = 0;
+    for (i = 0; i < dynBytes->numChunks; i++) {
+        totalLength += dynBytes->chunks[i].length;
         totalAllocatedLength += dynBytes->chunks[i].allocatedLength;
+    }
 
-    // allocate new memory consolidating all of the chunks
-    if (dpiUtils__allocateMemory(1, totalAllocatedLength, 0,
-            "allocate consolidated chunk", (void**) &bytes->ptr, error) < 0)
-        return DPI_FAILURE;
+    // find the largest unused chunk
+    spare = dynBytes->numChunks;
+    for (i = spare + 1; i < dynBytes->allocatedChunks; i++) {
+        if (dynBytes->chunks[i].allocatedLength >
+                dynBytes->chunks[spare].allocatedLength)
+            spare = i;
+    }
+
+    // use that chunk for the consolidated value if it is large enough;
+    // otherwise, replace it with a new chunk large enough for all of them
+    consolidated = dynBytes->chunks[spare];
+    if (!consolidated.ptr || consolidated.allocatedLength < totalLength) {
+        if (consolidated.ptr)
+            dpiUtils__freeMemory(consolidated.ptr);
+        dynBytes->chunks[spare].ptr = NULL;
+        dynBytes->chunks[spare].allocatedLength = 0;
+        if (dpiUtils__allocateMemory(1, totalAllocatedLength, 0,
+                "allocate consolidated chunk", (void**) &consolidated.ptr,
+                error) < 0)
+            return DPI_FAILURE;
+        consolidated.allocatedLength = totalAllocatedLength;
+    }
 
     // copy memory from chunks to consolidated chunk
-    bytes->length = 0;
+    consolidated.length = 0;
     for (i = 0; i < dynBytes->numChunks; i++) {
-        memcpy(bytes->ptr + bytes->length, dynBytes->chunks[i].ptr,
-                dynBytes->chunks[i].length);
-        bytes->length += dynBytes->chunks[i].length;
-        dpiUtils__freeMemory(dynBytes->chunks[i].ptr);
-        dynBytes->chunks[i].ptr = NULL;
-        dynBytes->chunks[i].length = 0;
-        dynBytes->chunks[i].allocatedLength = 0;
+        chunk = &dynBytes->chunks[i];
+        memcpy(consolidated.ptr + consolidated.length, chunk->ptr,
+                chunk->length);
+        consolidated.length += chunk->length;
+        chunk->length = 0;
     }
 
-    // populate first chunk with consolidated information
+    // populate first chunk with consolidated information; the chunk that was
+    // first is retained in place of the chunk that was used
+    dynBytes->chunks[spare] = dynBytes->chunks[0];
+    dynBytes->chunks[0] = consolidated;
     dynBytes->numChunks = 1;
-    dynBytes->chunks->ptr = bytes->ptr;
-    dynBytes->chunks->length = bytes->length;
-    dynBytes->chunks->allocatedLength = totalAllocatedLength;
+    bytes->ptr = consolidated.ptr;
+    bytes->length = consolidated.length;
 
     return DPI_SUCCESS;
 }
@@ -1750,6 +2005,31 @@ int dpiVar_copyData(dpiVar *var, uint32_t pos, dpiVar *sourceVar,
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_getArrays() [PUBLIC]
+//   Return the raw arrays of a compact variable: the values (valueSize bytes
+// each), the indicators (DPI_OCI_IND_NULL for null values) and the actual
+// lengths of the values. They are overwritten by each fetch.
+//-----------------------------------------------------------------------------
+int dpiVar_getArrays(dpiVar *var, dpiVarArrays *arrays)
+{
+    dpiError error;
+
+    if (dpiGen__startPublicFn(var, DPI_HTYPE_VAR, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(var, arrays)
+    if (!var->isCompact) {
+        dpiError__set(&error, "check compact", DPI_ERR_NOT_SUPPORTED);
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    }
+    arrays->values = var->buffer.data.asRaw;
+    arrays->indicators = var->buffer.indicator;
+    arrays->lengths = var->buffer.actualLength32;
+    arrays->valueSize = var->sizeInBytes;
+    return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_getNumElementsInArray() [PUBLIC]
 //   Return the actual number of elements in the array. This value is only
@@ -1815,6 +2095,76 @@ int dpiVar_getSizeInBytes(dpiVar *var, uint32_t *sizeInBytes)
 }
 
 
+//-----------------------------------------------------------------------------
+// dpiVar_getVectorValues() [PUBLIC]
+//   Places the dimensions of the vectors found in the given range of array
+// positions of the variable, converted to the given format, contiguously in
+// the buffer supplied by the caller, which must have room for numRows vectors
+// of numDimensions dimensions each. The rows that are null are zeroed. No
+// memory is allocated and the dimensions cached in the vectors are not used.
+// The number of dimensions (and the format) of each vector is checked before
+// it is converted, so that a vector of a flexible VECTOR(*) column cannot
+// overflow its row of the buffer.
+//-----------------------------------------------------------------------------
+int dpiVar_getVectorValues(dpiVar *var, uint32_t pos, uint32_t numRows,
+        uint8_t format, uint32_t numDimensions, void *values)
+{
+    uint32_t i, rowSize, actualDimensions;
+    uint8_t dimensionSize, actualFormat;
+    dpiVector *vector;
+    dpiError error;
+    char *row;
+    int status;
+
+    if (dpiVar__checkArraySize(var, pos, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(var, values)
+    if (dpiVar__checkVectorRange(var, pos, numRows, format, numDimensions,
+            &rowSize, &dimensionSize, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+
+    status = DPI_SUCCESS;
+    row = (char*) values;
+    for (i = 0; i < numRows; i++, row += rowSize) {
+        vector = var->buffer.references[pos + i].asVector;
+        if (var->buffer.externalData[pos + i].isNull || !vector) {
+            memset(row, 0, rowSize);
+            continue;
+        }
+        if (dpiOci__attrGet(vector->handle, DPI_OCI_DTYPE_VECTOR,
+                &actualFormat, 0, DPI_OCI_ATTR_VECTOR_DATA_FORMAT,
+                "get vector format", &error) < 0 ||
+                dpiOci__attrGet(vector->handle, DPI_OCI_DTYPE_VECTOR,
+                &actualDimensions, 0, DPI_OCI_ATTR_VECTOR_DIMENSION,
+                "get number of vector dimensions", &error) < 0) {
+            status = DPI_FAILURE;
+            break;
+        }
+
+        // the dimensions of binary vectors are bits, those of the others are
+        // numbers, which cannot be converted into each other
+        if ((actualFormat == DPI_VECTOR_FORMAT_BINARY) !=
+                (format == DPI_VECTOR_FORMAT_BINARY)) {
+            status = dpiError__set(&error, "check vector format",
+                    DPI_ERR_UNSUPPORTED_VECTOR_FORMAT, actualFormat);
+            break;
+        }
+        if (actualDimensions != numDimensions) {
+            status = dpiError__set(&error, "check vector dimensions",
+                    DPI_ERR_WRONG_VECTOR_DIMENSIONS, pos + i,
+                    actualDimensions, numDimensions);
+            break;
+        }
+        if (dpiOci__vectorToArrayBuffer(vector, format, &actualDimensions,
+                row, &error) < 0) {
+            status = DPI_FAILURE;
+            break;
+        }
+    }
+    return dpiGen__endPublicFn(var, status, &error);
+}
+
+
 //-----------------------------------------------------------------------------
 // dpiVar_release() [PUBLIC]
 //   Release a reference to the variable.
@@ -2007,3 +2357,57 @@ int dpiVar_setNumElementsInArray(dpiVar *var, uint32_t numElements)
     var->buffer.actualArraySize = numElements;
     return dpiGen__endPublicFn(var, DPI_SUCCESS, &error);
 }
+
+
+//-----------------------------------------------------------------------------
+// dpiVar_setVectorValues() [PUBLIC]
+//   Set the values of the variable at the given range of array positions to
+// the dense vectors found contiguously in the buffer supplied by the caller
+// (numRows vectors of numDimensions dimensions each, in the given format).
+// The vector descriptors already allocated by the variable are reused, so no
+// memory is allocated and no reference to the buffer is retained.
+//-----------------------------------------------------------------------------
+int dpiVar_setVectorValues(dpiVar *var, uint32_t pos, uint32_t numRows,
+        uint8_t format, uint32_t numDimensions, const void *values)
+{
+    uint32_t i, rowSize;
+    uint8_t dimensionSize;
+    dpiVectorInfo info;
+    dpiVector *vector;
+    const char *row;
+    dpiError error;
+    int status;
+
+    if (dpiVar__checkArraySize(var, pos, __func__, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+    DPI_CHECK_PTR_NOT_NULL(var, values)
+    if (dpiVar__checkVectorRange(var, pos, numRows, format, numDimensions,
+            &rowSize, &dimensionSize, &error) < 0)
+        return dpiGen__endPublicFn(var, DPI_FAILURE, &error);
+
+    memset(&info, 0, sizeof(info));
+    info.format = format;
+    info.numDimensions = numDimensions;
+    info.dimensionSize = dimensionSize;
+    status = DPI_SUCCESS;
+    row = (const char*) values;
+    for (i = 0; i < numRows; i++, row += rowSize) {
+        vector = var->buffer.references[pos + i].asVector;
+        if (!vector) {
+            if (dpiVector__allocate(var->conn, &vector, &error) < 0) {
+                status = DPI_FAILURE;
+                break;
+            }
+            var->buffer.references[pos + i].asVector = vector;
+            var->buffer.data.asVectorDescriptor[pos + i] = vector->handle;
+            var->buffer.externalData[pos + i].value.asVector = vector;
+        }
+        info.dimensions.asPtr = (void*) row;
+        if (dpiOci__vectorFromArray(vector, &info, &error) < 0) {
+            status = DPI_FAILURE;
+            break;
+        }
+        var->buffer.externalData[pos + i].isNull = 0;
+    }
+    return dpiGen__endPublicFn(var, status, &error);
+}
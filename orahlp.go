@@ -403,6 +403,16 @@ func MapToSlice(qry string, metParam func(string) interface{}) (string, []interf
 		metParam = func(string) interface{} { return nil }
 	}
 	arr := make([]interface{}, 0, 16)
+	qry = renamePlaceholders(qry, false, func(name string) string {
+		arr = append(arr, metParam(name))
+		return fmt.Sprintf(":%d", len(arr))
+	})
+	return qry, arr
+}
+
+// renamePlaceholders replaces each :name placeholder of qry (outside of strings and comments)
+// with the result of rename(name), in order. With numbers, :1 is a placeholder, too.
+func renamePlaceholders(qry string, numbers bool, rename func(name string) string) string {
 	var buf bytes.Buffer
 	state, p, last := 0, 0, 0
 	var prev rune
@@ -412,8 +422,7 @@ func MapToSlice(qry string, metParam func(string) interface{}) (string, []interf
 		if i-p <= 1 { // :=
 			return
 		}
-		arr = append(arr, metParam(qry[p+1:i]))
-		param := fmt.Sprintf(":%d", len(arr))
+		param := rename(qry[p+1 : i])
 		buf.WriteString(qry[last:p])
 		buf.WriteString(param)
 		last = i
@@ -453,7 +462,8 @@ func MapToSlice(qry string, metParam func(string) interface{}) (string, []interf
 			}
 		case 1:
 			if !('A' <= r && r <= 'Z' || 'a' <= r && r <= 'z' ||
-				(i-p > 1 && ('0' <= r && r <= '9' || r == '$' || r == '_' || r == '#'))) {
+				((i-p > 1 || numbers) && '0' <= r && r <= '9') ||
+				(i-p > 1 && (r == '$' || r == '_' || r == '#'))) {
 
 				Add(i)
 			}
@@ -466,7 +476,7 @@ func MapToSlice(qry string, metParam func(string) interface{}) (string, []interf
 	if last <= len(qry)-1 {
 		buf.WriteString(qry[last:])
 	}
-	return buf.String(), arr
+	return buf.String()
 }
 
 // EnableDbmsOutput enables DBMS_OUTPUT buffering on the given connection.
@@ -609,6 +619,26 @@ func getConn(ctx context.Context, ex Execer) (*conn, error) {
 	return c.(*conn), nil
 }
 
+// getOwnedConn returns the connection of ex, and whether it is a new one
+// (acquired from the pool of an *sql.DB), to be closed by the caller.
+func getOwnedConn(ctx context.Context, ex Execer) (*conn, bool, error) {
+	cx, err := getConn(ctx, ex)
+	if err != nil {
+		return nil, false, err
+	}
+	// Check whether this is a pool or a single connection.
+	cx2, err := getConn(ctx, ex)
+	if err != nil {
+		cx.Close()
+		return nil, false, err
+	}
+	owned := cx.dpiConn != cx2.dpiConn
+	if owned {
+		cx2.Close()
+	}
+	return cx, owned, nil
+}
+
 // Raw executes f on the given *sql.DB or *sql.Conn.
 func Raw(ctx context.Context, ex Execer, f func(driverConn Conn) error) error {
 	sf := func(driverConn interface{}) error { return f(driverConn.(Conn)) }
@@ -0,0 +1,180 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+import (
+	"context"
+	"database/sql"
+	"errors"
+	"fmt"
+	"io"
+	"strings"
+
+	"golang.org/x/sync/errgroup"
+)
+
+// DefaultParallelFetchArraySize is the FetchArraySize (and PrefetchCount) of the chunk queries of ParallelQuery.
+const DefaultParallelFetchArraySize = 4096
+
+// ParallelQuery executes qry over (at most) degree ROWID ranges of table concurrently,
+// each on its own session of db, and calls f after each batch
+// (of at most FetchArraySize rows) has been fetched into dest, as QueryColumns does,
+// with the index of the chunk.
+//
+// qry must restrict the rows to the chunk with the :rowid_lo and :rowid_hi placeholders, such as
+//
+//	SELECT id, name FROM tbl WHERE ROWID BETWEEN :rowid_lo AND :rowid_hi
+//
+// so its args must be sql.Named (or Options, which override DefaultParallelFetchArraySize).
+// The ranges are computed from the extents of table (without reading it), splitting its blocks
+// into degree about equal chunks, as DBMS_PARALLEL_EXECUTE.CREATE_CHUNKS_BY_ROWID does.
+// A table without segment yet (deferred segment creation) has no chunks, so f is not called.
+//
+// f is called from one goroutine, with the batches of the chunks interleaved.
+// Each chunk has two sets of buffers, so at most 2*degree batches are held in memory,
+// and dest is reused after f returns.
+//
+// The chunks are read by different sessions, so they are not one consistent snapshot
+// (use AS OF SCN in qry for that).
+func ParallelQuery(ctx context.Context, db *sql.DB, table, qry string, degree int, args []interface{}, f func(chunk int, dest []ColumnBuffer, n int) error) error {
+	if degree <= 0 {
+		degree = 1
+	}
+	if strings.IndexFunc(table, func(r rune) bool {
+		return !('A' <= r && r <= 'Z' || 'a' <= r && r <= 'z' || '0' <= r && r <= '9' || strings.ContainsRune(`_$#."@`, r))
+	}) >= 0 {
+		return fmt.Errorf("%q is not a table name", table)
+	}
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+	ranges, err := rowidRanges(ctx, db, table, degree)
+	if err != nil {
+		return err
+	}
+
+	type batch struct {
+		free  chan []ColumnBuffer
+		dest  []ColumnBuffer
+		chunk int
+		n     int
+	}
+	batches := make(chan batch)
+	grp, grpCtx := errgroup.WithContext(ctx)
+	for i, rng := range ranges {
+		chunk := i
+		qArgs := make([]interface{}, 0, 2+len(args)+2)
+		qArgs = append(qArgs, FetchArraySize(DefaultParallelFetchArraySize), PrefetchCount(DefaultParallelFetchArraySize+1))
+		qArgs = append(qArgs, args...)
+		qArgs = append(qArgs, sql.Named("rowid_lo", rng[0]), sql.Named("rowid_hi", rng[1]))
+		grp.Go(func() error {
+			free := make(chan []ColumnBuffer, 2)
+			free <- nil
+			free <- nil
+			return queryRaw(grpCtx, db, qry, qArgs, func(r *rows) error {
+				for {
+					var dest []ColumnBuffer
+					select {
+					case dest = <-free:
+					case <-grpCtx.Done():
+						return grpCtx.Err()
+					}
+					dest = resize(dest, len(r.columns))
+					n, err := r.FetchColumns(dest)
+					if err != nil {
+						if errors.Is(err, io.EOF) {
+							return nil
+						}
+						return fmt.Errorf("chunk %d: %w", chunk, err)
+					}
+					select {
+					case batches <- batch{free: free, dest: dest, chunk: chunk, n: n}:
+					case <-grpCtx.Done():
+						return grpCtx.Err()
+					}
+				}
+			})
+		})
+	}
+	waitErr := make(chan error, 1)
+	go func() { waitErr <- grp.Wait(); close(batches) }()
+
+	var fErr error
+	for b := range batches {
+		if fErr == nil {
+			if fErr = f(b.chunk, b.dest, b.n); fErr != nil {
+				cancel()
+			}
+		}
+		b.free <- b.dest
+	}
+	if err = <-waitErr; fErr != nil {
+		return fErr
+	}
+	return err
+}
+
+// rowidRanges returns the first and last ROWIDs of (at most) n chunks of the rows of table,
+// of about equal size.
+//
+// As DBMS_PARALLEL_EXECUTE.CREATE_CHUNKS_BY_ROWID, the chunks are built from the extents
+// of the segments of table (USER_EXTENTS, or DBA_EXTENTS for "owner.table"),
+// grouped in ROWID order by their cumulative number of blocks, so the table itself is not read.
+func rowidRanges(ctx context.Context, db *sql.DB, table string, n int) ([][2]string, error) {
+	name, link, _ := strings.Cut(table, "@")
+	if link != "" {
+		link = "@" + link
+	}
+	owner, name, hasOwner := strings.Cut(name, ".")
+	if !hasOwner {
+		owner, name = "", owner
+	}
+	dictName := func(s string) string {
+		if len(s) > 1 && s[0] == '"' && s[len(s)-1] == '"' {
+			return s[1 : len(s)-1]
+		}
+		return strings.ToUpper(s)
+	}
+	views, cond := "USER_EXTENTS"+link+" e JOIN USER_OBJECTS"+link+" o ON ", ""
+	args := []interface{}{n, dictName(name)}
+	if hasOwner {
+		views, cond = "DBA_EXTENTS"+link+" e JOIN DBA_OBJECTS"+link+" o ON o.owner = e.owner AND ", " AND e.owner = :3"
+		args = append(args, dictName(owner))
+	}
+	// The extents are ordered as their ROWIDs: data object, relative file, block.
+	const ord = "ORDER BY data_object_id, relative_fno, block_id"
+	qry := `SELECT ROWIDTOCHAR(DBMS_ROWID.ROWID_CREATE(1, lo_obj, lo_fno, lo_block, 0)),
+       ROWIDTOCHAR(DBMS_ROWID.ROWID_CREATE(1, hi_obj, hi_fno, hi_block, 32767))
+  FROM (SELECT grp,
+               MIN(data_object_id) KEEP (DENSE_RANK FIRST ` + ord + `) AS lo_obj,
+               MIN(relative_fno) KEEP (DENSE_RANK FIRST ` + ord + `) AS lo_fno,
+               MIN(block_id) KEEP (DENSE_RANK FIRST ` + ord + `) AS lo_block,
+               MAX(data_object_id) KEEP (DENSE_RANK LAST ` + ord + `) AS hi_obj,
+               MAX(relative_fno) KEEP (DENSE_RANK LAST ` + ord + `) AS hi_fno,
+               MAX(block_id + blocks - 1) KEEP (DENSE_RANK LAST ` + ord + `) AS hi_block
+          FROM (SELECT o.data_object_id, e.relative_fno, e.block_id, e.blocks,
+                       TRUNC((SUM(e.blocks) OVER (ORDER BY o.data_object_id, e.relative_fno, e.block_id) - e.blocks) *
+                             :1 / SUM(e.blocks) OVER ()) AS grp
+                  FROM ` + views + `o.object_name = e.segment_name
+                       AND NVL(o.subobject_name, '-') = NVL(e.partition_name, '-')
+                       AND o.object_type LIKE 'TABLE%'
+                 WHERE e.segment_name = :2 AND e.segment_type LIKE 'TABLE%'` + cond + `)
+         GROUP BY grp)
+  ORDER BY grp`
+	rows, err := db.QueryContext(ctx, qry, args...)
+	if err != nil {
+		return nil, fmt.Errorf("%s: %w", qry, err)
+	}
+	defer rows.Close()
+	ranges := make([][2]string, 0, n)
+	for rows.Next() {
+		var rng [2]string
+		if err = rows.Scan(&rng[0], &rng[1]); err != nil {
+			return nil, err
+		}
+		ranges = append(ranges, rng)
+	}
+	return ranges, rows.Err()
+}
@@ -0,0 +1,323 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+import (
+	"context"
+	"database/sql"
+	"database/sql/driver"
+	"fmt"
+	"strconv"
+	"strings"
+	"unicode"
+)
+
+// Pipeline queues statements (DML, queries, PL/SQL blocks, DDL and commits)
+// to be executed on the connection with one round trip, by Run.
+//
+// The statements are executed in order, as the parts of one anonymous PL/SQL
+// block, and the error of each is caught (and returned) separately,
+// so they should not depend on each other's success.
+//
+// The queries are opened as REF CURSORs, so their rows are fetched
+// only when read, as usual.
+type Pipeline struct {
+	cx  *sql.Conn
+	ops []pipelineOp
+}
+
+type pipelineOpKind uint8
+
+const (
+	pipelineSQL = pipelineOpKind(iota)
+	pipelinePLSQL
+	pipelineDDL
+	pipelineQuery
+	pipelineCommit
+)
+
+type pipelineOp struct {
+	qry  string
+	args []interface{}
+	kind pipelineOpKind
+}
+
+// PipelineResult is the result of one statement of a Pipeline.
+type PipelineResult struct {
+	// Rows are the rows of a query, to be closed by the caller (see WrapRows).
+	Rows driver.Rows
+	// Err is the error of the statement.
+	Err error
+	// RowsAffected is the number of rows affected by a DML statement.
+	RowsAffected int64
+}
+
+// pipelineOut receives the out binds of one statement.
+type pipelineOut struct {
+	rows     driver.Rows
+	message  string
+	affected int64
+	code     int64
+}
+
+// NewPipeline returns a new, empty Pipeline executing on the connection.
+//
+// The connection must be a *sql.Conn (not a *sql.DB), as the rows of the queries
+// are read from it after Run.
+func NewPipeline(cx *sql.Conn) *Pipeline { return &Pipeline{cx: cx} }
+
+// Len returns the number of statements queued.
+func (p *Pipeline) Len() int { return len(p.ops) }
+
+// Exec queues qry with args, as ExecContext would execute it.
+//
+// The args are either all positional, or all sql.Named.
+// DDL statements cannot have args.
+func (p *Pipeline) Exec(qry string, args ...interface{}) *Pipeline {
+	kind := pipelineSQL
+	switch firstWord(qry) {
+	case "BEGIN", "DECLARE":
+		kind = pipelinePLSQL
+	case "CREATE", "ALTER", "DROP", "TRUNCATE", "GRANT", "REVOKE", "RENAME",
+		"COMMENT", "ANALYZE", "AUDIT", "NOAUDIT", "PURGE", "FLASHBACK":
+		kind = pipelineDDL
+	}
+	p.ops = append(p.ops, pipelineOp{qry: qry, args: args, kind: kind})
+	return p
+}
+
+// Query queues the SELECT qry with args, as QueryContext would execute it.
+func (p *Pipeline) Query(qry string, args ...interface{}) *Pipeline {
+	p.ops = append(p.ops, pipelineOp{qry: qry, args: args, kind: pipelineQuery})
+	return p
+}
+
+// Commit queues a COMMIT.
+func (p *Pipeline) Commit() *Pipeline {
+	p.ops = append(p.ops, pipelineOp{qry: "COMMIT", kind: pipelineCommit})
+	return p
+}
+
+// Run executes the queued statements with one round trip,
+// and returns their results in order. The Pipeline is emptied.
+//
+// An error is returned only if the whole execution failed
+// (for example a statement does not compile), then no statement is executed.
+func (p *Pipeline) Run(ctx context.Context) ([]PipelineResult, error) {
+	ops := p.ops
+	p.ops = p.ops[:0]
+	if len(ops) == 0 {
+		return nil, nil
+	}
+	var results []PipelineResult
+	err := p.cx.Raw(func(driverConn interface{}) error {
+		c, ok := driverConn.(*conn)
+		if !ok {
+			return fmt.Errorf("%T is not a godror connection", driverConn)
+		}
+		var err error
+		results, err = c.runPipeline(ctx, ops)
+		return err
+	})
+	return results, err
+}
+
+// runPipeline executes the statements of ops with one round trip.
+func (c *conn) runPipeline(ctx context.Context, ops []pipelineOp) ([]PipelineResult, error) {
+	outs := make([]pipelineOut, len(ops))
+	qry, args, err := buildPipeline(ops, outs)
+	if err != nil {
+		return nil, err
+	}
+	st, err := c.PrepareContext(ctx, qry)
+	if err != nil {
+		return nil, err
+	}
+	defer st.Close()
+	if _, err = st.(*statement).ExecContext(ctx, args); err != nil {
+		return nil, fmt.Errorf("pipeline of %d: %w", len(ops), err)
+	}
+	results := make([]PipelineResult, len(ops))
+	for i, out := range outs {
+		results[i] = PipelineResult{Rows: out.rows, RowsAffected: out.affected}
+		if out.code != 0 {
+			results[i].Err = pipelineError(out.code, out.message)
+		}
+	}
+	return results, nil
+}
+
+// firstWord returns the first word of qry, in upper case.
+func firstWord(qry string) string {
+	qry = strings.TrimLeftFunc(qry, unicode.IsSpace)
+	if i := strings.IndexFunc(qry, unicode.IsSpace); i >= 0 {
+		qry = qry[:i]
+	}
+	return strings.ToUpper(qry)
+}
+
+// trimTerminator returns the SQL statement qry without its terminating ";",
+// for executing it dynamically - except for creating a PL/SQL unit
+// (CREATE [OR REPLACE] PROCEDURE/FUNCTION/PACKAGE/TRIGGER/TYPE/LIBRARY),
+// whose final "END;" is part of its source.
+func trimTerminator(qry string) string {
+	qry = strings.TrimSpace(qry)
+	if isPLSQLUnitDDL(qry) {
+		return qry
+	}
+	return strings.TrimRight(qry, "; \t\r\n")
+}
+
+// isPLSQLUnitDDL reports whether qry creates a PL/SQL unit.
+func isPLSQLUnitDDL(qry string) bool {
+	if firstWord(qry) != "CREATE" {
+		return false
+	}
+	if len(qry) > 128 {
+		qry = qry[:128]
+	}
+	words := strings.Fields(strings.ToUpper(qry))[1:]
+	for len(words) != 0 {
+		switch words[0] {
+		case "OR", "REPLACE", "EDITIONABLE", "NONEDITIONABLE":
+			words = words[1:]
+		case "PROCEDURE", "FUNCTION", "PACKAGE", "TRIGGER", "TYPE", "LIBRARY":
+			return true
+		default:
+			return false
+		}
+	}
+	return false
+}
+
+// buildPipeline returns the PL/SQL block executing ops, and its binds,
+// with the out binds into outs.
+//
+// The placeholders of the i-th statement are renamed to :p<i>_<k>,
+// and its own out binds are :p<i>_n (rows affected), :p<i>_c (SQLCODE),
+// :p<i>_m (SQLERRM) and :p<i>_r (REF CURSOR).
+func buildPipeline(ops []pipelineOp, outs []pipelineOut) (string, []driver.NamedValue, error) {
+	var buf strings.Builder
+	args := make([]driver.NamedValue, 0, 4*len(ops))
+	bind := func(prefix, suffix string, value interface{}) string {
+		name := prefix + suffix
+		args = append(args, driver.NamedValue{Name: name, Ordinal: len(args) + 1, Value: value})
+		return ":" + name
+	}
+	buf.WriteString("BEGIN\n")
+	for i, op := range ops {
+		prefix := "p" + strconv.Itoa(i) + "_"
+		qry := strings.TrimSpace(op.qry)
+		if op.kind != pipelinePLSQL {
+			qry = trimTerminator(qry)
+		}
+		switch op.kind {
+		case pipelineDDL:
+			if len(op.args) != 0 {
+				return "", nil, fmt.Errorf("%d. statement: DDL cannot have arguments", i)
+			}
+			qry = "EXECUTE IMMEDIATE '" + strings.ReplaceAll(qry, "'", "''") + "'"
+		case pipelineCommit:
+		default:
+			var err error
+			if qry, err = renamePipelineArgs(qry, op, func(k int, value interface{}) string {
+				return bind(prefix, strconv.Itoa(k), value)
+			}); err != nil {
+				return "", nil, fmt.Errorf("%d. statement: %w", i, err)
+			}
+		}
+
+		// the statement may end with a -- comment, so the ; must be on a new line
+		buf.WriteString("BEGIN\n")
+		switch op.kind {
+		case pipelineQuery:
+			buf.WriteString("OPEN " + bind(prefix, "r", sql.Out{Dest: &outs[i].rows}) + " FOR ")
+			buf.WriteString(qry)
+			buf.WriteString("\n;\n")
+		case pipelinePLSQL:
+			buf.WriteString(qry)
+			buf.WriteByte('\n')
+		default:
+			buf.WriteString(qry)
+			buf.WriteString("\n;\n")
+			if op.kind == pipelineSQL {
+				buf.WriteString(bind(prefix, "n", sql.Out{Dest: &outs[i].affected}) + " := SQL%ROWCOUNT;\n")
+			}
+		}
+		buf.WriteString("EXCEPTION WHEN OTHERS THEN " +
+			bind(prefix, "c", sql.Out{Dest: &outs[i].code}) + " := SQLCODE; " +
+			bind(prefix, "m", sql.Out{Dest: &outs[i].message}) + " := SQLERRM;\nEND;\n")
+	}
+	buf.WriteString("END;")
+	return buf.String(), args, nil
+}
+
+// renamePipelineArgs renames the placeholders of qry with rename,
+// which binds the matching argument of op.
+//
+// Positional arguments are matched to the placeholders in order of occurrence,
+// except in PL/SQL blocks, where each distinct name is one bind variable.
+func renamePipelineArgs(qry string, op pipelineOp, rename func(k int, value interface{}) string) (string, error) {
+	var named map[string]interface{}
+	for _, a := range op.args {
+		if na, ok := a.(sql.NamedArg); ok {
+			if named == nil {
+				named = make(map[string]interface{}, len(op.args))
+			}
+			named[strings.ToUpper(na.Name)] = na.Value
+		}
+	}
+	if named != nil && len(named) != len(op.args) {
+		return "", fmt.Errorf("mixed positional and named arguments")
+	}
+	var err error
+	var seen map[string]string
+	var k int
+	qry = renamePlaceholders(qry, true, func(name string) string {
+		key := strings.ToUpper(name)
+		if s, ok := seen[key]; ok {
+			return s
+		}
+		var value interface{}
+		if named != nil {
+			var ok bool
+			if value, ok = named[key]; !ok && err == nil {
+				err = fmt.Errorf("no argument for :%s", name)
+			}
+		} else if k < len(op.args) {
+			value = op.args[k]
+		} else if err == nil {
+			err = fmt.Errorf("%d arguments for more placeholders", len(op.args))
+		}
+		k++
+		s := rename(k, value)
+		if named != nil || op.kind == pipelinePLSQL {
+			if seen == nil {
+				seen = make(map[string]string)
+			}
+			seen[key] = s
+		}
+		return s
+	})
+	if err == nil && named == nil && k != len(op.args) {
+		err = fmt.Errorf("%d arguments for %d placeholders", len(op.args), k)
+	}
+	return qry, err
+}
+
+// pipelineError returns the error of SQLCODE and SQLERRM.
+func pipelineError(code int64, message string) error {
+	if code == 100 { // NO_DATA_FOUND
+		code = -1403
+	}
+	if code < 0 {
+		code = -code
+	}
+	if _, after, ok := strings.Cut(message, ": "); ok && strings.HasPrefix(message, "ORA-") {
+		message = after
+	}
+	return &OraErr{code: int(code), message: strings.TrimSpace(message)}
+}
@@ -64,22 +64,11 @@ func WithEnqOptions(o EnqOptions) queueOption { return o }
 // WARNING: the connection given to it must not be closed before the Queue is closed!
 // So use an sql.Conn for it.
 func NewQueue(ctx context.Context, execer Execer, name string, payloadObjectTypeName string, options ...queueOption) (*Queue, error) {
-	cx, err := DriverConn(ctx, execer)
+	cx, owned, err := getOwnedConn(ctx, execer)
 	if err != nil {
 		return nil, err
 	}
-	// Check whether this is a pool or a single connection.
-	cx2, err := DriverConn(ctx, execer)
-	if err != nil {
-		cx.Close()
-		return nil, err
-	}
-	//fmt.Printf("cx=%p cx2=%p\n", cx.(*conn).dpiConn, cx2.(*conn).dpiConn)
-	owned := cx.(*conn).dpiConn != cx2.(*conn).dpiConn
-	if owned {
-		cx2.Close()
-	}
-	Q := Queue{conn: cx.(*conn), name: name, connIsOwned: owned}
+	Q := Queue{conn: cx, name: name, connIsOwned: owned}
 
 	var payloadType *C.dpiObjectType
 	if payloadObjectTypeName != "" {
@@ -831,3 +820,176 @@ const (
 	// NavNext  	Retrieves the next available message that matches the search criteria. This is the default method.
 	NavNext = DeqNavigation(C.DPI_DEQ_NAV_NEXT_MSG)
 )
+
+// QueueBatch is a batch of messages received from the channel returned by Queue.Stream.
+//
+// Each batch must be finished with Ack or Nack, in the order of receiving.
+type QueueBatch struct {
+	stream *queueStream
+	buf    []Message
+	sent   bool
+	// Messages of the batch. They are reused for a later batch after Ack or Nack.
+	Messages []Message
+	// Err is the error of the dequeue, the last item of the stream.
+	Err error
+}
+
+type queueStream struct {
+	acks      chan queueAck
+	stopped   chan struct{}
+	immediate bool
+}
+
+type queueAck struct {
+	reply  chan error
+	commit bool
+}
+
+// Ack finishes processing the batch.
+//
+// With VisibleOnCommit (the default) dequeue visibility, it commits the transaction
+// of the dequeue, otherwise it just releases the batch for reuse.
+func (B *QueueBatch) Ack() error { return B.finish(true) }
+
+// Nack finishes processing the batch, rolling back the transaction of the dequeue,
+// with VisibleOnCommit dequeue visibility (so the messages are dequeued again later).
+//
+// With VisibleImmediate, the messages are already removed, so it is the same as Ack.
+func (B *QueueBatch) Nack() error { return B.finish(false) }
+
+func (B *QueueBatch) finish(commit bool) error {
+	s := B.stream
+	if s == nil {
+		return nil
+	}
+	B.stream = nil
+	a := queueAck{commit: commit}
+	if !s.immediate {
+		a.reply = make(chan error, 1)
+	}
+	errStopped := errors.New("queue stream has stopped")
+	select {
+	case s.acks <- a:
+	case <-s.stopped:
+		return errStopped
+	}
+	if a.reply == nil {
+		return nil
+	}
+	// the ack may have been buffered after the stream has stopped, so nothing would reply
+	select {
+	case err := <-a.reply:
+		return err
+	case <-s.stopped:
+		select {
+		case err := <-a.reply:
+			return err
+		default:
+			return errStopped
+		}
+	}
+}
+
+// Stream dequeues messages in batches of at most batchSize in the background,
+// converted to Messages, until ctx is done or an error occurs.
+//
+// With VisibleImmediate dequeue visibility, the next batch is dequeued
+// while the current one is processed.
+// With VisibleOnCommit (the default), each batch is dequeued in its own transaction,
+// which is committed by Ack (rolled back by Nack), before the next dequeue;
+// so the connection of the Queue must not be used by anything else meanwhile.
+//
+// When there are no messages, the dequeue is retried, so set DeqOptions.Wait to avoid busy looping.
+//
+// The channel is closed when the stream stops; a not finished VisibleOnCommit batch is rolled back then.
+func (Q *Queue) Stream(ctx context.Context, batchSize int) (<-chan *QueueBatch, error) {
+	if batchSize <= 0 {
+		return nil, fmt.Errorf("batchSize must be positive, got %d", batchSize)
+	}
+	D, err := Q.DeqOptions()
+	if err != nil {
+		return nil, err
+	}
+	s := queueStream{
+		acks: make(chan queueAck, 2), stopped: make(chan struct{}),
+		immediate: D.Visibility == VisibleImmediate,
+	}
+	ch := make(chan *QueueBatch)
+	go Q.stream(ctx, &s, ch, batchSize)
+	return ch, nil
+}
+
+func (Q *Queue) stream(ctx context.Context, s *queueStream, ch chan<- *QueueBatch, batchSize int) {
+	// all the dequeues and commits of the stream are on this thread
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+	defer close(ch)
+	defer close(s.stopped)
+
+	var inTran bool
+	defer func() {
+		if inTran {
+			_ = Q.conn.Rollback()
+		}
+	}()
+	// waitAck waits for the acknowledgement of the oldest sent batch.
+	waitAck := func() bool {
+		select {
+		case <-ctx.Done():
+			return false
+		case a := <-s.acks:
+			if !s.immediate {
+				err := Q.conn.endTran(a.commit)
+				inTran = false
+				a.reply <- err
+			}
+			return true
+		}
+	}
+	send := func(B *QueueBatch) bool {
+		select {
+		case <-ctx.Done():
+			return false
+		case ch <- B:
+			return true
+		}
+	}
+
+	var batches [2]QueueBatch
+	for k := 0; ; k = 1 - k {
+		B := &batches[k]
+		// the buffer of the batch can be reused only after its Ack
+		if B.sent {
+			if !waitAck() {
+				return
+			}
+			B.sent = false
+		}
+		if B.buf == nil {
+			B.buf = make([]Message, batchSize)
+		}
+		inTran = !s.immediate
+		var n int
+		var err error
+		for n == 0 && err == nil {
+			if ctx.Err() != nil {
+				return
+			}
+			n, err = Q.Dequeue(B.buf)
+		}
+		if err != nil {
+			send(&QueueBatch{Err: err})
+			return
+		}
+		B.Messages, B.stream, B.sent = B.buf[:n], s, true
+		if !send(B) {
+			return
+		}
+		if !s.immediate {
+			if !waitAck() {
+				return
+			}
+			B.sent = false
+		}
+	}
+}
@@ -553,3 +553,207 @@ func testQueue(
 	}
 
 }
+
+// setUpRawQueue creates a RAW queue (and its queue table), and returns a function that drops them.
+func setUpRawQueue(ctx context.Context, tb testing.TB, qName string) func() {
+	qTblName := qName + "_TBL"
+	var user string
+	if err := testDb.QueryRowContext(ctx, "SELECT USER FROM DUAL").Scan(&user); err != nil {
+		tb.Fatal(err)
+	}
+	tearDown := func() {
+		testDb.ExecContext(testContext(qName+"-teardown"),
+			`DECLARE
+			tbl CONSTANT VARCHAR2(61) := USER||'.'||:1;
+			q CONSTANT VARCHAR2(61) := USER||'.'||:2;
+		BEGIN
+			BEGIN SYS.DBMS_AQADM.stop_queue(q); EXCEPTION WHEN OTHERS THEN NULL; END;
+			BEGIN SYS.DBMS_AQADM.drop_queue(q); EXCEPTION WHEN OTHERS THEN NULL; END;
+			BEGIN SYS.DBMS_AQADM.drop_queue_table(tbl, TRUE); EXCEPTION WHEN OTHERS THEN NULL; END;
+		END;`,
+			qTblName, qName,
+		)
+	}
+	tearDown()
+	if _, err := testDb.ExecContext(ctx, `DECLARE
+		tbl CONSTANT VARCHAR2(61) := '`+user+"."+qTblName+`';
+		q CONSTANT VARCHAR2(61) := '`+user+"."+qName+`';
+	BEGIN
+		SYS.DBMS_AQADM.CREATE_QUEUE_TABLE(tbl, 'RAW');
+		SYS.DBMS_AQADM.CREATE_QUEUE(q, tbl);
+		SYS.DBMS_AQADM.start_queue(q);
+	END;`); err != nil {
+		if strings.Contains(err.Error(), "PLS-00201: identifier 'SYS.DBMS_AQADM' must be declared") {
+			tb.Skip(err.Error())
+		}
+		tb.Fatal(err)
+	}
+	return tearDown
+}
+
+func TestQueueStream(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("QueueStream"), 30*time.Second)
+	defer cancel()
+	const qName = "TEST_STREAM_Q"
+	defer setUpRawQueue(ctx, t, qName)()
+
+	for _, vis := range []godror.Visibility{godror.VisibleImmediate, godror.VisibleOnCommit} {
+		q, err := godror.NewQueue(ctx, testDb, qName, "",
+			godror.WithDeqOptions(godror.DeqOptions{
+				Mode: godror.DeqRemove, Visibility: vis,
+				Navigation: godror.NavFirst, Wait: time.Second,
+			}),
+			godror.WithEnqOptions(godror.EnqOptions{Visibility: godror.VisibleImmediate}),
+		)
+		if err != nil {
+			t.Fatal(err)
+		}
+		const msgCount = 25
+		msgs := make([]godror.Message, msgCount)
+		for i := range msgs {
+			msgs[i] = godror.Message{Raw: []byte(strconv.Itoa(i))}
+		}
+		if err = q.Enqueue(msgs); err != nil {
+			q.Close()
+			t.Fatal(err)
+		}
+
+		streamCtx, streamCancel := context.WithCancel(ctx)
+		ch, err := q.Stream(streamCtx, 10)
+		if err != nil {
+			streamCancel()
+			q.Close()
+			t.Fatal(err)
+		}
+		seen := make(map[string]bool, msgCount)
+		for B := range ch {
+			if B.Err != nil {
+				t.Error(B.Err)
+				break
+			}
+			if len(B.Messages) > 10 {
+				t.Errorf("%d: got %d messages in a batch of 10", vis, len(B.Messages))
+			}
+			for _, m := range B.Messages {
+				seen[string(m.Raw)] = true
+			}
+			if err = B.Ack(); err != nil {
+				t.Error(err)
+			}
+			if len(seen) == msgCount {
+				streamCancel()
+			}
+		}
+		streamCancel()
+		q.Close()
+		if len(seen) != msgCount {
+			t.Errorf("%d: got %d messages, wanted %d", vis, len(seen), msgCount)
+		}
+	}
+}
+
+func TestQueueStreamCancel(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("QueueStreamCancel"), 30*time.Second)
+	defer cancel()
+	const qName = "TEST_STREAM_CANCEL_Q"
+	defer setUpRawQueue(ctx, t, qName)()
+
+	q, err := godror.NewQueue(ctx, testDb, qName, "",
+		godror.WithDeqOptions(godror.DeqOptions{
+			Mode: godror.DeqRemove, Visibility: godror.VisibleOnCommit,
+			Navigation: godror.NavFirst, Wait: time.Second,
+		}),
+		godror.WithEnqOptions(godror.EnqOptions{Visibility: godror.VisibleImmediate}),
+	)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer q.Close()
+	msgs := make([]godror.Message, 5)
+	for i := range msgs {
+		msgs[i] = godror.Message{Raw: []byte(strconv.Itoa(i))}
+	}
+	if err = q.Enqueue(msgs); err != nil {
+		t.Fatal(err)
+	}
+
+	for _, ack := range []bool{true, false} {
+		streamCtx, streamCancel := context.WithCancel(ctx)
+		ch, err := q.Stream(streamCtx, 10)
+		if err != nil {
+			streamCancel()
+			t.Fatal(err)
+		}
+		B, ok := <-ch
+		if !ok || B.Err != nil {
+			streamCancel()
+			t.Fatalf("got no batch: %v", B)
+		}
+		// cancel while the batch is still out, and wait for the stream to stop
+		streamCancel()
+		for range ch {
+		}
+		done := make(chan error, 1)
+		go func() {
+			if ack {
+				done <- B.Ack()
+			} else {
+				done <- B.Nack()
+			}
+		}()
+		select {
+		case err = <-done:
+			if err == nil {
+				t.Errorf("ack=%t: wanted an error after the stream stopped", ack)
+			}
+			t.Logf("ack=%t: %v", ack, err)
+		case <-time.After(5 * time.Second):
+			t.Fatalf("ack=%t: hangs after the stream stopped", ack)
+		}
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=Dequeue -test.benchmem
+func BenchmarkDequeue(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("Dequeue"), 10*time.Minute)
+	defer cancel()
+	const qName = "TEST_BENCH_DEQ_Q"
+	const batchSize = 1000
+	defer setUpRawQueue(ctx, b, qName)()
+
+	q, err := godror.NewQueue(ctx, testDb, qName, "",
+		godror.WithDeqOptions(godror.DeqOptions{
+			Mode: godror.DeqRemove, Visibility: godror.VisibleImmediate,
+			Navigation: godror.NavFirst, Wait: time.Second,
+		}),
+		godror.WithEnqOptions(godror.EnqOptions{Visibility: godror.VisibleImmediate}),
+	)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer q.Close()
+
+	msgs := make([]godror.Message, batchSize)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		b.StopTimer()
+		for j := range msgs {
+			msgs[j] = godror.Message{Raw: []byte("message " + strconv.Itoa(j))}
+		}
+		if err = q.Enqueue(msgs); err != nil {
+			b.Fatal(err)
+		}
+		b.StartTimer()
+		for got := 0; got < batchSize; {
+			n, err := q.Dequeue(msgs)
+			if err != nil {
+				b.Fatal(err)
+			}
+			if n == 0 {
+				b.Fatalf("got only %d messages of %d", got, batchSize)
+			}
+			got += n
+		}
+	}
+}
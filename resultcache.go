@@ -0,0 +1,371 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+
+import (
+	"bytes"
+	"container/list"
+	"context"
+	"database/sql"
+	"database/sql/driver"
+	"errors"
+	"fmt"
+	"io"
+	"reflect"
+	"strings"
+	"sync"
+	"time"
+)
+
+// DefaultResultCacheSize is the memory bound of a ResultCache by default.
+const DefaultResultCacheSize = 64 << 20
+
+// CachedResult is a query result of a ResultCache.
+//
+// It is shared by all the readers of the same query and arguments, so it MUST NOT be modified!
+type CachedResult struct {
+	Columns []string
+	Rows    [][]interface{}
+}
+
+// ResultCache caches the results of queries by the SQL text and the bind values,
+// and drops them when a Continuous Query Notification reports a change of their result.
+//
+// The results are kept in memory up to a bound, evicting the least recently used ones.
+// Each cached query stays registered for notifications till the ResultCache is closed.
+//
+// The misses are executed one at a time, on the connection of the subscription,
+// which must have been opened with "enableEvents=1",
+// and the user must have the CHANGE NOTIFICATION privilege.
+type ResultCache struct {
+	subscr      *Subscription
+	conn        *conn
+	entries     map[string]*list.Element
+	byQueryID   map[uint64]map[string]struct{}
+	pending     map[uint64]struct{} // queries changed during the current miss
+	lru         *list.List          // of *resultCacheEntry, the most recently used first
+	size        int
+	maxSize     int
+	pendingAll  bool
+	connIsOwned bool
+	mu          sync.Mutex
+	loadMu      sync.Mutex
+}
+
+type resultCacheEntry struct {
+	result  *CachedResult
+	key     string
+	queryID uint64
+	size    int
+}
+
+// NewResultCache returns a ResultCache of at most maxSize bytes (DefaultResultCacheSize if maxSize <= 0),
+// using a new subscription on a connection of ex.
+func NewResultCache(ctx context.Context, ex Execer, maxSize int, options ...SubscriptionOption) (*ResultCache, error) {
+	cx, owned, err := getOwnedConn(ctx, ex)
+	if err != nil {
+		return nil, err
+	}
+	if maxSize <= 0 {
+		maxSize = DefaultResultCacheSize
+	}
+	rc := ResultCache{
+		conn: cx, connIsOwned: owned, maxSize: maxSize,
+		entries: make(map[string]*list.Element), byQueryID: make(map[uint64]map[string]struct{}),
+		lru: list.New(),
+	}
+	if rc.subscr, err = cx.NewSubscription("", rc.invalidate, options...); err != nil {
+		if owned {
+			cx.Close()
+		}
+		return nil, err
+	}
+	return &rc, nil
+}
+
+// Close the subscription (and the connection, if it was taken from a pool).
+func (rc *ResultCache) Close() error {
+	rc.mu.Lock()
+	subscr, cx := rc.subscr, rc.conn
+	rc.subscr, rc.conn = nil, nil
+	rc.removeAll()
+	rc.mu.Unlock()
+	if subscr == nil {
+		return nil
+	}
+	rc.loadMu.Lock()
+	err := subscr.Close()
+	rc.loadMu.Unlock()
+	if rc.connIsOwned {
+		cx.Close()
+	}
+	return err
+}
+
+// Query returns the cached result of qry with args, or executes qry (registering it for change notification)
+// and caches its result.
+//
+// args may contain sql.NamedArg and Option values, but the Options are not part of the cache key.
+// The key has the values of the args, so pointers are dereferenced and driver.Valuers converted,
+// and sql.Out or other args without comparable values are rejected.
+// Only results of scalar columns (not LOBs - see LobAsReader -, objects or cursors) can be cached.
+func (rc *ResultCache) Query(ctx context.Context, qry string, args ...interface{}) (*CachedResult, error) {
+	key, err := resultCacheKey(qry, args)
+	if err != nil {
+		return nil, err
+	}
+	rc.mu.Lock()
+	if elt := rc.entries[key]; elt != nil {
+		rc.lru.MoveToFront(elt)
+		rc.mu.Unlock()
+		return elt.Value.(*resultCacheEntry).result, nil
+	}
+	rc.mu.Unlock()
+
+	rc.loadMu.Lock()
+	defer rc.loadMu.Unlock()
+	rc.mu.Lock()
+	// maybe loaded while we were waiting
+	if elt := rc.entries[key]; elt != nil {
+		rc.lru.MoveToFront(elt)
+		rc.mu.Unlock()
+		return elt.Value.(*resultCacheEntry).result, nil
+	}
+	subscr := rc.subscr
+	if subscr == nil {
+		rc.mu.Unlock()
+		return nil, errors.New("result cache is closed")
+	}
+	rc.pending, rc.pendingAll = make(map[uint64]struct{}), false
+	rc.mu.Unlock()
+
+	result, queryID, size, err := rc.load(ctx, subscr, qry, args)
+
+	rc.mu.Lock()
+	defer rc.mu.Unlock()
+	_, changed := rc.pending[queryID]
+	changed = changed || rc.pendingAll
+	rc.pending, rc.pendingAll = nil, false
+	if err != nil {
+		return nil, err
+	}
+	// the result may be stale already, so return it without caching
+	if changed || rc.subscr == nil {
+		return result, nil
+	}
+	size += len(key)
+	if size > rc.maxSize {
+		return result, nil
+	}
+	for rc.size+size > rc.maxSize {
+		rc.remove(rc.lru.Back())
+	}
+	rc.entries[key] = rc.lru.PushFront(&resultCacheEntry{result: result, key: key, queryID: queryID, size: size})
+	rc.size += size
+	ids := rc.byQueryID[queryID]
+	if ids == nil {
+		ids = make(map[string]struct{}, 1)
+		rc.byQueryID[queryID] = ids
+	}
+	ids[key] = struct{}{}
+	return result, nil
+}
+
+// load executes qry with args through the subscription,
+// returning the result, its query ID and its estimated memory size.
+func (rc *ResultCache) load(ctx context.Context, subscr *Subscription, qry string, args []interface{}) (*CachedResult, uint64, int, error) {
+	st, err := subscr.prepareStmt(qry)
+	if err != nil {
+		return nil, 0, 0, err
+	}
+	defer st.Close()
+	nvs := make([]driver.NamedValue, 0, len(args))
+	for _, a := range args {
+		nv := driver.NamedValue{Ordinal: len(nvs) + 1, Value: a}
+		if na, ok := a.(sql.NamedArg); ok {
+			nv.Name, nv.Value = na.Name, na.Value
+		}
+		if err = st.CheckNamedValue(&nv); err == driver.ErrRemoveArgument {
+			continue
+		} else if err != nil {
+			return nil, 0, 0, err
+		}
+		nvs = append(nvs, nv)
+	}
+	dr, err := st.QueryContext(ctx, nvs)
+	if err != nil {
+		return nil, 0, 0, fmt.Errorf("%s: %w", qry, err)
+	}
+	r := dr.(*rows)
+	defer r.Close()
+	var queryID C.uint64_t
+	if err = st.checkExec(func() C.int { return C.dpiStmt_getSubscrQueryId(st.dpiStmt, &queryID) }); err != nil {
+		return nil, 0, 0, fmt.Errorf("getSubscrQueryId: %w", err)
+	}
+
+	result := CachedResult{Columns: r.Columns()}
+	size := 64
+	for _, c := range result.Columns {
+		size += len(c) + 16
+	}
+	for {
+		dest := make([]driver.Value, len(result.Columns))
+		if err = r.Next(dest); err != nil {
+			if errors.Is(err, io.EOF) {
+				break
+			}
+			return nil, 0, 0, err
+		}
+		row := make([]interface{}, len(dest))
+		size += 24 + 16*len(dest)
+		for i, v := range dest {
+			switch x := v.(type) {
+			case nil, bool, int64, uint64, float32, float64, time.Time:
+			case string:
+				size += len(x)
+			case Number:
+				size += len(x)
+			case []byte:
+				size += len(x) + 8
+				if r.BorrowBytes() { // points into the fetch buffer
+					v = bytes.Clone(x)
+				}
+			default:
+				return nil, 0, 0, fmt.Errorf("%s: column %q of type %T cannot be cached", qry, result.Columns[i], v)
+			}
+			row[i] = v
+		}
+		result.Rows = append(result.Rows, row)
+	}
+	return &result, uint64(queryID), size, nil
+}
+
+// invalidate removes the results changed according to the event.
+func (rc *ResultCache) invalidate(e Event) {
+	rc.mu.Lock()
+	defer rc.mu.Unlock()
+	if e.Err != nil || e.Type != EvtQueryChange {
+		// the registrations may be lost, or the event does not tell the queries
+		if rc.pending != nil {
+			rc.pendingAll = true
+		}
+		rc.removeAll()
+		return
+	}
+	for _, q := range e.Queries {
+		if rc.pending != nil {
+			rc.pending[q.ID] = struct{}{}
+		}
+		for key := range rc.byQueryID[q.ID] {
+			rc.remove(rc.entries[key])
+		}
+	}
+}
+
+func (rc *ResultCache) remove(elt *list.Element) {
+	if elt == nil {
+		return
+	}
+	entry := rc.lru.Remove(elt).(*resultCacheEntry)
+	delete(rc.entries, entry.key)
+	if ids := rc.byQueryID[entry.queryID]; ids != nil {
+		if delete(ids, entry.key); len(ids) == 0 {
+			delete(rc.byQueryID, entry.queryID)
+		}
+	}
+	rc.size -= entry.size
+}
+
+func (rc *ResultCache) removeAll() {
+	rc.entries = make(map[string]*list.Element)
+	rc.byQueryID = make(map[uint64]map[string]struct{})
+	rc.lru.Init()
+	rc.size = 0
+}
+
+// resultCacheKey returns the key of qry with the bind values of args (without the Options).
+//
+// Each value is written with its type in Go syntax (%#v), so strings are quoted
+// and slice elements separated unambiguously.
+func resultCacheKey(qry string, args []interface{}) (string, error) {
+	if len(args) == 0 {
+		return qry, nil
+	}
+	var buf strings.Builder
+	buf.WriteString(qry)
+	for i, a := range args {
+		if _, ok := a.(Option); ok {
+			continue
+		}
+		if na, ok := a.(sql.NamedArg); ok {
+			fmt.Fprintf(&buf, "\x00:%q", na.Name)
+			a = na.Value
+		}
+		v, err := resultCacheValue(a)
+		if err != nil {
+			return "", fmt.Errorf("%s: arg %d: %w", qry, i+1, err)
+		}
+		fmt.Fprintf(&buf, "\x00%T\x00%#v", v, v)
+	}
+	return buf.String(), nil
+}
+
+// resultCacheValue returns the bind value a as it identifies the result:
+// pointers dereferenced and driver.Valuers converted, so no address is part of the key.
+func resultCacheValue(a interface{}) (interface{}, error) {
+	for {
+		if rv := reflect.ValueOf(a); rv.Kind() == reflect.Ptr {
+			if rv.IsNil() {
+				return nil, nil
+			}
+			if _, ok := a.(driver.Valuer); !ok {
+				a = rv.Elem().Interface()
+				continue
+			}
+		}
+		switch x := a.(type) {
+		case nil:
+			return nil, nil
+		case sql.Out:
+			return nil, errors.New("output binds cannot be cached")
+		case time.Time:
+			return x.Round(0), nil // without the monotonic clock reading
+		case driver.Valuer:
+			v, err := x.Value()
+			if err != nil {
+				return nil, err
+			}
+			if _, ok := v.(driver.Valuer); ok {
+				return nil, fmt.Errorf("Value of %T is a driver.Valuer (%T)", a, v)
+			}
+			a = v
+			continue
+		}
+		rv := reflect.ValueOf(a)
+		if !resultCacheKind(rv.Type()) {
+			return nil, fmt.Errorf("bind of type %T cannot be cached", a)
+		}
+		return a, nil
+	}
+}
+
+// resultCacheKind reports whether the values of typ are printed by their contents (not addresses).
+func resultCacheKind(typ reflect.Type) bool {
+	switch typ.Kind() {
+	case reflect.Slice, reflect.Array:
+		return resultCacheKind(typ.Elem())
+	case reflect.Struct:
+		return typ == reflect.TypeOf(time.Time{})
+	case reflect.Ptr, reflect.Interface, reflect.Map, reflect.Chan, reflect.Func, reflect.UnsafePointer:
+		return false
+	}
+	return true
+}
@@ -7,6 +7,7 @@ package godror
 
 /*
 #include "dpiImpl.h"
+#include "errinfo.h"
 
 //int dpiData_getRowidStringValue(dpiData *data, const char **value, uint32_t *valueLength) {
 //	return dpiRowid_getStringValue(data->value.asRowid, value, valueLength);
@@ -25,7 +26,6 @@ import (
 	"io"
 	"math"
 	"reflect"
-	"runtime"
 	"strconv"
 	"strings"
 	"time"
@@ -49,8 +49,14 @@ type rows struct {
 	data           [][]C.dpiData
 	columns        []Column
 	vars           []*C.dpiVar
+	colVarInfos    []varInfo
+	decoders       []columnDecoder
+	compact        []compactColumn // of the CompactFetch columns (nil values for the others)
+	compactBatch   []C.dpiData     // scratch of batchData, shared by the compact columns
+	lobs           []*dpiLobReader // the Lobs returned by Next, holding a reference to their locator
 	bufferRowIndex C.uint32_t
 	fetched        C.uint32_t
+	fetchedRows    uint64 // all the rows fetched, for AdaptiveFetch
 	fromData       bool
 }
 
@@ -71,13 +77,32 @@ func (r *rows) Close() error {
 	if r == nil {
 		return nil
 	}
-	vars, st, nextRs := r.vars, r.statement, r.nextRs
-	r.columns, r.vars, r.data, r.statement, r.nextRs = nil, nil, nil, nil, nil
+	vars, data, varInfos, st, nextRs := r.vars, r.data, r.colVarInfos, r.statement, r.nextRs
+	if st != nil && st.adaptiveFetch != 0 && !r.fromData {
+		adaptiveFetchStats.record(st.query, r.fetchedRows-uint64(r.fetched), rowWidth(r.vars))
+	}
+	r.columns, r.vars, r.data, r.colVarInfos, r.statement, r.nextRs = nil, nil, nil, nil, nil, nil
+	r.compact, r.compactBatch = nil, nil
+	// the Lobs not read till their end are valid only till Close
+	for _, dlr := range r.lobs {
+		dlr.releaseRef()
+	}
+	r.lobs = nil
 	fromData := r.fromData
 	r.fromData = false
-	for _, v := range vars[:cap(vars)] {
-		if v != nil {
-			C.dpiVar_release(v)
+	canReuse := varInfos != nil && st != nil && st.conn != nil && len(data) == len(vars)
+	if canReuse && !fromData && st.ReuseQueryVars() && st.dpiStmt != nil && st.dpiStmt.refCount >= 2 {
+		// the statement stays open, keep the variables defined on it for the next execution
+		st.lastQueryVars.set(queryVars{vars: vars, data: data, infos: varInfos})
+	} else if canReuse && st.VarArena() {
+		for i, v := range vars {
+			st.conn.varArena.put(varInfos[i], v, data[i])
+		}
+	} else {
+		for _, v := range vars[:cap(vars)] {
+			if v != nil {
+				C.dpiVar_release(v)
+			}
 		}
 	}
 	if nextRs != nil {
@@ -300,90 +325,39 @@ func (r *rows) Next(dest []driver.Value) error {
 	ctx := context.Background()
 	logger := getLogger(ctx)
 
-	runtime.LockOSThread()
-	defer runtime.UnlockOSThread()
-
 	if r.fetched == 0 {
-		// Start the watchdog only once See issue #113 (https://github.com/godror/godror/issues/113)
-		if ctx := r.statement.ctx; ctx != nil {
-			// nil can be present when Next is issued on cursor returned from DB
-			if r.err = ctx.Err(); r.err != nil {
-				return r.err
-			}
-			if _, hasDeadline := r.statement.ctx.Deadline(); hasDeadline {
-				// handle deadline for dpiStmt_fetchRows. context reused from stmt
-				cleanup, err := r.statement.handleDeadline(ctx)
-				if err != nil {
-					return err
-				}
-				defer cleanup()
-			}
-		}
-
-		var moreRows C.int
-		var start time.Time
-		maxRows := C.uint32_t(r.statement.FetchArraySize())
-		r.statement.Lock()
-		if debugRowsNext {
-			fmt.Printf("fetching max=%d\n", maxRows)
-			start = time.Now()
-		}
-		err := r.statement.checkExecNoLOT(func() C.int {
-			return C.dpiStmt_fetchRows(r.dpiStmt, maxRows, &r.bufferRowIndex, &r.fetched, &moreRows)
-		})
-		failed := err != nil
-		if debugRowsNext {
-			fmt.Printf("failed=%t bri=%d fetched=%d more=%d data=%d cols=%d dur=%s\n", failed, r.bufferRowIndex, r.fetched, moreRows, len(r.data), len(r.columns), time.Since(start))
-		}
-		r.statement.Unlock()
-		if failed {
-			if logger != nil {
-				logger.Error("fetch", "error", err)
-			}
-			_ = r.Close()
-			if strings.Contains(err.Error(), "DPI-1039: statement was already closed") {
-				r.err = io.EOF
-			} else {
-				r.err = fmt.Errorf("Next: %w", err)
-			}
-			return r.err
-		}
-		if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
-			logger.Debug("fetched", "bri", r.bufferRowIndex, "fetched", r.fetched, "moreRows", moreRows, "len(data)", len(r.data), "cols", len(r.columns))
-		}
-		if r.fetched == 0 {
-			_ = r.Close()
-			r.err = io.EOF
-			return r.err
+		if err := r.fetch(ctx, logger); err != nil {
+			return err
 		}
-		if r.data == nil {
-			r.data = make([][]C.dpiData, len(r.columns))
-			for i := range r.columns {
-				var n C.uint32_t
-				var data *C.dpiData
-				if err = r.statement.checkExecNoLOT(func() C.int {
-					return C.dpiVar_getReturnedData(r.vars[i], 0, &n, &data)
-				}); err != nil {
-					return fmt.Errorf("getReturnedData[%d]: %w", i, err)
-				}
-				r.data[i] = unsafe.Slice(data, n)
-				//fmt.Printf("data %d=%+v\n%+v\n", n, data, r.data[i][0])
-			}
-		}
-
 	}
 	//fmt.Printf("data=%#v\n", r.data)
 
 	nullDate := r.statement.NullDate()
 	nass := r.statement.NumberAsString()
 	naf := !nass && r.statement.NumberAsFloat64()
+	if len(r.decoders) != len(r.columns) {
+		r.decoders = r.columnDecoders()
+	}
 
 	//fmt.Printf("bri=%d fetched=%d\n", r.bufferRowIndex, r.fetched)
 	//fmt.Printf("data=%#v\n", r.data[0][r.bufferRowIndex])
 	//fmt.Printf("VC=%d\n", C.DPI_ORACLE_TYPE_VARCHAR)
-	for i, col := range r.columns {
+	for i, dec := range r.decoders {
+		var d *C.dpiData
+		if r.compact != nil && r.compact[i].values != nil {
+			d = r.compact[i].load(r.bufferRowIndex)
+		} else {
+			d = &r.data[i][r.bufferRowIndex]
+		}
+		if dec != nil {
+			var err error
+			if dest[i], err = dec(d); err != nil {
+				return err
+			}
+			continue
+		}
+		col := r.columns[i]
 		typ := col.OracleType
-		d := &r.data[i][r.bufferRowIndex]
 		isNull := d.isNull == 1
 
 		switch typ {
@@ -481,7 +455,7 @@ func (r *rows) Next(dest []driver.Value) error {
 			cRowid := *((**C.dpiRowid)(unsafe.Pointer(&d.value)))
 			var cBuf *C.char
 			var cLen C.uint32_t
-			if err := r.statement.checkExecNoLOT(func() C.int {
+			if err := r.statement.checkExec(func() C.int {
 				return C.dpiRowid_getStringValue(cRowid, &cBuf, &cLen)
 			}); err != nil {
 				return err
@@ -590,12 +564,12 @@ func (r *rows) Next(dest []driver.Value) error {
 			}
 			rdr := &dpiLobReader{
 				drv: r.drv, dpiLob: C.dpiData_getLOB(d),
-				IsClob: isClob,
+				IsClob: isClob, fetched: true,
 			}
 			if isClob && (r.ClobAsString() || !r.LobAsReader()) {
+				// the locator is not closed, to be reused by the next fetch
 				sb := stringBuilders.Get()
 				_, err := io.Copy(sb, rdr)
-				C.dpiLob_close(rdr.dpiLob)
 				if err != nil {
 					stringBuilders.Put(sb)
 					return err
@@ -604,6 +578,11 @@ func (r *rows) Next(dest []driver.Value) error {
 				stringBuilders.Put(sb)
 				continue
 			}
+			// the reference of the Lob keeps the next fetch from reusing its locator,
+			// and is released by Close, at the end of reading, or by rows.Close.
+			C.dpiLob_addRef(rdr.dpiLob)
+			rdr.hasRef = true
+			r.lobs = append(r.lobs, rdr)
 			dest[i] = &Lob{Reader: rdr, IsClob: rdr.IsClob}
 
 		case C.DPI_ORACLE_TYPE_STMT, C.DPI_NATIVE_TYPE_STMT:
@@ -615,7 +594,7 @@ func (r *rows) Next(dest []driver.Value) error {
 				stmtOptions: r.statement.stmtOptions, // inherit parent statement's options
 			}
 			var colCount C.uint32_t
-			if err := r.statement.checkExecNoLOT(func() C.int {
+			if err := r.statement.checkExec(func() C.int {
 				return C.dpiStmt_getNumQueryColumns(st.dpiStmt, &colCount)
 			}); err != nil {
 				if logger != nil {
@@ -720,6 +699,303 @@ func (r *rows) Next(dest []driver.Value) error {
 	return nil
 }
 
+// columnDecoder converts a fetched value of a column to a driver.Value.
+type columnDecoder func(d *C.dpiData) (driver.Value, error)
+
+// columnDecoders returns a decoder for each column, specialized for its types and
+// the statement's options, so Next does not have to switch on them for every row.
+//
+// The decoder is nil for the less common types (LOBs, objects, cursors, JSON...),
+// which are handled by the generic path of Next.
+func (r *rows) columnDecoders() []columnDecoder {
+	decoders := make([]columnDecoder, len(r.columns))
+	nullDate := r.statement.NullDate()
+	nass := r.statement.NumberAsString()
+	naf := !nass && r.statement.NumberAsFloat64()
+	borrow, intern := r.statement.BorrowBytes(), r.statement.InternStrings()
+	for i, col := range r.columns {
+		if dec := newStringDecoder(col, borrow, intern); dec != nil {
+			decoders[i] = dec
+			continue
+		}
+		decoders[i] = newColumnDecoder(r.conn, col, nullDate, nass, naf)
+	}
+	return decoders
+}
+
+// maxInternLength is the length of the longest interned string.
+const maxInternLength = 256
+
+// newStringDecoder returns the decoder of a character column for the BorrowBytes and InternStrings options,
+// or nil if neither is set (or the column is not of a character type).
+func newStringDecoder(col Column, borrow bool, maxInterned int) columnDecoder {
+	switch col.OracleType {
+	case C.DPI_ORACLE_TYPE_VARCHAR, C.DPI_ORACLE_TYPE_NVARCHAR,
+		C.DPI_ORACLE_TYPE_CHAR, C.DPI_ORACLE_TYPE_NCHAR,
+		C.DPI_ORACLE_TYPE_LONG_VARCHAR, C.DPI_ORACLE_TYPE_LONG_NVARCHAR,
+		C.DPI_ORACLE_TYPE_XMLTYPE:
+	default:
+		return nil
+	}
+	if borrow {
+		return func(d *C.dpiData) (driver.Value, error) {
+			b := dpiDataBytes(d)
+			if d.isNull == 1 || len(b) == 0 {
+				return "", nil
+			}
+			return b, nil
+		}
+	}
+	if maxInterned <= 0 {
+		return nil
+	}
+	// the boxed values are kept, so a hit does not allocate at all
+	interned := make(map[string]driver.Value)
+	return func(d *C.dpiData) (driver.Value, error) {
+		b := dpiDataBytes(d)
+		if d.isNull == 1 || len(b) == 0 {
+			return "", nil
+		}
+		if v, ok := interned[string(b)]; ok {
+			return v, nil
+		}
+		var v driver.Value = string(b)
+		if len(interned) < maxInterned && len(b) <= maxInternLength {
+			interned[v.(string)] = v
+		}
+		return v, nil
+	}
+}
+
+func newColumnDecoder(c *conn, col Column, nullDate interface{}, nass, naf bool) columnDecoder {
+	switch col.OracleType {
+	case C.DPI_ORACLE_TYPE_VARCHAR, C.DPI_ORACLE_TYPE_NVARCHAR,
+		C.DPI_ORACLE_TYPE_CHAR, C.DPI_ORACLE_TYPE_NCHAR,
+		C.DPI_ORACLE_TYPE_LONG_VARCHAR, C.DPI_ORACLE_TYPE_LONG_NVARCHAR,
+		C.DPI_ORACLE_TYPE_XMLTYPE:
+		return func(d *C.dpiData) (driver.Value, error) {
+			if d.isNull == 1 {
+				return "", nil
+			}
+			return string(dpiDataBytes(d)), nil
+		}
+
+	case C.DPI_ORACLE_TYPE_NUMBER:
+		switch col.NativeType {
+		case C.DPI_NATIVE_TYPE_INT64:
+			if naf {
+				return func(d *C.dpiData) (driver.Value, error) {
+					if d.isNull == 1 {
+						return nil, nil
+					}
+					return float64(*((*int64)(unsafe.Pointer(&d.value)))), nil
+				}
+			}
+			return func(d *C.dpiData) (driver.Value, error) {
+				if d.isNull == 1 {
+					return nil, nil
+				}
+				return *((*int64)(unsafe.Pointer(&d.value))), nil
+			}
+		case C.DPI_NATIVE_TYPE_UINT64:
+			if naf {
+				return func(d *C.dpiData) (driver.Value, error) {
+					if d.isNull == 1 {
+						return nil, nil
+					}
+					return float64(*((*uint64)(unsafe.Pointer(&d.value)))), nil
+				}
+			}
+			return func(d *C.dpiData) (driver.Value, error) {
+				if d.isNull == 1 {
+					return nil, nil
+				}
+				return *((*uint64)(unsafe.Pointer(&d.value))), nil
+			}
+		case C.DPI_NATIVE_TYPE_DOUBLE:
+			if naf {
+				return func(d *C.dpiData) (driver.Value, error) {
+					if d.isNull == 1 {
+						return nil, nil
+					}
+					return *((*float64)(unsafe.Pointer(&d.value))), nil
+				}
+			}
+			return func(d *C.dpiData) (driver.Value, error) {
+				if d.isNull == 1 {
+					return nil, nil
+				}
+				return printFloat(*((*float64)(unsafe.Pointer(&d.value)))), nil
+			}
+		case C.DPI_NATIVE_TYPE_BYTES:
+			switch {
+			case nass:
+				return func(d *C.dpiData) (driver.Value, error) {
+					if d.isNull == 1 {
+						return nil, nil
+					}
+					return string(dpiDataBytes(d)), nil
+				}
+			case naf:
+				return func(d *C.dpiData) (driver.Value, error) {
+					if d.isNull == 1 {
+						return nil, nil
+					}
+					bb := dpiDataBytes(d)
+					f, err := strconv.ParseFloat(string(bb), 64)
+					if err != nil {
+						return nil, fmt.Errorf("parse %q as float64: %w", string(bb), err)
+					}
+					return f, nil
+				}
+			}
+			return func(d *C.dpiData) (driver.Value, error) {
+				if d.isNull == 1 {
+					return nil, nil
+				}
+				return Number(dpiDataBytes(d)), nil
+			}
+		}
+
+	case C.DPI_ORACLE_TYPE_RAW, C.DPI_ORACLE_TYPE_LONG_RAW:
+		return func(d *C.dpiData) (driver.Value, error) {
+			if d.isNull == 1 {
+				return nil, nil
+			}
+			b := (*C.dpiBytes)(unsafe.Pointer(&d.value))
+			if b.length == 0 {
+				return []byte{}, nil
+			}
+			return C.GoBytes(unsafe.Pointer(b.ptr), C.int(b.length)), nil
+		}
+
+	case C.DPI_ORACLE_TYPE_NATIVE_DOUBLE:
+		return func(d *C.dpiData) (driver.Value, error) {
+			if d.isNull == 1 {
+				return nil, nil
+			}
+			return *((*float64)(unsafe.Pointer(&d.value))), nil
+		}
+	case C.DPI_ORACLE_TYPE_NATIVE_INT:
+		return func(d *C.dpiData) (driver.Value, error) {
+			if d.isNull == 1 {
+				return nil, nil
+			}
+			return *((*int64)(unsafe.Pointer(&d.value))), nil
+		}
+
+	case C.DPI_ORACLE_TYPE_DATE, C.DPI_ORACLE_TYPE_TIMESTAMP,
+		C.DPI_ORACLE_TYPE_TIMESTAMP_TZ, C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
+		withTZ := col.OracleType == C.DPI_ORACLE_TYPE_TIMESTAMP_TZ || col.OracleType == C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ
+		return func(d *C.dpiData) (driver.Value, error) {
+			if d.isNull == 1 {
+				return nullDate, nil
+			}
+			ts := *((*C.dpiTimestamp)(unsafe.Pointer(&d.value)))
+			tz := c.Timezone()
+			if withTZ {
+				tz = timeZoneFor(ts.tzHourOffset, ts.tzMinuteOffset, nil)
+			}
+			if tz == nil {
+				tz = time.Local
+			}
+			return time.Date(
+				int(ts.year), time.Month(ts.month), int(ts.day),
+				int(ts.hour), int(ts.minute), int(ts.second), int(ts.fsecond),
+				tz,
+			), nil
+		}
+	}
+	return nil
+}
+
+// fetch fetches the next batch of (at most FetchArraySize) rows into the buffers of the query variables.
+//
+// Returns (and sets r.err to) io.EOF when there are no more rows, after closing the rows.
+func (r *rows) fetch(ctx context.Context, logger *slog.Logger) error {
+	// Start the watchdog only once See issue #113 (https://github.com/godror/godror/issues/113)
+	if ctx := r.statement.ctx; ctx != nil {
+		// nil can be present when Next is issued on cursor returned from DB
+		if r.err = ctx.Err(); r.err != nil {
+			return r.err
+		}
+		if _, hasDeadline := r.statement.ctx.Deadline(); hasDeadline {
+			// handle deadline for dpiStmt_fetchRows. context reused from stmt
+			cleanup, err := r.statement.handleDeadline(ctx)
+			if err != nil {
+				return err
+			}
+			defer cleanup()
+		}
+	}
+
+	// forget the Lobs that do not keep their locator from being reused anymore
+	lobs := r.lobs[:0]
+	for _, dlr := range r.lobs {
+		if dlr.holdsRef() {
+			lobs = append(lobs, dlr)
+		}
+	}
+	clear(r.lobs[len(lobs):])
+	r.lobs = lobs
+
+	var moreRows C.int
+	maxRows := C.uint32_t(r.statement.FetchArraySize())
+	r.statement.Lock()
+	if debugRowsNext {
+		fmt.Printf("fetching max=%d\n", maxRows)
+	}
+	start := time.Now()
+	var err error
+	var errInfo C.dpiErrorInfo
+	if C.godrorStmtFetchRows(r.dpiStmt, maxRows, &r.bufferRowIndex, &r.fetched, &moreRows, &errInfo) == C.DPI_FAILURE {
+		err = inlineError(&errInfo)
+		r.fetched = 0
+	}
+	r.statement.conn.countFetch(start, uint32(r.fetched))
+	r.fetchedRows += uint64(r.fetched)
+	failed := err != nil
+	if debugRowsNext {
+		fmt.Printf("failed=%t bri=%d fetched=%d more=%d data=%d cols=%d dur=%s\n", failed, r.bufferRowIndex, r.fetched, moreRows, len(r.data), len(r.columns), time.Since(start))
+	}
+	r.statement.Unlock()
+	if failed {
+		if logger != nil {
+			logger.Error("fetch", "error", err)
+		}
+		_ = r.Close()
+		if strings.Contains(err.Error(), "DPI-1039: statement was already closed") {
+			r.err = io.EOF
+		} else {
+			r.err = fmt.Errorf("Next: %w", err)
+		}
+		return r.err
+	}
+	if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
+		logger.Debug("fetched", "bri", r.bufferRowIndex, "fetched", r.fetched, "moreRows", moreRows, "len(data)", len(r.data), "cols", len(r.columns))
+	}
+	if r.fetched == 0 {
+		_ = r.Close()
+		r.err = io.EOF
+		return r.err
+	}
+	if r.data == nil {
+		r.data = make([][]C.dpiData, len(r.columns))
+		for i := range r.columns {
+			var n C.uint32_t
+			var data *C.dpiData
+			if err = r.statement.checkExec(func() C.int {
+				return C.dpiVar_getReturnedData(r.vars[i], 0, &n, &data)
+			}); err != nil {
+				return fmt.Errorf("getReturnedData[%d]: %w", i, err)
+			}
+			r.data[i] = unsafe.Slice(data, n)
+			//fmt.Printf("data %d=%+v\n%+v\n", n, data, r.data[i][0])
+		}
+	}
+	return nil
+}
+
 var _ = driver.Rows((*directRow)(nil))
 
 type directRow struct {
@@ -0,0 +1,494 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include <stdlib.h>
+#include "dpiImpl.h"
+
+void godror_getStringList(dpiStringList *list, uint32_t *num, const char ***strings, uint32_t **lengths) {
+	*num = list->numStrings;
+	*strings = list->strings;
+	*lengths = list->stringLengths;
+}
+*/
+import "C"
+import (
+	"context"
+	"fmt"
+	"io"
+	"runtime"
+	"sync"
+	"unsafe"
+)
+
+// SodaDatabase is the SODA (Simple Oracle Document Access) database of a connection.
+//
+// The collection metadata is cached per pool with the SodaMetadataCache pool parameter,
+// which spares a round trip for each OpenCollection.
+type SodaDatabase struct {
+	conn        *conn
+	dpiSodaDb   *C.dpiSodaDb
+	mu          sync.Mutex
+	connIsOwned bool
+}
+
+// SodaCollection is a collection of documents of a SodaDatabase.
+type SodaCollection struct {
+	db          *SodaDatabase
+	dpiSodaColl *C.dpiSodaColl
+	name        string
+}
+
+// SodaDocument is a document of a SodaCollection.
+//
+// The documents returned by InsertMany have no Content.
+type SodaDocument struct {
+	Key, Version, MediaType string
+	CreatedOn, LastModified string
+	Content                 []byte
+}
+
+// SodaOperation selects the documents of a Find, FindOne, Count or Remove.
+type SodaOperation struct {
+	// Key or Keys select the documents by key.
+	Key  string
+	Keys []string
+	// Version selects the document by its version (with Key).
+	Version string
+	// Filter is a QBE (query-by-example) JSON filter specification.
+	Filter string
+	// Hint is an SQL optimizer hint, such as "MONITOR".
+	Hint string
+	// Skip and Limit page the documents of Find.
+	Skip, Limit uint32
+	// FetchArraySize is the number of documents fetched with one round trip by Find
+	// (DefaultFetchArraySize if 0).
+	FetchArraySize uint32
+	// Lock locks the documents found (as SELECT FOR UPDATE).
+	Lock bool
+}
+
+// NewSodaDatabase returns the SodaDatabase of the connection of ex.
+//
+// WARNING: the connection given to it must not be closed before the SodaDatabase is closed!
+// So use an sql.Conn for it, if it is used in a transaction.
+func NewSodaDatabase(ctx context.Context, ex Execer) (*SodaDatabase, error) {
+	cx, owned, err := getOwnedConn(ctx, ex)
+	if err != nil {
+		return nil, err
+	}
+	db := SodaDatabase{conn: cx, connIsOwned: owned}
+	if err = cx.checkExec(func() C.int { return C.dpiConn_getSodaDb(cx.dpiConn, &db.dpiSodaDb) }); err != nil {
+		if owned {
+			cx.Close()
+		}
+		return nil, fmt.Errorf("getSodaDb: %w", err)
+	}
+	if guardWithFinalizers.Load() {
+		runtime.SetFinalizer(&db, func(db *SodaDatabase) {
+			if db != nil && db.dpiSodaDb != nil {
+				fmt.Printf("ERROR: SodaDatabase %p of NewSodaDatabase is not Closed!\n", db)
+				db.Close()
+			}
+		})
+	}
+	return &db, nil
+}
+
+// Close the SodaDatabase (and its connection, if it was acquired from a pool).
+func (db *SodaDatabase) Close() error {
+	if db == nil {
+		return nil
+	}
+	db.mu.Lock()
+	defer db.mu.Unlock()
+	c, sdb := db.conn, db.dpiSodaDb
+	db.conn, db.dpiSodaDb = nil, nil
+	if sdb == nil {
+		return nil
+	}
+	err := c.checkExec(func() C.int { return C.dpiSodaDb_release(sdb) })
+	if db.connIsOwned {
+		c.Close()
+	}
+	if err != nil {
+		return fmt.Errorf("release: %w", err)
+	}
+	return nil
+}
+
+// exec calls f on the connection, within the deadline of ctx.
+func (db *SodaDatabase) exec(ctx context.Context, name string, f func() C.int) error {
+	if db == nil || db.dpiSodaDb == nil {
+		return fmt.Errorf("%s: %w", name, ErrNotExist)
+	}
+	cleanup, err := db.conn.handleDeadline(ctx)
+	if err != nil {
+		return err
+	}
+	defer cleanup()
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+	if err = db.conn.checkExec(f); err != nil {
+		return fmt.Errorf("%s: %w", name, err)
+	}
+	return nil
+}
+
+// flags returns the flags of the writing operations: commit unless in a transaction.
+func (db *SodaDatabase) flags() C.uint32_t {
+	if db.conn.inTransaction {
+		return C.DPI_SODA_FLAGS_DEFAULT
+	}
+	return C.DPI_SODA_FLAGS_ATOMIC_COMMIT
+}
+
+// CreateCollection creates the collection, with the (JSON) metadata, if it does not exist yet,
+// and returns it.
+func (db *SodaDatabase) CreateCollection(ctx context.Context, name, metadata string) (*SodaCollection, error) {
+	cName, cMeta := C.CString(name), (*C.char)(nil)
+	defer C.free(unsafe.Pointer(cName))
+	if metadata != "" {
+		cMeta = C.CString(metadata)
+		defer C.free(unsafe.Pointer(cMeta))
+	}
+	coll := SodaCollection{db: db, name: name}
+	if err := db.exec(ctx, "createCollection "+name, func() C.int {
+		return C.dpiSodaDb_createCollection(db.dpiSodaDb, cName, C.uint32_t(len(name)),
+			cMeta, C.uint32_t(len(metadata)), db.flags(), &coll.dpiSodaColl)
+	}); err != nil {
+		return nil, err
+	}
+	return &coll, nil
+}
+
+// OpenCollection returns the existing collection, or ErrNotExist.
+func (db *SodaDatabase) OpenCollection(ctx context.Context, name string) (*SodaCollection, error) {
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	coll := SodaCollection{db: db, name: name}
+	if err := db.exec(ctx, "openCollection "+name, func() C.int {
+		return C.dpiSodaDb_openCollection(db.dpiSodaDb, cName, C.uint32_t(len(name)), db.flags(), &coll.dpiSodaColl)
+	}); err != nil {
+		return nil, err
+	}
+	if coll.dpiSodaColl == nil {
+		return nil, fmt.Errorf("%s: %w", name, ErrNotExist)
+	}
+	return &coll, nil
+}
+
+// CollectionNames returns the names of (at most limit, if not 0) collections,
+// in order, starting with startName.
+func (db *SodaDatabase) CollectionNames(ctx context.Context, startName string, limit int) ([]string, error) {
+	var cStart *C.char
+	if startName != "" {
+		cStart = C.CString(startName)
+		defer C.free(unsafe.Pointer(cStart))
+	}
+	var list C.dpiStringList
+	if err := db.exec(ctx, "getCollectionNames", func() C.int {
+		return C.dpiSodaDb_getCollectionNames(db.dpiSodaDb, cStart, C.uint32_t(len(startName)),
+			C.uint32_t(limit), C.DPI_SODA_FLAGS_DEFAULT, &list)
+	}); err != nil {
+		return nil, err
+	}
+	defer C.dpiSodaDb_freeCollectionNames(db.dpiSodaDb, &list)
+	var num C.uint32_t
+	var strs **C.char
+	var lengths *C.uint32_t
+	C.godror_getStringList(&list, &num, &strs, &lengths)
+	if num == 0 {
+		return nil, nil
+	}
+	names := make([]string, num)
+	for i, s := range unsafe.Slice(strs, num) {
+		names[i] = C.GoStringN(s, C.int(unsafe.Slice(lengths, num)[i]))
+	}
+	return names, nil
+}
+
+// Name of the collection.
+func (coll *SodaCollection) Name() string { return coll.name }
+
+// Close releases the collection.
+func (coll *SodaCollection) Close() error {
+	if coll == nil || coll.dpiSodaColl == nil {
+		return nil
+	}
+	c := coll.dpiSodaColl
+	coll.dpiSodaColl = nil
+	if C.dpiSodaColl_release(c) == C.DPI_FAILURE {
+		return fmt.Errorf("release: %w", coll.db.conn.getError())
+	}
+	return nil
+}
+
+// Metadata returns the JSON metadata of the collection.
+func (coll *SodaCollection) Metadata() (string, error) {
+	var value *C.char
+	var length C.uint32_t
+	if C.dpiSodaColl_getMetadata(coll.dpiSodaColl, &value, &length) == C.DPI_FAILURE {
+		return "", fmt.Errorf("getMetadata: %w", coll.db.conn.getError())
+	}
+	return C.GoStringN(value, C.int(length)), nil
+}
+
+// InsertMany inserts the (JSON) documents with one round trip,
+// and returns their keys and versions, in order.
+//
+// The contents are copied into one buffer, released after the insert.
+func (coll *SodaCollection) InsertMany(ctx context.Context, contents [][]byte) ([]SodaDocument, error) {
+	if len(contents) == 0 {
+		return nil, nil
+	}
+	db := coll.db
+	var size int
+	for _, b := range contents {
+		size += len(b)
+	}
+	buf := (*C.char)(C.malloc(C.size_t(size + 1)))
+	defer C.free(unsafe.Pointer(buf))
+	docs := make([]*C.dpiSodaDoc, len(contents))
+	inserted := make([]*C.dpiSodaDoc, len(contents))
+	defer func() {
+		for _, ds := range [][]*C.dpiSodaDoc{docs, inserted} {
+			for _, d := range ds {
+				if d != nil {
+					C.dpiSodaDoc_release(d)
+				}
+			}
+		}
+	}()
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+	mem, off := unsafe.Slice((*byte)(unsafe.Pointer(buf)), size+1), 0
+	for i, b := range contents {
+		content := (*C.char)(unsafe.Pointer(&mem[off]))
+		off += copy(mem[off:], b)
+		if C.dpiSodaDb_createDocument(db.dpiSodaDb, nil, 0, content, C.uint32_t(len(b)),
+			nil, 0, C.DPI_SODA_FLAGS_DEFAULT, &docs[i]) == C.DPI_FAILURE {
+			return nil, fmt.Errorf("createDocument: %w", db.conn.getError())
+		}
+	}
+	if err := db.exec(ctx, "insertMany", func() C.int {
+		return C.dpiSodaColl_insertMany(coll.dpiSodaColl, C.uint32_t(len(docs)), &docs[0], db.flags(), &inserted[0])
+	}); err != nil {
+		return nil, err
+	}
+	result := make([]SodaDocument, len(inserted))
+	for i, d := range inserted {
+		if err := result[i].fromOra(db, d, false); err != nil {
+			return result, err
+		}
+	}
+	return result, nil
+}
+
+// Find returns a cursor over the documents selected by op,
+// fetching op.FetchArraySize documents with one round trip.
+func (coll *SodaCollection) Find(ctx context.Context, op SodaOperation) (*SodaDocCursor, error) {
+	if op.FetchArraySize == 0 {
+		op.FetchArraySize = DefaultFetchArraySize
+	}
+	opts, free := op.toOra()
+	defer free()
+	cur := SodaDocCursor{coll: coll}
+	if err := coll.db.exec(ctx, "find", func() C.int {
+		return C.dpiSodaColl_find(coll.dpiSodaColl, opts, C.DPI_SODA_FLAGS_DEFAULT, &cur.dpiSodaDocCursor)
+	}); err != nil {
+		return nil, err
+	}
+	return &cur, nil
+}
+
+// FindOne returns the first document selected by op, or ErrNotExist.
+func (coll *SodaCollection) FindOne(ctx context.Context, op SodaOperation) (SodaDocument, error) {
+	var doc SodaDocument
+	opts, free := op.toOra()
+	defer free()
+	var d *C.dpiSodaDoc
+	if err := coll.db.exec(ctx, "findOne", func() C.int {
+		return C.dpiSodaColl_findOne(coll.dpiSodaColl, opts, C.DPI_SODA_FLAGS_DEFAULT, &d)
+	}); err != nil {
+		return doc, err
+	}
+	if d == nil {
+		return doc, ErrNotExist
+	}
+	defer C.dpiSodaDoc_release(d)
+	err := doc.fromOra(coll.db, d, true)
+	return doc, err
+}
+
+// Count returns the number of documents selected by op.
+func (coll *SodaCollection) Count(ctx context.Context, op SodaOperation) (uint64, error) {
+	opts, free := op.toOra()
+	defer free()
+	var n C.uint64_t
+	err := coll.db.exec(ctx, "getDocCount", func() C.int {
+		return C.dpiSodaColl_getDocCount(coll.dpiSodaColl, opts, C.DPI_SODA_FLAGS_DEFAULT, &n)
+	})
+	return uint64(n), err
+}
+
+// Remove removes the documents selected by op, and returns their number.
+func (coll *SodaCollection) Remove(ctx context.Context, op SodaOperation) (uint64, error) {
+	opts, free := op.toOra()
+	defer free()
+	var n C.uint64_t
+	err := coll.db.exec(ctx, "remove", func() C.int {
+		return C.dpiSodaColl_remove(coll.dpiSodaColl, opts, coll.db.flags(), &n)
+	})
+	return uint64(n), err
+}
+
+// Truncate removes all the documents of the collection.
+func (coll *SodaCollection) Truncate(ctx context.Context) error {
+	return coll.db.exec(ctx, "truncate", func() C.int { return C.dpiSodaColl_truncate(coll.dpiSodaColl) })
+}
+
+// Drop drops the collection, and closes it. Returns whether the collection existed.
+func (coll *SodaCollection) Drop(ctx context.Context) (bool, error) {
+	var dropped C.int
+	if err := coll.db.exec(ctx, "drop "+coll.name, func() C.int {
+		return C.dpiSodaColl_drop(coll.dpiSodaColl, coll.db.flags(), &dropped)
+	}); err != nil {
+		return false, err
+	}
+	return dropped != 0, coll.Close()
+}
+
+// SodaDocCursor iterates over the documents found by SodaCollection.Find.
+type SodaDocCursor struct {
+	coll             *SodaCollection
+	dpiSodaDocCursor *C.dpiSodaDocCursor
+}
+
+// Next reads the next document into doc, reusing its Content, or returns io.EOF.
+//
+// Only every FetchArraySize-th call needs a round trip.
+func (cur *SodaDocCursor) Next(ctx context.Context, doc *SodaDocument) error {
+	if cur.dpiSodaDocCursor == nil {
+		return io.EOF
+	}
+	var d *C.dpiSodaDoc
+	if err := cur.coll.db.exec(ctx, "getNext", func() C.int {
+		return C.dpiSodaDocCursor_getNext(cur.dpiSodaDocCursor, C.DPI_SODA_FLAGS_DEFAULT, &d)
+	}); err != nil {
+		return err
+	}
+	if d == nil {
+		return io.EOF
+	}
+	defer C.dpiSodaDoc_release(d)
+	return doc.fromOra(cur.coll.db, d, true)
+}
+
+// Close the cursor.
+func (cur *SodaDocCursor) Close() error {
+	if cur == nil || cur.dpiSodaDocCursor == nil {
+		return nil
+	}
+	c := cur.dpiSodaDocCursor
+	cur.dpiSodaDocCursor = nil
+	if C.dpiSodaDocCursor_release(c) == C.DPI_FAILURE {
+		return fmt.Errorf("release: %w", cur.coll.db.conn.getError())
+	}
+	return nil
+}
+
+// fromOra reads the attributes (and the content, if withContent) of d into doc.
+func (doc *SodaDocument) fromOra(db *SodaDatabase, d *C.dpiSodaDoc, withContent bool) error {
+	var value *C.char
+	var length C.uint32_t
+	for _, a := range []struct {
+		get  func() C.int
+		dest *string
+		name string
+	}{
+		{func() C.int { return C.dpiSodaDoc_getKey(d, &value, &length) }, &doc.Key, "key"},
+		{func() C.int { return C.dpiSodaDoc_getVersion(d, &value, &length) }, &doc.Version, "version"},
+		{func() C.int { return C.dpiSodaDoc_getMediaType(d, &value, &length) }, &doc.MediaType, "mediaType"},
+		{func() C.int { return C.dpiSodaDoc_getCreatedOn(d, &value, &length) }, &doc.CreatedOn, "createdOn"},
+		{func() C.int { return C.dpiSodaDoc_getLastModified(d, &value, &length) }, &doc.LastModified, "lastModified"},
+	} {
+		value, length = nil, 0
+		if a.get() == C.DPI_FAILURE {
+			return fmt.Errorf("%s: %w", a.name, db.conn.getError())
+		}
+		*a.dest = C.GoStringN(value, C.int(length))
+	}
+	doc.Content = doc.Content[:0]
+	if !withContent {
+		return nil
+	}
+	var isJSON C.int
+	if C.dpiSodaDoc_getIsJson(d, &isJSON) == C.DPI_FAILURE {
+		return fmt.Errorf("getIsJson: %w", db.conn.getError())
+	}
+	if isJSON != 0 {
+		var j *C.dpiJson
+		if C.dpiSodaDoc_getJsonContent(d, &j) == C.DPI_FAILURE {
+			return fmt.Errorf("getJsonContent: %w", db.conn.getError())
+		}
+		s := JSON{dpiJson: j}.String()
+		if s == "" {
+			return fmt.Errorf("getJsonContent: %w", ErrInvalidJSON)
+		}
+		doc.Content = append(doc.Content, s...)
+		return nil
+	}
+	var encoding *C.char
+	if C.dpiSodaDoc_getContent(d, &value, &length, &encoding) == C.DPI_FAILURE {
+		return fmt.Errorf("getContent: %w", db.conn.getError())
+	}
+	doc.Content = append(doc.Content, unsafe.Slice((*byte)(unsafe.Pointer(value)), length)...)
+	return nil
+}
+
+// toOra returns the ODPI options of op, allocated in C memory, to be freed with free.
+func (op SodaOperation) toOra() (opts *C.dpiSodaOperOptions, free func()) {
+	opts = (*C.dpiSodaOperOptions)(C.calloc(1, C.sizeof_dpiSodaOperOptions))
+	var strs []*C.char
+	str := func(s string) (*C.char, C.uint32_t) {
+		if s == "" {
+			return nil, 0
+		}
+		cs := C.CString(s)
+		strs = append(strs, cs)
+		return cs, C.uint32_t(len(s))
+	}
+	opts.key, opts.keyLength = str(op.Key)
+	opts.version, opts.versionLength = str(op.Version)
+	opts.filter, opts.filterLength = str(op.Filter)
+	opts.hint, opts.hintLength = str(op.Hint)
+	opts.skip, opts.limit, opts.fetchArraySize = C.uint32_t(op.Skip), C.uint32_t(op.Limit), C.uint32_t(op.FetchArraySize)
+	if op.Lock {
+		opts.lock = 1
+	}
+	if len(op.Keys) != 0 {
+		n := C.size_t(len(op.Keys))
+		opts.numKeys = C.uint32_t(len(op.Keys))
+		opts.keys = (**C.char)(C.malloc(n * C.size_t(unsafe.Sizeof((*C.char)(nil)))))
+		opts.keyLengths = (*C.uint32_t)(C.malloc(n * C.sizeof_uint32_t))
+		keys, lengths := unsafe.Slice(opts.keys, n), unsafe.Slice(opts.keyLengths, n)
+		for i, k := range op.Keys {
+			keys[i], lengths[i] = str(k)
+		}
+	}
+	return opts, func() {
+		for _, s := range strs {
+			C.free(unsafe.Pointer(s))
+		}
+		if opts.keys != nil {
+			C.free(unsafe.Pointer(opts.keys))
+			C.free(unsafe.Pointer(opts.keyLengths))
+		}
+		C.free(unsafe.Pointer(opts))
+	}
+}
@@ -8,6 +8,7 @@ package godror
 /*
 #include <stdlib.h>
 #include "dpiImpl.h"
+#include "errinfo.h"
 
 const int sizeof_dpiData = sizeof(void);
 
@@ -58,6 +59,8 @@ type stmtOptions struct {
 	boolString         boolString
 	fetchArraySize     int // zero means DefaultFetchArraySize
 	prefetchCount      int // zero means DefaultPrefetchCount, -1 is zero.
+	adaptiveFetch      int // memory budget of AdaptiveFetch, zero means off
+	internStrings      int // distinct values per column of InternStrings, zero means off
 	arraySize          int
 	callTimeout        time.Duration
 	execMode           C.dpiExecMode
@@ -70,6 +73,10 @@ type stmtOptions struct {
 	partialBatch       bool
 	warningAsError     bool
 	noRetry            bool
+	varArena           bool
+	reuseQueryVars     bool
+	borrowBytes        bool
+	compactFetch       bool
 }
 
 type boolString struct {
@@ -142,6 +149,11 @@ func (o stmtOptions) DeleteFromCache() bool { return o.deleteFromCache }
 func (o stmtOptions) NumberAsString() bool  { return o.numberAsString }
 func (o stmtOptions) NumberAsFloat64() bool { return o.numberAsFloat64 }
 func (o stmtOptions) PartialBatch() bool    { return o.partialBatch }
+func (o stmtOptions) VarArena() bool        { return o.varArena }
+func (o stmtOptions) ReuseQueryVars() bool  { return o.reuseQueryVars }
+func (o stmtOptions) BorrowBytes() bool     { return o.borrowBytes }
+func (o stmtOptions) InternStrings() int    { return o.internStrings }
+func (o stmtOptions) CompactFetch() bool    { return o.compactFetch }
 
 // Option holds statement options.
 //
@@ -217,6 +229,26 @@ func PrefetchCount(rowCount int) Option {
 	}
 }
 
+// AdaptiveFetch returns an option to choose FetchArraySize and PrefetchCount from the
+// previous executions of the same SQL text: the rows read and the row width
+// are recorded when the rows are closed.
+//
+// A query that read at most one row gets a prefetch of 2 rows, so the row and the end of the
+// results arrive with the execute, without an extra round trip;
+// larger results get arrays of the rows read (plus one), limited by memoryBudget bytes
+// of fetch buffers (DefaultAdaptiveFetchMemory if memoryBudget <= 0),
+// counting the per-cell indicators, lengths and conversion buffers, too.
+//
+// Explicit FetchArraySize or PrefetchCount options take precedence.
+//
+// Use it "naked", without sql.Named!
+func AdaptiveFetch(memoryBudget int) Option {
+	if memoryBudget <= 0 {
+		memoryBudget = DefaultAdaptiveFetchMemory
+	}
+	return func(o *stmtOptions) { o.adaptiveFetch = memoryBudget }
+}
+
 // ArraySize returns an option to set the array size to be used, overriding DefaultArraySize.
 //
 // Use it "naked", without sql.Named!
@@ -267,6 +299,9 @@ func ClobAsString() Option { return func(o *stmtOptions) { o.lobAsReader = false
 //
 // EXCEPT for Object attributes, those are returned as-is - as lobReader.
 //
+// The fetched Lobs can be read till the rows are closed; the locator of a Lob read till its end
+// (or closed) is reused by the next fetch.
+//
 // Use it "naked", without sql.Named!
 func LobAsReader() Option { return func(o *stmtOptions) { o.lobAsReader = true } }
 
@@ -302,6 +337,51 @@ func WarningAsError() Option { return func(o *stmtOptions) { o.warningAsError =
 // Do not re-execute statement if ORA-04061, ORA-04065 or ORA-04068 occurs
 func NoRetry() Option { return func(o *stmtOptions) { o.noRetry = true } }
 
+// VarArena is an option to recycle the query's fetch variables through a per-connection arena:
+// when the rows are closed, their variables are kept for the next query on the same connection
+// with the same column types, instead of being freed and reallocated on each execution.
+//
+// Only variables of plain (numeric, character, date and interval) columns are recycled.
+func VarArena() Option { return func(o *stmtOptions) { o.varArena = true } }
+
+// ReuseQueryVars is an option to keep the query's fetch variables on the (prepared) statement
+// when the rows are closed, and reuse them on its next execution if the described columns
+// (type, size, count) are the same, skipping the defines and buffer allocations entirely.
+//
+// It pays off with statements executed many times, such as sql.Stmt or cached statements.
+func ReuseQueryVars() Option { return func(o *stmtOptions) { o.reuseQueryVars = true } }
+
+// InternStrings is an option to return the repeated values of character columns as shared strings,
+// instead of a new copy for each row: a table of at most maxValues
+// (DefaultInternStrings if maxValues <= 0) distinct values is kept per column for the result set.
+//
+// It pays off with low-cardinality columns (such as status or currency codes);
+// the values not fitting into the table are copied as usual.
+func InternStrings(maxValues int) Option {
+	if maxValues <= 0 {
+		maxValues = DefaultInternStrings
+	}
+	return func(o *stmtOptions) { o.internStrings = maxValues }
+}
+
+// BorrowBytes is an option to return character columns as []byte pointing into the fetch buffer, without copying.
+//
+// Scanned into *sql.RawBytes, such a value is valid only till the next Next (or Close) of the Rows!
+// database/sql copies it for the other destinations (*string, *[]byte, *interface{}),
+// but a sql.Scanner gets the borrowed bytes, too.
+// InternStrings is ignored with BorrowBytes.
+func BorrowBytes() Option { return func(o *stmtOptions) { o.borrowBytes = true } }
+
+// CompactFetch is an option to fetch the character (VARCHAR2, CHAR, NVARCHAR2, NCHAR), RAW
+// and BINARY_DOUBLE/BINARY_FLOAT columns into compact buffers: Next reads the values,
+// indicators and lengths straight from the arrays filled by OCI,
+// without a dpiData structure per cell (48 bytes each).
+// QueryColumns, QueryArrow and ParallelQuery read them one batch at a time.
+//
+// It pays off with large FetchArraySize on wide tables.
+// Needs Oracle Client 12.1 or later, the other columns are fetched as usual.
+func CompactFetch() Option { return func(o *stmtOptions) { o.compactFetch = true } }
+
 const minChunkSize = 1 << 16
 
 var _ driver.Stmt = (*statement)(nil)
@@ -322,8 +402,11 @@ type statement struct {
 	vars     []*C.dpiVar
 	varInfos []varInfo
 	stmtOptions
-	arrLen      int
-	dpiStmtInfo C.dpiStmtInfo
+	arrLen        int
+	dpiStmtInfo   C.dpiStmtInfo
+	lastQueryVars queryVarCache
+	bindPlan      bindPlan
+	fetchPlan     fetchPlan
 	sync.Mutex
 }
 type dataGetter func(ctx context.Context, v interface{}, data []C.dpiData) error
@@ -354,6 +437,7 @@ func (st *statement) closeNotLocking(ctx context.Context) error {
 	st.varInfos = nil
 	st.gets = nil
 	st.dests = nil
+	st.bindPlan = bindPlan{}
 	st.columns = nil
 	st.dpiStmt = nil
 	st.conn = nil
@@ -368,6 +452,7 @@ func (st *statement) closeNotLocking(ctx context.Context) error {
 			logger.Debug("closeNotLocking", "stack", string(stack))
 		}
 	}
+	st.lastQueryVars.set(queryVars{})
 	for _, v := range vars[:cap(vars)] {
 		if v != nil {
 			C.dpiVar_release(v)
@@ -479,16 +564,11 @@ func (st *statement) ExecContext(ctx context.Context, args []driver.NamedValue)
 		C.dpiStmt_deleteFromCache(st.dpiStmt)
 	}
 	// execute
-	var f func() C.int
 	many := !st.PlSQLArrays() && st.arrLen > 0
-	if many {
-		if st.PartialBatch() {
-			mode |= C.DPI_MODE_EXEC_BATCH_ERRORS
-		}
-		f = func() C.int { return C.dpiStmt_executeMany(st.dpiStmt, mode, C.uint32_t(st.arrLen)) }
-	} else {
-		f = func() C.int { return C.dpiStmt_execute(st.dpiStmt, mode, nil) }
+	if many && st.PartialBatch() {
+		mode |= C.DPI_MODE_EXEC_BATCH_ERRORS
 	}
+	start := time.Now()
 	for i := 0; i < 3; i++ {
 		if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
 			logger.Debug("dpiStmt_execute", "st", fmt.Sprintf("%p", st.dpiStmt), "many", many, "mode", mode, "len", st.arrLen)
@@ -514,10 +594,14 @@ func (st *statement) ExecContext(ctx context.Context, args []driver.NamedValue)
 		if err = func() error {
 			defer close(done)
 			if st.warningAsError {
-				return st.checkExecWithWarning(f)
-			} else {
-				return st.checkExec(f)
+				return st.checkExecWithWarning(func() C.int {
+					if many {
+						return C.dpiStmt_executeMany(st.dpiStmt, mode, C.uint32_t(st.arrLen))
+					}
+					return C.dpiStmt_execute(st.dpiStmt, mode, nil)
+				})
 			}
+			return st.executeInline(mode, many, nil)
 		}(); err == nil {
 			break
 		}
@@ -528,6 +612,7 @@ func (st *statement) ExecContext(ctx context.Context, args []driver.NamedValue)
 			break
 		}
 	}
+	st.conn.countExecute(start)
 	if err != nil && (!many || !st.PartialBatch() || closeIfBadConn(err) == driver.ErrBadConn) {
 		return nil, err
 	}
@@ -706,12 +791,13 @@ func (st *statement) queryContextNotLocked(ctx context.Context, args []driver.Na
 		mode |= C.DPI_MODE_EXEC_COMMIT_ON_SUCCESS
 	}
 	// set Prefetch Parameters before execute
+	st.fetchPlan = st.planFetch()
 	C.dpiStmt_setFetchArraySize(st.dpiStmt, C.uint32_t(st.FetchArraySize()))
 	C.dpiStmt_setPrefetchRows(st.dpiStmt, C.uint32_t(st.PrefetchCount()))
 
 	// execute
 	var colCount C.uint32_t
-	f := func() C.int { return C.dpiStmt_execute(st.dpiStmt, mode, &colCount) }
+	start := time.Now()
 	for i := 0; i < 3; i++ {
 		done := make(chan struct{})
 		if !st.conn.params.NoBreakOnContextCancel {
@@ -734,10 +820,9 @@ func (st *statement) queryContextNotLocked(ctx context.Context, args []driver.Na
 		if err = func() error {
 			defer close(done)
 			if st.warningAsError {
-				return st.checkExecWithWarning(f)
-			} else {
-				return st.checkExec(f)
+				return st.checkExecWithWarning(func() C.int { return C.dpiStmt_execute(st.dpiStmt, mode, &colCount) })
 			}
+			return st.executeInline(mode, false, &colCount)
 		}(); err == nil {
 			break
 		}
@@ -748,6 +833,7 @@ func (st *statement) queryContextNotLocked(ctx context.Context, args []driver.Na
 			break
 		}
 	}
+	st.conn.countExecute(start)
 	if err != nil {
 		return nil, closeIfBadConn(fmt.Errorf("dpiStmt_execute: %w", err))
 	}
@@ -853,6 +939,10 @@ func (st *statement) bindVars(ctx context.Context, args []driver.NamedValue, log
 	if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
 		logger.Debug("enter bindVars", "st", fmt.Sprintf("%p", st), "args", fmt.Sprintf("%#v", args))
 	}
+	if ok, err := st.bindPlanned(ctx, args); ok || err != nil {
+		return err
+	}
+	st.bindPlan.types = nil
 	var named bool
 	if cap(st.vars) < len(args) {
 		st.vars = make([]*C.dpiVar, len(args))
@@ -926,7 +1016,18 @@ func (st *statement) bindVars(ctx context.Context, args []driver.NamedValue, log
 			// deref in rArgs, but NOT value!
 			rArgs[i] = rv.Elem()
 		}
-		if _, isByteSlice := value.([]byte); !isByteSlice {
+		if m, isMatrix := value.(VectorMatrix); isMatrix {
+			// each row is one vector, for executeMany
+			if st.isSlice[i] = !st.PlSQLArrays(); st.isSlice[i] {
+				n := m.Rows()
+				if minArrLen == -1 || n < minArrLen {
+					minArrLen = n
+				}
+				if maxArrLen == -1 || n > maxArrLen {
+					maxArrLen = n
+				}
+			}
+		} else if _, isByteSlice := value.([]byte); !isByteSlice {
 			st.isSlice[i] = rArgs[i].Kind() == reflect.Slice
 			if !st.PlSQLArrays() && st.isSlice[i] {
 				n := rArgs[i].Len()
@@ -1059,6 +1160,7 @@ func (st *statement) bindVars(ctx context.Context, args []driver.NamedValue, log
 				return fmt.Errorf("bindByPos[%d]: %w", i, err)
 			}
 		}
+		st.bindPlan.record(args, infos, named)
 		return nil
 	}
 	for i, a := range args {
@@ -1074,6 +1176,7 @@ func (st *statement) bindVars(ctx context.Context, args []driver.NamedValue, log
 			return fmt.Errorf("bindByName[%q]: %w", name, err)
 		}
 	}
+	st.bindPlan.record(args, infos, named)
 	return nil
 }
 
@@ -1119,6 +1222,14 @@ func (st *statement) bindVarTypeSwitch(ctx context.Context, info *argInfo, get *
 		info.set = st.dataSetLOB
 		if info.isOut {
 			*get = st.dataGetLOB
+		} else if st.bindsLobsAsLong() && lobsInMemory(v) {
+			// bind as LONG (RAW): the values are copied into the variable,
+			// without a temporary LOB (and a round trip) for each of them
+			info.typ, info.natTyp = C.DPI_ORACLE_TYPE_LONG_RAW, C.DPI_NATIVE_TYPE_BYTES
+			if isClob {
+				info.typ = C.DPI_ORACLE_TYPE_LONG_VARCHAR
+			}
+			info.set = st.dataSetLOBBytes
 		}
 	case *driver.Rows:
 		info.typ, info.natTyp = C.DPI_ORACLE_TYPE_STMT, C.DPI_NATIVE_TYPE_STMT
@@ -1378,6 +1489,12 @@ func (st *statement) bindVarTypeSwitch(ctx context.Context, info *argInfo, get *
 		if info.isOut {
 			*get = st.conn.dataGetVectorValue
 		}
+	case VectorMatrix:
+		if info.isOut {
+			return value, errors.New("VectorMatrix cannot be used as an out bind")
+		}
+		info.typ, info.natTyp = C.DPI_ORACLE_TYPE_VECTOR, C.DPI_NATIVE_TYPE_VECTOR
+		info.set = st.conn.dataSetVectorMatrix
 
 	default:
 		if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
@@ -2435,8 +2552,9 @@ func dataSetBytes(ctx context.Context, dv *C.dpiVar, data []C.dpiData, vv interf
 		}
 		data[i].isNull = 0
 		p = (*C.char)(unsafe.Pointer(&x[0]))
-		//if logger != nil {Log("C", "dpiVar_setFromBytes", "dv", dv, "pos", pos, "p", p, "len", len(x)) }
-		C.dpiVar_setFromBytes(dv, C.uint32_t(i), p, C.uint32_t(len(x)))
+		if err := setFromBytes(dv, i, p, len(x)); err != nil {
+			return fmt.Errorf("dpiVar_setFromBytes(%d): %w", len(x), err)
+		}
 	case [][]byte:
 		for i, x := range slice {
 			if len(x) == 0 {
@@ -2445,8 +2563,9 @@ func dataSetBytes(ctx context.Context, dv *C.dpiVar, data []C.dpiData, vv interf
 			}
 			data[i].isNull = 0
 			p = (*C.char)(unsafe.Pointer(&x[0]))
-			//if logger != nil {Log("C", "dpiVar_setFromBytes", "dv", dv, "pos", pos, "p", p, "len", len(x)) }
-			C.dpiVar_setFromBytes(dv, C.uint32_t(i), p, C.uint32_t(len(x)))
+			if err := setFromBytes(dv, i, p, len(x)); err != nil {
+				return fmt.Errorf("%d. dpiVar_setFromBytes(%d): %w", i, len(x), err)
+			}
 		}
 
 	case Number:
@@ -2571,13 +2690,17 @@ func (st *statement) dataSetBoolBytes(ctx context.Context, dv *C.dpiVar, data []
 		data[i].isNull = 0
 		s := []byte(st.stmtOptions.boolString.ToString(x))
 		p = (*C.char)(unsafe.Pointer(&s[0]))
-		C.dpiVar_setFromBytes(dv, C.uint32_t(i), p, C.uint32_t(len(s)))
+		if err := setFromBytes(dv, i, p, len(s)); err != nil {
+			return fmt.Errorf("dpiVar_setFromBytes(%d): %w", len(s), err)
+		}
 	case []bool:
 		for i, x := range slice {
 			data[i].isNull = 0
 			s := []byte(st.stmtOptions.boolString.ToString(x))
 			p = (*C.char)(unsafe.Pointer(&s[0]))
-			C.dpiVar_setFromBytes(dv, C.uint32_t(i), p, C.uint32_t(len(s)))
+			if err := setFromBytes(dv, i, p, len(s)); err != nil {
+				return fmt.Errorf("%d. dpiVar_setFromBytes(%d): %w", i, len(s), err)
+			}
 		}
 
 	default:
@@ -2699,6 +2822,87 @@ func (c *conn) dataSetLOB(ctx context.Context, dv *C.dpiVar, data []C.dpiData, v
 	}
 	return firstErr
 }
+
+// bindsLobsAsLong reports whether in-memory Lobs can be bound as LONG (RAW):
+// only for the values of INSERT and UPDATE statements executed with executeMany,
+// as LONG binds are not allowed in queries, conditions and function arguments.
+func (st *statement) bindsLobsAsLong() bool {
+	if st.PlSQLArrays() || st.arrLen <= 1 {
+		return false
+	}
+	switch st.dpiStmtInfo.statementType {
+	case C.DPI_STMT_TYPE_INSERT, C.DPI_STMT_TYPE_UPDATE:
+		return true
+	}
+	return false
+}
+
+// maxLongBindSize is the maximum size of a Lob bound as LONG (RAW) by dataSetLOBBytes.
+const maxLongBindSize = 1 << 30
+
+// lobsInMemory reports whether the Readers of all the Lobs (Lob or []Lob) are in memory
+// (such as *bytes.Reader or *strings.Reader, reporting their Len),
+// and not longer than maxLongBindSize.
+//
+// An empty (but not nil) Reader is an empty LOB, not the NULL a LONG would be, so it needs a LOB.
+func lobsInMemory(v interface{}) bool {
+	inMemory := func(L Lob) bool {
+		if L.Reader == nil {
+			return true
+		}
+		lr, ok := L.Reader.(interface{ Len() int })
+		return ok && lr.Len() != 0 && lr.Len() <= maxLongBindSize
+	}
+	switch v := v.(type) {
+	case Lob:
+		return inMemory(v)
+	case []Lob:
+		for _, L := range v {
+			if !inMemory(L) {
+				return false
+			}
+		}
+		return len(v) != 0
+	}
+	return false
+}
+
+// dataSetLOBBytes sets the in-memory Lobs (see lobsInMemory) into the LONG (RAW) variable.
+func (c *conn) dataSetLOBBytes(ctx context.Context, dv *C.dpiVar, data []C.dpiData, vv interface{}) error {
+	if len(data) == 0 {
+		return nil
+	}
+	if vv == nil {
+		return dataSetNull(ctx, dv, data, nil)
+	}
+	lobs := []Lob{{}}
+	if L, ok := vv.(Lob); ok {
+		lobs[0] = L
+	} else {
+		lobs = vv.([]Lob)
+	}
+
+	var buf []byte
+	for i, L := range lobs {
+		if L.Reader == nil {
+			data[i].isNull = 1
+			continue
+		}
+		n := L.Reader.(interface{ Len() int }).Len()
+		if cap(buf) < n {
+			buf = make([]byte, n)
+		}
+		if _, err := io.ReadFull(L.Reader, buf[:n]); err != nil {
+			return fmt.Errorf("%d. read: %w", i, err)
+		}
+		data[i].isNull = 0
+		if err := setFromBytes(dv, i, (*C.char)(unsafe.Pointer(&buf[0])), n); err != nil {
+			return fmt.Errorf("%d. dpiVar_setFromBytes(%d): %w", i, n, err)
+		}
+	}
+	return nil
+}
+
 func (c *conn) dataSetLOBOne(ctx context.Context, dv *C.dpiVar, data []C.dpiData, i int, L Lob) error {
 	if L.Reader == nil {
 		data[i].isNull = 1
@@ -2721,9 +2925,7 @@ func (c *conn) dataSetLOBOne(ctx context.Context, dv *C.dpiVar, data []C.dpiData
 		logger.Debug("ReadAtLeast", "wanted", cap(a)>>1, "n", n, "isClob", L.IsClob)
 	}
 	if n < cap(a)>>1 {
-		if err := c.checkExec(func() C.int {
-			return C.dpiVar_setFromBytes(dv, C.uint32_t(i), (*C.char)(unsafe.Pointer(&a[0])), C.uint32_t(n))
-		}); err != nil {
+		if err := setFromBytes(dv, i, (*C.char)(unsafe.Pointer(&a[0])), n); err != nil {
 			return fmt.Errorf("dpiVar_setFromBytes(%d): %w", n, err)
 		}
 		return nil
@@ -3104,31 +3306,21 @@ func (c *conn) dataGetObjectStructObj(ctx context.Context, rv reflect.Value, obj
 		}
 		orig := rv
 		rv.SetLen(0)
-		first := true
 		re := reflect.New(rvt.Elem()).Elem()
 		ret := re.Type()
-		for i, err := coll.First(); err == nil; i, err = coll.Next(i) {
-			if err != nil {
-				if errors.Is(err, io.EOF) {
-					break
-				}
-				return err
-			}
-			if first {
-				first = false
-				length, err := coll.Len()
-				if err != nil {
-					return err
-				}
-				if true || rv.Cap() < length { // Forcing new slice helps #323
-					rv = reflect.MakeSlice(rvt, 0, length)
-				}
-			}
-			var d Data
-			if err := coll.GetItem(&d, i); err != nil {
-				return err
-			}
-			x := d.Get()
+		items, err := coll.GetItems(nil)
+		if err != nil {
+			return err
+		}
+		if len(items) != 0 { // Forcing new slice helps #323
+			rv = reflect.MakeSlice(rvt, 0, len(items))
+		}
+		// the items not converted (after an error) still hold their objects
+		var done int
+		defer func() { releaseObjects(items[done:]) }()
+		for i := range items {
+			done = i + 1
+			x := items[i].Get()
 			if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
 				logger.Debug("coll.GetItem", "i", i, "x", x, "x.type", fmt.Sprintf("%T", x))
 			}
@@ -3159,144 +3351,145 @@ func (c *conn) dataGetObjectStructObj(ctx context.Context, rv reflect.Value, obj
 		return nil
 	}
 
-Loop:
-	for i, n := 0, rvt.NumField(); i < n; i++ {
-		f := rvt.Field(i)
-		if !f.IsExported() || fieldIsObjectTypeName(f) {
-			continue
-		}
-		rf := rv.FieldByIndex(f.Index)
-		if obj.CollectionOf != nil {
-			// we must find the slice in the struct
-			if f.Type.Kind() != reflect.Slice {
+	if obj.CollectionOf != nil {
+		// we must find the slice in the struct
+		for i, n := 0, rvt.NumField(); i < n; i++ {
+			f := rvt.Field(i)
+			if !f.IsExported() || fieldIsObjectTypeName(f) || f.Type.Kind() != reflect.Slice {
 				continue
 			}
 			if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
 				logger.Debug("dataGetObjectStructObj", "field", f)
 			}
-			return c.dataGetObjectStructObj(ctx, rf, obj)
-		}
-		nm, typ, _ := parseStructTag(f.Tag)
-		if nm == "-" {
-			continue
-		}
-		fieldTag := typ
-		if fieldTag == "" {
-			fieldTag = nm
+			return c.dataGetObjectStructObj(ctx, rv.FieldByIndex(f.Index), obj)
 		}
+		return nil
+	}
+
+	sm, err := obj.ObjectType.structMapping(rvt)
+	if err != nil {
+		return err
+	}
+	values, err := sm.set.get(obj, nil)
+	if err != nil {
+		return err
+	}
+	var done int
+	defer func() { releaseObjects(values[done:]) }()
+	for i, f := range sm.fields {
+		done = i + 1
 		if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
-			logger.Debug("dataGetObjectStruct", "fieldTag", fieldTag, "nm", nm, "tag", f.Tag, "name", f.Name)
+			logger.Debug("dataGetObjectStruct", "fieldTag", f.fieldTag, "nm", f.name, "tag", f.Tag, "name", f.Name)
+		}
+		if err := c.setStructField(ctx, rv.FieldByIndex(f.Index), f, obj, &values[i]); err != nil {
+			return err
 		}
+	}
+	return nil
+}
 
-		if nm == "" {
-			nm = strings.ToUpper(f.Name)
+// setStructField sets the struct field rf from the attribute ad of obj.
+func (c *conn) setStructField(ctx context.Context, rf reflect.Value, f structField, obj *Object, ad *Data) error {
+	logger := getLogger(ctx)
+	nm, fieldTag := f.name, f.fieldTag
+	if ad.IsNull() {
+		rf.SetZero()
+		return nil
+	}
+	x := ad.Get()
+	if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
+		logger.Debug("dataGetObjectStructObj.GetAttribute", "name", nm, "x", x, "x.type", fmt.Sprintf("%T", x))
+	}
+	switch v := x.(type) {
+	case time.Time:
+		rf.Set(reflect.ValueOf(v))
+	case *Object:
+		err := c.dataGetObjectStructObj(ctx, rf, v)
+		v.Close()
+		return err
+	case string:
+		if rf.Kind() == reflect.String {
+			rf.SetString(v)
+		} else {
+			rf.SetBytes([]byte(v))
+		}
+	case []byte:
+		if rf.Kind() == reflect.String {
+			rf.SetString(string(v))
+		} else {
+			rf.SetBytes(v)
+		}
+	case *Lob:
+		var buf bytes.Buffer
+		if v != nil && v.Reader != nil {
+			if _, err := buf.ReadFrom(v.Reader); err != nil {
+				return fmt.Errorf("GetLobAttribute(%q): %w", nm, err)
+			}
 		}
-		var ad Data
-		if err := obj.GetAttribute(&ad, nm); err != nil {
-			return fmt.Errorf("GetAttribute(%q): %w", nm, err)
+		if c, ok := x.(io.Closer); ok {
+			c.Close()
+		} else if c, ok := v.Reader.(io.Closer); ok {
+			c.Close()
 		}
-		if ad.IsNull() {
-			rf.SetZero()
-			continue
+		if rf.Kind() == reflect.String {
+			rf.SetString(buf.String())
+		} else {
+			rf.SetBytes(buf.Bytes())
 		}
-		x := ad.Get()
+	default:
 		if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
-			logger.Debug("dataGetObjectStructObj.GetAttribute", "name", nm, "x", x, "x.type", fmt.Sprintf("%T", x))
-		}
-		switch v := x.(type) {
-		case time.Time:
-			rf.Set(reflect.ValueOf(v))
-		case *Object:
-			err := c.dataGetObjectStructObj(ctx, rf, v)
-			v.Close()
-			if err != nil {
-				return err
-			}
-			continue Loop
-		case string:
-			if rf.Kind() == reflect.String {
-				rf.SetString(v)
-			} else {
-				rf.SetBytes([]byte(v))
+			logger.Debug("set", "src", fmt.Sprintf("%#v", v), "dst", rf)
+		}
+		switch vv := reflect.ValueOf(v); vv.Kind() {
+		case reflect.Uint, reflect.Uint16, reflect.Uint32, reflect.Uint64:
+			switch null := rf.Addr().Interface().(type) {
+			case *sql.NullInt32:
+				*null = sql.NullInt32{Valid: true, Int32: int32(ad.GetUint64())}
+			case *sql.NullInt64:
+				*null = sql.NullInt64{Valid: true, Int64: int64(ad.GetUint64())}
+			}
+			rf.SetUint(ad.GetUint64())
+		case reflect.Int, reflect.Int16, reflect.Int32, reflect.Int64:
+			switch null := rf.Addr().Interface().(type) {
+			case *sql.NullInt32:
+				*null = sql.NullInt32{Valid: true, Int32: int32(ad.GetInt64())}
+			case *sql.NullInt64:
+				*null = sql.NullInt64{Valid: true, Int64: ad.GetInt64()}
+			default:
+				rf.SetInt(ad.GetInt64())
 			}
-		case []byte:
-			if rf.Kind() == reflect.String {
-				rf.SetString(string(v))
+		case reflect.Float32:
+			if null, ok := rf.Addr().Interface().(*sql.NullFloat64); ok {
+				*null = sql.NullFloat64{Valid: true, Float64: float64(ad.GetFloat32())}
 			} else {
-				rf.SetBytes(v)
-			}
-		case *Lob:
-			var buf bytes.Buffer
-			if v != nil && v.Reader != nil {
-				if _, err := buf.ReadFrom(v.Reader); err != nil {
-					return fmt.Errorf("GetLobAttribute(%q): %w", nm, err)
-				}
-			}
-			if c, ok := x.(io.Closer); ok {
-				c.Close()
-			} else if c, ok := v.Reader.(io.Closer); ok {
-				c.Close()
+				rf.SetFloat(float64(ad.GetFloat32()))
 			}
-			if rf.Kind() == reflect.String {
-				rf.SetString(buf.String())
+		case reflect.Float64:
+			if null, ok := rf.Addr().Interface().(*sql.NullFloat64); ok {
+				*null = sql.NullFloat64{Valid: true, Float64: ad.GetFloat64()}
 			} else {
-				rf.SetBytes(buf.Bytes())
+				rf.SetFloat(ad.GetFloat64())
 			}
 		default:
-			if logger != nil && logger.Enabled(ctx, slog.LevelDebug) {
-				logger.Debug("set", "src", fmt.Sprintf("%#v", v), "dst", rf)
-			}
-			switch vv := reflect.ValueOf(v); vv.Kind() {
-			case reflect.Uint, reflect.Uint16, reflect.Uint32, reflect.Uint64:
-				switch null := rf.Addr().Interface().(type) {
-				case *sql.NullInt32:
-					*null = sql.NullInt32{Valid: true, Int32: int32(ad.GetUint64())}
-				case *sql.NullInt64:
-					*null = sql.NullInt64{Valid: true, Int64: int64(ad.GetUint64())}
-				}
-				rf.SetUint(ad.GetUint64())
-			case reflect.Int, reflect.Int16, reflect.Int32, reflect.Int64:
-				switch null := rf.Addr().Interface().(type) {
-				case *sql.NullInt32:
-					*null = sql.NullInt32{Valid: true, Int32: int32(ad.GetInt64())}
-				case *sql.NullInt64:
-					*null = sql.NullInt64{Valid: true, Int64: ad.GetInt64()}
-				default:
-					rf.SetInt(ad.GetInt64())
+			// TODO: slice/Collection of sth
+			if kind := vv.Kind(); kind == reflect.Struct || (kind == reflect.Ptr && vv.Elem().Kind() == reflect.Struct) {
+				if err := c.dataGetObjectStruct(ctx, obj.ObjectType.Attributes[nm].ObjectType, v, []C.dpiData{ad.dpiData}); err != nil {
+					return err
 				}
-			case reflect.Float32:
-				if null, ok := rf.Addr().Interface().(*sql.NullFloat64); ok {
-					*null = sql.NullFloat64{Valid: true, Float64: float64(ad.GetFloat32())}
-				} else {
-					rf.SetFloat(float64(ad.GetFloat32()))
+			} else if kind == reflect.Slice &&
+				(vv.Elem().Kind() == reflect.Struct || (vv.Elem().Kind() == reflect.Ptr && vv.Elem().Elem().Kind() == reflect.Struct)) {
+				ot, err := c.getStructObjectType(ctx, v, fieldTag)
+				if err != nil {
+					return err
 				}
-			case reflect.Float64:
-				if null, ok := rf.Addr().Interface().(*sql.NullFloat64); ok {
-					*null = sql.NullFloat64{Valid: true, Float64: ad.GetFloat64()}
-				} else {
-					rf.SetFloat(ad.GetFloat64())
+				if err := c.dataGetObjectStruct(ctx, ot, v, []C.dpiData{ad.dpiData}); err != nil {
+					return err
 				}
-			default:
-				// TODO: slice/Collection of sth
-				if kind := vv.Kind(); kind == reflect.Struct || (kind == reflect.Ptr && vv.Elem().Kind() == reflect.Struct) {
-					if err := c.dataGetObjectStruct(ctx, obj.ObjectType.Attributes[nm].ObjectType, v, []C.dpiData{ad.dpiData}); err != nil {
-						return err
-					}
-				} else if kind == reflect.Slice &&
-					(vv.Elem().Kind() == reflect.Struct || (vv.Elem().Kind() == reflect.Ptr && vv.Elem().Elem().Kind() == reflect.Struct)) {
-					ot, err := c.getStructObjectType(ctx, v, fieldTag)
-					if err != nil {
-						return err
-					}
-					if err := c.dataGetObjectStruct(ctx, ot, v, []C.dpiData{ad.dpiData}); err != nil {
-						return err
-					}
-				} else {
-					if f.Type != vv.Type() {
-						vv = vv.Convert(f.Type)
-					}
-					rf.Set(vv)
+			} else {
+				if f.Type != vv.Type() {
+					vv = vv.Convert(f.Type)
 				}
+				rf.Set(vv)
 			}
 		}
 	}
@@ -3631,6 +3824,24 @@ func (c *conn) setPointerVectorSlice(vs []*Vector, data []C.dpiData) error {
 	return nil
 }
 
+// dataSetVectorMatrix sets all the rows of data from the VectorMatrix, with one call.
+func (c *conn) dataSetVectorMatrix(ctx context.Context, dv *C.dpiVar, data []C.dpiData, vv interface{}) error {
+	m := vv.(VectorMatrix)
+	format, ptr, rows, err := m.data()
+	if err != nil {
+		return err
+	}
+	if rows != len(data) {
+		return fmt.Errorf("VectorMatrix of %d rows cannot be bound to %d rows", rows, len(data))
+	}
+	if rows == 0 {
+		return nil
+	}
+	return c.checkExec(func() C.int {
+		return C.dpiVar_setVectorValues(dv, 0, C.uint32_t(rows), format, C.uint32_t(m.Dimensions), ptr)
+	})
+}
+
 func (c *conn) dataSetVectorValue(ctx context.Context, dv *C.dpiVar, data []C.dpiData,
 	vv interface{}) error {
 	if len(data) == 0 {
@@ -3721,6 +3932,22 @@ func (st *statement) openRows(ctx context.Context, colCount int) (*rows, error)
 		vars:      make([]*C.dpiVar, colCount),
 		data:      make([][]C.dpiData, colCount),
 	}
+	useArena := st.VarArena() && st.conn != nil
+	// the variables of the previous execution, still defined on dpiStmt
+	cached := st.lastQueryVars.take()
+	defer cached.release()
+	if len(cached.vars) != colCount {
+		cached.release()
+	}
+	if useArena || st.ReuseQueryVars() {
+		r.colVarInfos = make([]varInfo, colCount)
+	}
+
+	compact := st.CompactFetch() && st.conn != nil && st.conn.drv.clientVersion.Version >= 12
+
+	// with NumberAsFloat64, non-integer NUMBERs are fetched as native doubles,
+	// decoded straight from the OCINumber, without going through strings.
+	naf := !st.NumberAsString() && st.NumberAsFloat64()
 
 	var info C.dpiQueryInfo
 	var ti C.dpiDataTypeInfo
@@ -3742,8 +3969,12 @@ func (st *statement) openRows(ctx context.Context, colCount int) (*rows, error)
 		case C.DPI_ORACLE_TYPE_NUMBER:
 			switch ti.defaultNativeTypeNum {
 			case C.DPI_NATIVE_TYPE_FLOAT, C.DPI_NATIVE_TYPE_DOUBLE:
-				ti.defaultNativeTypeNum = C.DPI_NATIVE_TYPE_BYTES
-				bufSize = 40
+				if naf {
+					ti.defaultNativeTypeNum = C.DPI_NATIVE_TYPE_DOUBLE
+				} else {
+					ti.defaultNativeTypeNum = C.DPI_NATIVE_TYPE_BYTES
+					bufSize = 40
+				}
 			}
 		case C.DPI_ORACLE_TYPE_DATE,
 			C.DPI_ORACLE_TYPE_TIMESTAMP, C.DPI_ORACLE_TYPE_TIMESTAMP_TZ, C.DPI_ORACLE_TYPE_TIMESTAMP_LTZ:
@@ -3788,8 +4019,31 @@ func (st *statement) openRows(ctx context.Context, colCount int) (*rows, error)
 			BufSize:    bufSize,
 			SliceLen:   sliceLen,
 		}
-		if r.vars[i], r.data[i], err = st.newVar(vi); err != nil {
-			return nil, err
+		vi.Compact = compact && compactable(vi)
+		if r.colVarInfos != nil {
+			r.colVarInfos[i] = vi
+		}
+		r.vars[i], r.data[i] = cached.get(i, vi)
+		defined := r.vars[i] != nil && isDefinedAt(st.dpiStmt, i, r.vars[i])
+		if r.vars[i] == nil && useArena {
+			r.vars[i], r.data[i] = st.conn.varArena.get(vi)
+		}
+		if r.vars[i] == nil {
+			if r.vars[i], r.data[i], err = st.newVar(vi); err != nil {
+				return nil, err
+			}
+		}
+		if vi.Compact {
+			if r.compact == nil {
+				r.compact = make([]compactColumn, colCount)
+			}
+			if r.compact[i], err = st.conn.newCompactColumn(r.vars[i], sliceLen); err != nil {
+				return nil, err
+			}
+		}
+		if defined {
+			// same column as in the previous execution, no need to define again
+			continue
 		}
 
 		if err = st.checkExecNoLOT(func() C.int {
@@ -3804,6 +4058,7 @@ func (st *statement) openRows(ctx context.Context, colCount int) (*rows, error)
 		return &r, fmt.Errorf("dpiStmt_addRef: %w", err)
 	}
 	st.columns = r.columns
+	r.decoders = r.columnDecoders()
 	return &r, nil
 }
 
@@ -1,9 +1,168 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "dpiImpl.h"
+#include "subscr.h"
 
 void CallbackSubscr(void *context, dpiSubscrMessage *message);
+void CallbackSubscrNotify(void *context);
 
+int godrorSubscrDebug = 0;
+
+// godrorSubscrMessageSize returns the size needed to copy message,
+// with all its tables, queries, rows and strings;
+// and the size of the strings in stringsSize.
+static size_t godrorSubscrMessageSize(dpiSubscrMessage *message,
+		size_t *stringsSize) {
+	size_t size = sizeof(godrorSubscrMessage);
+	dpiSubscrMessageTable *tables;
+	uint32_t numTables, i, j, k;
+
+	*stringsSize = message->dbNameLength;
+	size += message->numQueries * sizeof(dpiSubscrMessageQuery);
+	for (i = 0; i <= message->numQueries; i++) {
+		if (i < message->numQueries) {
+			tables = message->queries[i].tables;
+			numTables = message->queries[i].numTables;
+		} else {
+			tables = message->tables;
+			numTables = message->numTables;
+		}
+		size += numTables * sizeof(dpiSubscrMessageTable);
+		for (j = 0; j < numTables; j++) {
+			size += tables[j].numRows * sizeof(dpiSubscrMessageRow);
+			*stringsSize += tables[j].nameLength;
+			for (k = 0; k < tables[j].numRows; k++)
+				*stringsSize += tables[j].rows[k].rowidLength;
+		}
+	}
+	return size + *stringsSize;
+}
+
+// godrorSubscrCopyTables copies the tables (with their rows) into the
+// structs and strings areas pointed to by structs and strings.
+static dpiSubscrMessageTable *godrorSubscrCopyTables(
+		dpiSubscrMessageTable *tables, uint32_t numTables, char **structs,
+		char **strings) {
+	dpiSubscrMessageTable *target = (dpiSubscrMessageTable*) *structs;
+	uint32_t i, j;
+
+	if (numTables == 0)
+		return NULL;
+	*structs += numTables * sizeof(dpiSubscrMessageTable);
+	for (i = 0; i < numTables; i++) {
+		target[i] = tables[i];
+		target[i].name = *strings;
+		memcpy(*strings, tables[i].name, tables[i].nameLength);
+		*strings += tables[i].nameLength;
+		if (tables[i].numRows == 0) {
+			target[i].rows = NULL;
+			continue;
+		}
+		target[i].rows = (dpiSubscrMessageRow*) *structs;
+		*structs += tables[i].numRows * sizeof(dpiSubscrMessageRow);
+		for (j = 0; j < tables[i].numRows; j++) {
+			target[i].rows[j] = tables[i].rows[j];
+			target[i].rows[j].rowid = *strings;
+			memcpy(*strings, tables[i].rows[j].rowid,
+					tables[i].rows[j].rowidLength);
+			*strings += tables[i].rows[j].rowidLength;
+		}
+	}
+	return target;
+}
+
+// godrorSubscrCopyMessage copies message (the parts used by CallbackSubscr)
+// into one allocation, which must be freed with free().
+static godrorSubscrMessage *godrorSubscrCopyMessage(
+		dpiSubscrMessage *message) {
+	godrorSubscrMessage *copy;
+	char *structs, *strings;
+	size_t size, stringsSize;
+	uint32_t i;
+
+	// all the structs come first (so they are aligned), then the strings
+	size = godrorSubscrMessageSize(message, &stringsSize);
+	copy = (godrorSubscrMessage*) malloc(size);
+	if (!copy)
+		return NULL;
+	memset(copy, 0, sizeof(godrorSubscrMessage));
+	structs = (char*) (copy + 1);
+	strings = ((char*) copy) + size - stringsSize;
+
+	copy->message.eventType = message->eventType;
+	copy->message.registered = message->registered;
+	copy->message.dbName = strings;
+	copy->message.dbNameLength = message->dbNameLength;
+	memcpy(strings, message->dbName, message->dbNameLength);
+	strings += message->dbNameLength;
+	if (message->numQueries > 0) {
+		copy->message.queries = (dpiSubscrMessageQuery*) structs;
+		copy->message.numQueries = message->numQueries;
+		structs += message->numQueries * sizeof(dpiSubscrMessageQuery);
+		for (i = 0; i < message->numQueries; i++) {
+			copy->message.queries[i] = message->queries[i];
+			copy->message.queries[i].tables = godrorSubscrCopyTables(
+					message->queries[i].tables,
+					message->queries[i].numTables, &structs, &strings);
+		}
+	}
+	copy->message.numTables = message->numTables;
+	copy->message.tables = godrorSubscrCopyTables(message->tables,
+			message->numTables, &structs, &strings);
+	return copy;
+}
+
+// CallbackSubscrDebug is the callback registered for subscriptions.
+//
+// The message is copied onto the lock-free queue of the subscription,
+// and Go is called (by CallbackSubscrNotify) only when the queue was empty,
+// so a burst of notifications costs one Go callback, not one per message.
+//
+// Messages with errors, and those which cannot be copied,
+// are passed to Go directly.
 void CallbackSubscrDebug(void *context, dpiSubscrMessage *message) {
-	fprintf(stderr, "callback called\n");
-	CallbackSubscr(context, message);
+	godrorSubscrQueue *queue = (godrorSubscrQueue*) context;
+	godrorSubscrMessage *copy = NULL, *head;
+
+	if (godrorSubscrDebug)
+		fprintf(stderr, "callback called\n");
+	if (message->errorInfo == NULL)
+		copy = godrorSubscrCopyMessage(message);
+	if (copy == NULL) {
+		CallbackSubscr(&queue->id, message);
+		return;
+	}
+	do {
+		head = dpiAtomic__loadPtr(&queue->head);
+		copy->next = head;
+	} while (!dpiAtomic__compareExchangePtr(&queue->head, head, copy));
+	if (head == NULL)
+		CallbackSubscrNotify(&queue->id);
+}
+
+// godrorSubscrTakeAll empties the queue, and returns its messages
+// in the order of arrival.
+godrorSubscrMessage *godrorSubscrTakeAll(godrorSubscrQueue *queue) {
+	godrorSubscrMessage *list, *reversed = NULL, *next;
+
+	list = dpiAtomic__exchangePtr(&queue->head, NULL);
+	while (list) {
+		next = list->next;
+		list->next = reversed;
+		reversed = list;
+		list = next;
+	}
+	return reversed;
+}
+
+// godrorSubscrFreeAll frees the messages of the list.
+void godrorSubscrFreeAll(godrorSubscrMessage *list) {
+	godrorSubscrMessage *next;
+
+	while (list) {
+		next = list->next;
+		free(list);
+		list = next;
+	}
 }
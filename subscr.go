@@ -9,9 +9,7 @@ package godror
 #include <stdlib.h>
 #include <stdio.h>
 #include "dpiImpl.h"
-
-void CallbackSubscrDebug(void *context, dpiSubscrMessage *message);
-
+#include "subscr.h"
 */
 import "C"
 
@@ -19,7 +17,7 @@ import (
 	"context"
 	"errors"
 	"fmt"
-	"log"
+	"log/slog"
 	"runtime"
 	"strings"
 	"sync"
@@ -84,18 +82,72 @@ var (
 	subscriptionsID uint64
 )
 
-// CallbackSubscr is the callback for C code on subscription event.
+// CallbackSubscr is the callback for C code on subscription event
+// which is not queued (errors, or when the copy failed).
 //
 //export CallbackSubscr
 func CallbackSubscr(ctx unsafe.Pointer, message *C.dpiSubscrMessage) {
-	log.Printf("CB %p %+v", ctx, message)
+	if logger := getLogger(context.TODO()); logger != nil && logger.Enabled(context.TODO(), slog.LevelDebug) {
+		logger.Debug("CallbackSubscr", "ctx", ctx, "message", message)
+	}
 	if ctx == nil {
 		return
 	}
 	subscriptionsMu.Lock()
 	subscr := subscriptions[*((*uint64)(ctx))]
 	subscriptionsMu.Unlock()
+	if subscr == nil {
+		return
+	}
+	subscr.callback(eventFromMessage(message))
+}
+
+// CallbackSubscrNotify is called by C code when a message is queued
+// on the empty queue of a subscription, to wake up its delivering goroutine.
+//
+//export CallbackSubscrNotify
+func CallbackSubscrNotify(ctx unsafe.Pointer) {
+	if ctx == nil {
+		return
+	}
+	subscriptionsMu.Lock()
+	subscr := subscriptions[*((*uint64)(ctx))]
+	subscriptionsMu.Unlock()
+	if subscr == nil {
+		return
+	}
+	select {
+	case subscr.notify <- struct{}{}:
+	default:
+	}
+}
+
+// deliver calls cb with the queued messages, in batches, until stop is signaled.
+// Frees the queue at the end if the value received from stop is true.
+func deliver(queue *C.godrorSubscrQueue, cb func(Event), notify <-chan struct{}, stop <-chan bool) {
+	drain := func() {
+		list := C.godrorSubscrTakeAll(queue)
+		for m := list; m != nil; m = m.next {
+			cb(eventFromMessage(&m.message))
+		}
+		C.godrorSubscrFreeAll(list)
+	}
+	for {
+		select {
+		case <-notify:
+			drain()
+		case free := <-stop:
+			drain()
+			if free {
+				C.free(unsafe.Pointer(queue))
+			}
+			return
+		}
+	}
+}
 
+// eventFromMessage converts the message to an Event.
+func eventFromMessage(message *C.dpiSubscrMessage) Event {
 	getRows := func(rws *C.dpiSubscrMessageRow, rwsNum C.uint32_t) []RowEvent {
 		if rwsNum == 0 {
 			return nil
@@ -150,14 +202,13 @@ func CallbackSubscr(ctx unsafe.Pointer, message *C.dpiSubscrMessage) {
 		err = fromErrorInfo(*message.errorInfo)
 	}
 
-	evt := Event{
+	return Event{
 		Err:     err,
 		Type:    EventType(message.eventType),
 		DB:      C.GoStringN(message.dbName, C.int(message.dbNameLength)),
 		Tables:  getTables(message.tables, message.numTables),
 		Queries: getQueries(message.queries, message.numQueries),
 	}
-	subscr.callback(evt)
 }
 
 // Event for a subscription.
@@ -194,6 +245,8 @@ type Subscription struct {
 	conn      *conn
 	dpiSubscr *C.dpiSubscr
 	callback  func(Event)
+	notify    chan struct{}
+	stop      chan bool
 	ID        uint64
 }
 
@@ -210,7 +263,7 @@ func (c *conn) NewSubscription(name string, cb func(Event), options ...Subscript
 	for _, o := range options {
 		o(&p)
 	}
-	subscr := Subscription{conn: c, callback: cb}
+	subscr := Subscription{conn: c, callback: cb, notify: make(chan struct{}, 1), stop: make(chan bool, 1)}
 	params := (*C.dpiSubscrCreateParams)(C.malloc(C.sizeof_dpiSubscrCreateParams))
 	defer func() { C.free(unsafe.Pointer(params)) }()
 	C.dpiContext_initSubscrCreateParams(c.drv.dpiContext, params)
@@ -244,15 +297,19 @@ func (c *conn) NewSubscription(name string, cb func(Event), options ...Subscript
 	}
 	// typedef void (*dpiSubscrCallback)(void* context, dpiSubscrMessage *message);
 	params.callback = C.dpiSubscrCallback(C.CallbackSubscrDebug)
+	if logger := getLogger(context.TODO()); logger != nil && logger.Enabled(context.TODO(), slog.LevelDebug) {
+		C.godrorSubscrDebug = 1
+	}
 	// cannot pass &subscr to C, so pass indirectly
 	subscriptionsMu.Lock()
 	subscriptionsID++
 	subscr.ID = subscriptionsID
 	subscriptions[subscr.ID] = &subscr
 	subscriptionsMu.Unlock()
-	subscrID := (*C.uint64_t)(C.malloc(8))
-	*subscrID = C.uint64_t(subscriptionsID)
-	params.callbackContext = unsafe.Pointer(subscrID)
+	// the messages are queued here, and delivered by a goroutine in batches
+	queue := (*C.godrorSubscrQueue)(C.calloc(1, C.sizeof_godrorSubscrQueue))
+	queue.id = C.uint64_t(subscr.ID)
+	params.callbackContext = unsafe.Pointer(queue)
 
 	dpiSubscr := (*C.dpiSubscr)(C.malloc(C.sizeof_void))
 
@@ -260,6 +317,10 @@ func (c *conn) NewSubscription(name string, cb func(Event), options ...Subscript
 		return C.dpiConn_subscribe(c.dpiConn, params, (**C.dpiSubscr)(unsafe.Pointer(&dpiSubscr)))
 	}); err != nil {
 		C.free(unsafe.Pointer(dpiSubscr))
+		subscriptionsMu.Lock()
+		delete(subscriptions, subscr.ID)
+		subscriptionsMu.Unlock()
+		C.free(unsafe.Pointer(queue))
 		err = fmt.Errorf("newSubscription: %w", err)
 		if strings.Contains(errors.Unwrap(err).Error(), "DPI-1065:") {
 			err = fmt.Errorf("specify \"enableEvents=1\" connection parameter on connection to be able to use subscriptions: %w", err)
@@ -267,6 +328,7 @@ func (c *conn) NewSubscription(name string, cb func(Event), options ...Subscript
 		return nil, err
 	}
 	subscr.dpiSubscr = dpiSubscr
+	go deliver(queue, cb, subscr.notify, subscr.stop)
 	return &subscr, nil
 }
 
@@ -303,6 +365,28 @@ func (s *Subscription) Register(qry string, params ...interface{}) error {
 	return nil
 }
 
+// prepareStmt prepares qry on the connection of the subscription,
+// to be registered for change notification when executed.
+func (s *Subscription) prepareStmt(qry string) (*statement, error) {
+	cQry := C.CString(qry)
+	defer C.free(unsafe.Pointer(cQry))
+
+	c := s.conn
+	c.mu.RLock()
+	defer c.mu.RUnlock()
+	st := &statement{conn: c, query: qry}
+	if err := c.checkExec(func() C.int {
+		return C.dpiSubscr_prepareStmt(s.dpiSubscr, cQry, C.uint32_t(len(qry)), &st.dpiStmt)
+	}); err != nil {
+		return nil, fmt.Errorf("prepareStmt[%p]: %s: %w", s.dpiSubscr, qry, err)
+	}
+	if err := c.checkExec(func() C.int { return C.dpiStmt_getInfo(st.dpiStmt, &st.dpiStmtInfo) }); err != nil {
+		st.closeNotLocking(context.Background())
+		return nil, fmt.Errorf("getStmtInfo: %w", err)
+	}
+	return st, nil
+}
+
 // Close the subscription.
 //
 // This code is EXPERIMENTAL yet!
@@ -315,10 +399,21 @@ func (s *Subscription) Close() error {
 	s.conn = nil
 	s.dpiSubscr = nil
 	s.callback = nil
-	if dpiSubscr == nil || conn == nil || conn.dpiConn == nil {
+	if dpiSubscr == nil {
+		return nil
+	}
+	if conn == nil || conn.dpiConn == nil {
+		s.stop <- false
 		return nil
 	}
-	if err := conn.checkExec(func() C.int { return C.dpiConn_unsubscribe(conn.dpiConn, dpiSubscr) }); err != nil {
+	err := conn.checkExec(func() C.int { return C.dpiConn_unsubscribe(conn.dpiConn, dpiSubscr) })
+	if err != nil {
+		// freeing the subscription handle stops the callbacks, too
+		C.dpiSubscr_release(dpiSubscr)
+	}
+	// the queue can be freed only when no more callbacks come
+	s.stop <- true
+	if err != nil {
 		return fmt.Errorf("close: %w", err)
 	}
 	return nil
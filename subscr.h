@@ -0,0 +1,25 @@
+#ifndef GODROR_SUBSCR
+#define GODROR_SUBSCR
+
+// godrorSubscrMessage is a copy of a dpiSubscrMessage, in one allocation.
+struct godrorSubscrMessage {
+  struct godrorSubscrMessage *next;
+  dpiSubscrMessage message;
+};
+typedef struct godrorSubscrMessage godrorSubscrMessage;
+
+// godrorSubscrQueue is the callback context of a subscription:
+// the messages are pushed to head by CallbackSubscrDebug.
+struct godrorSubscrQueue {
+  uint64_t id;
+  godrorSubscrMessage *head;
+};
+typedef struct godrorSubscrQueue godrorSubscrQueue;
+
+extern int godrorSubscrDebug;
+
+void CallbackSubscrDebug(void *context, dpiSubscrMessage *message);
+godrorSubscrMessage *godrorSubscrTakeAll(godrorSubscrQueue *queue);
+void godrorSubscrFreeAll(godrorSubscrMessage *list);
+
+#endif
@@ -0,0 +1,179 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#include "dpiImpl.h"
+*/
+import "C"
+import (
+	"sync"
+	"unsafe"
+)
+
+// maxArenaVars is the maximum number of variables a connection's arena keeps.
+const maxArenaVars = 256
+
+// varArena keeps the query variables of closed result sets,
+// to be handed out again to later queries on the same connection,
+// instead of freeing and reallocating all their buffers
+// (data, indicators, lengths, return codes, dpiData) on each execution.
+type varArena struct {
+	free map[varInfo][]arenaVar
+	mu   sync.Mutex
+	n    int
+}
+
+type arenaVar struct {
+	v    *C.dpiVar
+	data []C.dpiData
+}
+
+// arenaable reports whether a variable described by vi holds no references
+// to other handles (LOBs, objects, statements, rowids, JSON, vectors)
+// nor dynamically allocated chunks, so it can be safely reused as-is.
+func arenaable(vi varInfo) bool {
+	if vi.ObjectType != nil || vi.IsPLSArray {
+		return false
+	}
+	switch vi.Typ {
+	case C.DPI_ORACLE_TYPE_LONG_VARCHAR, C.DPI_ORACLE_TYPE_LONG_NVARCHAR, C.DPI_ORACLE_TYPE_LONG_RAW,
+		C.DPI_ORACLE_TYPE_CLOB, C.DPI_ORACLE_TYPE_NCLOB, C.DPI_ORACLE_TYPE_BLOB, C.DPI_ORACLE_TYPE_BFILE,
+		C.DPI_ORACLE_TYPE_STMT, C.DPI_ORACLE_TYPE_ROWID, C.DPI_ORACLE_TYPE_OBJECT,
+		C.DPI_ORACLE_TYPE_JSON, C.DPI_ORACLE_TYPE_JSON_OBJECT, C.DPI_ORACLE_TYPE_JSON_ARRAY,
+		C.DPI_ORACLE_TYPE_VECTOR:
+		return false
+	}
+	switch vi.NatTyp {
+	case C.DPI_NATIVE_TYPE_INT64, C.DPI_NATIVE_TYPE_UINT64,
+		C.DPI_NATIVE_TYPE_FLOAT, C.DPI_NATIVE_TYPE_DOUBLE,
+		C.DPI_NATIVE_TYPE_BYTES, C.DPI_NATIVE_TYPE_TIMESTAMP,
+		C.DPI_NATIVE_TYPE_INTERVAL_DS, C.DPI_NATIVE_TYPE_INTERVAL_YM,
+		C.DPI_NATIVE_TYPE_BOOLEAN:
+		return true
+	}
+	return false
+}
+
+// get returns a variable matching vi, or nil if there is none.
+//
+// A variable still defined on a live statement (its refCount is above ours)
+// is dropped instead, as its buffers may still be written by that statement.
+func (a *varArena) get(vi varInfo) (*C.dpiVar, []C.dpiData) {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	vs := a.free[vi]
+	for len(vs) != 0 {
+		av := vs[len(vs)-1]
+		vs[len(vs)-1] = arenaVar{}
+		vs = vs[:len(vs)-1]
+		a.n--
+		if av.v.refCount == 1 {
+			a.free[vi] = vs
+			return av.v, av.data
+		}
+		C.dpiVar_release(av.v)
+	}
+	a.free[vi] = vs
+	return nil, nil
+}
+
+// put stores v in the arena, or releases it when it cannot be reused or the arena is full.
+func (a *varArena) put(vi varInfo, v *C.dpiVar, data []C.dpiData) {
+	if v == nil {
+		return
+	}
+	if !arenaable(vi) || !vi.Compact && len(data) != vi.SliceLen {
+		C.dpiVar_release(v)
+		return
+	}
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	if a.n >= maxArenaVars {
+		C.dpiVar_release(v)
+		return
+	}
+	if a.free == nil {
+		a.free = make(map[varInfo][]arenaVar)
+	}
+	a.free[vi] = append(a.free[vi], arenaVar{v: v, data: data})
+	a.n++
+}
+
+// release frees all the variables kept in the arena.
+func (a *varArena) release() {
+	a.mu.Lock()
+	defer a.mu.Unlock()
+	for k, vs := range a.free {
+		for _, av := range vs {
+			C.dpiVar_release(av.v)
+		}
+		delete(a.free, k)
+	}
+	a.n = 0
+}
+
+// queryVars holds query variables with the varInfo each has been created with.
+type queryVars struct {
+	vars  []*C.dpiVar
+	data  [][]C.dpiData
+	infos []varInfo
+}
+
+// get returns the i-th variable iff it has been created with vi,
+// removing it from qv.
+func (qv *queryVars) get(i int, vi varInfo) (*C.dpiVar, []C.dpiData) {
+	if i >= len(qv.vars) || qv.vars[i] == nil || qv.infos[i] != vi {
+		return nil, nil
+	}
+	v, data := qv.vars[i], qv.data[i]
+	qv.vars[i], qv.data[i] = nil, nil
+	return v, data
+}
+
+// release frees the remaining variables.
+func (qv *queryVars) release() {
+	for _, v := range qv.vars {
+		if v != nil {
+			C.dpiVar_release(v)
+		}
+	}
+	qv.vars, qv.data, qv.infos = nil, nil, nil
+}
+
+// queryVarCache keeps the query variables of a statement's last closed result set,
+// still defined on the statement, for reuse by its next execution:
+// if the described columns are the same, the defines are kept as is.
+type queryVarCache struct {
+	queryVars
+	mu sync.Mutex
+}
+
+// set replaces the cached variables with qv, releasing the previous ones.
+func (q *queryVarCache) set(qv queryVars) {
+	q.mu.Lock()
+	old := q.queryVars
+	q.queryVars = qv
+	q.mu.Unlock()
+	old.release()
+}
+
+// take returns all the cached variables, emptying the cache.
+func (q *queryVarCache) take() queryVars {
+	q.mu.Lock()
+	defer q.mu.Unlock()
+	qv := q.queryVars
+	q.queryVars = queryVars{}
+	return qv
+}
+
+// isDefinedAt reports whether v is the variable defined at the (0-based) pos-th column of dpiStmt.
+func isDefinedAt(dpiStmt *C.dpiStmt, pos int, v *C.dpiVar) bool {
+	if dpiStmt == nil || dpiStmt.queryVars == nil || pos >= int(dpiStmt.numQueryVars) {
+		return false
+	}
+	return unsafe.Slice(dpiStmt.queryVars, dpiStmt.numQueryVars)[pos] == v
+}
@@ -157,3 +157,62 @@ func GetVectorValue(vectorInfo *C.dpiVectorInfo) (Vector, error) {
 		IsSparse:   isSparse,
 	}, nil
 }
+
+// VectorMatrix is a batch of dense vectors of the same format and Dimensions,
+// stored contiguously (row after row), to be bound as one argument
+// of an array DML (executeMany), each row getting one vector.
+//
+// All the vectors are set with one call, reusing the vector descriptors of the bind variable.
+type VectorMatrix struct {
+	// Values is []float32, []float64, []int8 or []uint8 (BINARY, Dimensions/8 bytes per row).
+	Values     interface{}
+	Dimensions int
+}
+
+// Rows returns the number of vectors in the matrix.
+func (m VectorMatrix) Rows() int {
+	rowLen := m.Dimensions
+	if _, ok := m.Values.([]uint8); ok {
+		rowLen /= 8
+	}
+	if rowLen <= 0 {
+		return 0
+	}
+	switch values := m.Values.(type) {
+	case []float32:
+		return len(values) / rowLen
+	case []float64:
+		return len(values) / rowLen
+	case []int8:
+		return len(values) / rowLen
+	case []uint8:
+		return len(values) / rowLen
+	}
+	return 0
+}
+
+// data returns the format and the first value of the matrix.
+func (m VectorMatrix) data() (C.uint8_t, unsafe.Pointer, int, error) {
+	var format C.uint8_t
+	var ptr unsafe.Pointer
+	var n int
+	switch values := m.Values.(type) {
+	case []float32:
+		format, n, ptr = C.DPI_VECTOR_FORMAT_FLOAT32, len(values), unsafe.Pointer(unsafe.SliceData(values))
+	case []float64:
+		format, n, ptr = C.DPI_VECTOR_FORMAT_FLOAT64, len(values), unsafe.Pointer(unsafe.SliceData(values))
+	case []int8:
+		format, n, ptr = C.DPI_VECTOR_FORMAT_INT8, len(values), unsafe.Pointer(unsafe.SliceData(values))
+	case []uint8:
+		if m.Dimensions%8 != 0 {
+			return 0, nil, 0, fmt.Errorf("BINARY vector dimensions (%d) must be a multiple of 8", m.Dimensions)
+		}
+		format, n, ptr = C.DPI_VECTOR_FORMAT_BINARY, 8*len(values), unsafe.Pointer(unsafe.SliceData(values))
+	default:
+		return 0, nil, 0, fmt.Errorf("VectorMatrix unsupported type: %T in Values", m.Values)
+	}
+	if m.Dimensions <= 0 || n%m.Dimensions != 0 {
+		return 0, nil, 0, fmt.Errorf("VectorMatrix of %d values is not of vectors of %d dimensions", n, m.Dimensions)
+	}
+	return format, ptr, n / m.Dimensions, nil
+}
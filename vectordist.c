@@ -0,0 +1,138 @@
+#include <math.h>
+#include <string.h>
+#include "vectordist.h"
+
+// The kernels use the vector extensions of GCC and Clang, which are compiled
+// to SSE, AVX or NEON instructions, as the target has them. On x86-64 glibc,
+// AVX2 and AVX-512 clones are also compiled, and chosen at load time.
+#if defined(__x86_64__) && defined(__GLIBC__) && (defined(__clang__) || \
+		(defined(__GNUC__) && __GNUC__ >= 6))
+#define GODROR_TARGET_CLONES \
+		__attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define GODROR_TARGET_CLONES
+#endif
+
+typedef float godrorFloat32x8 __attribute__((vector_size(32)));
+
+#define GODROR_LANES 8
+
+// GODROR_LOAD loads GODROR_LANES (possibly unaligned) floats from p into v.
+// It is a macro (as GODROR_SUM), as passing vectors to functions depends on
+// the instruction set.
+#define GODROR_LOAD(v, p) memcpy(&(v), (p), sizeof(v))
+
+// GODROR_SUM adds the lanes of v to sum.
+#define GODROR_SUM(sum, v) \
+	do { \
+		int lane_; \
+		for (lane_ = 0; lane_ < GODROR_LANES; lane_++) \
+			(sum) += (v)[lane_]; \
+	} while (0)
+
+// godrorDot returns the dot product of a and b, and the dot product of b
+// with itself in bb (if not NULL).
+GODROR_TARGET_CLONES
+static float godrorDot(const float *a, const float *b, uint32_t n,
+		float *bb) {
+	godrorFloat32x8 acc0 = {0}, acc1 = {0}, norm0 = {0}, norm1 = {0};
+	godrorFloat32x8 va, vb, vc, vd;
+	float dot = 0, norm = 0;
+	uint32_t i = 0;
+
+	for (; i + 2*GODROR_LANES <= n; i += 2*GODROR_LANES) {
+		GODROR_LOAD(va, a + i);
+		GODROR_LOAD(vb, b + i);
+		GODROR_LOAD(vc, a + i + GODROR_LANES);
+		GODROR_LOAD(vd, b + i + GODROR_LANES);
+		acc0 += va * vb;
+		acc1 += vc * vd;
+		norm0 += vb * vb;
+		norm1 += vd * vd;
+	}
+	acc0 += acc1;
+	GODROR_SUM(dot, acc0);
+	if (bb) {
+		norm0 += norm1;
+		GODROR_SUM(norm, norm0);
+	}
+	for (; i < n; i++) {
+		dot += a[i] * b[i];
+		norm += b[i] * b[i];
+	}
+	if (bb)
+		*bb = norm;
+	return dot;
+}
+
+// godrorSquaredDistance returns the sum of the squared differences of a and
+// b.
+GODROR_TARGET_CLONES
+static float godrorSquaredDistance(const float *a, const float *b,
+		uint32_t n) {
+	godrorFloat32x8 acc0 = {0}, acc1 = {0}, va, vb, vc, vd;
+	float sum = 0, d;
+	uint32_t i = 0;
+
+	for (; i + 2*GODROR_LANES <= n; i += 2*GODROR_LANES) {
+		GODROR_LOAD(va, a + i);
+		GODROR_LOAD(vb, b + i);
+		GODROR_LOAD(vc, a + i + GODROR_LANES);
+		GODROR_LOAD(vd, b + i + GODROR_LANES);
+		va -= vb;
+		vc -= vd;
+		acc0 += va * va;
+		acc1 += vc * vc;
+	}
+	acc0 += acc1;
+	GODROR_SUM(sum, acc0);
+	for (; i < n; i++) {
+		d = a[i] - b[i];
+		sum += d * d;
+	}
+	return sum;
+}
+
+// godrorHammingDistance returns the number of dimensions where a and b
+// differ.
+static float godrorHammingDistance(const float *a, const float *b,
+		uint32_t n) {
+	uint32_t i, count = 0;
+
+	for (i = 0; i < n; i++)
+		count += a[i] != b[i];
+	return (float) count;
+}
+
+void godrorVectorDistancesFloat32(int metric, const float *query,
+		const float *matrix, uint32_t numRows, uint32_t numDims,
+		float *distances) {
+	const float *row = matrix;
+	float queryNorm = 0, rowNorm, dot;
+	uint32_t i;
+
+	if (metric == GODROR_DISTANCE_COSINE)
+		godrorDot(query, query, numDims, &queryNorm);
+	for (i = 0; i < numRows; i++, row += numDims) {
+		switch (metric) {
+			case GODROR_DISTANCE_COSINE:
+				dot = godrorDot(query, row, numDims, &rowNorm);
+				distances[i] = (queryNorm == 0 || rowNorm == 0) ? 1 :
+						1 - dot / sqrtf(queryNorm * rowNorm);
+				break;
+			case GODROR_DISTANCE_DOT:
+				distances[i] = -godrorDot(query, row, numDims, NULL);
+				break;
+			case GODROR_DISTANCE_EUCLIDEAN:
+				distances[i] = sqrtf(godrorSquaredDistance(query, row,
+						numDims));
+				break;
+			case GODROR_DISTANCE_EUCLIDEAN_SQUARED:
+				distances[i] = godrorSquaredDistance(query, row, numDims);
+				break;
+			default:
+				distances[i] = godrorHammingDistance(query, row, numDims);
+				break;
+		}
+	}
+}
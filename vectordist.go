@@ -0,0 +1,356 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror
+
+/*
+#cgo LDFLAGS: -lm
+#include "vectordist.h"
+*/
+import "C"
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"math"
+	"math/bits"
+	"sort"
+	"unsafe"
+)
+
+// VectorDistanceMetric is a metric of VectorDistance, as of the VECTOR_DISTANCE SQL function.
+// For all of them, the smaller distance is the nearer.
+type VectorDistanceMetric uint8
+
+const (
+	// DistanceCosine is 1 - the cosine similarity. It is 1 if any of the vectors is zero.
+	DistanceCosine = VectorDistanceMetric(C.GODROR_DISTANCE_COSINE)
+	// DistanceDot is the negated dot product.
+	DistanceDot = VectorDistanceMetric(C.GODROR_DISTANCE_DOT)
+	// DistanceEuclidean is the L2 distance.
+	DistanceEuclidean = VectorDistanceMetric(C.GODROR_DISTANCE_EUCLIDEAN)
+	// DistanceEuclideanSquared is the square of the L2 distance.
+	DistanceEuclideanSquared = VectorDistanceMetric(C.GODROR_DISTANCE_EUCLIDEAN_SQUARED)
+	// DistanceHamming is the number of differing dimensions (bits, for BINARY vectors).
+	DistanceHamming = VectorDistanceMetric(C.GODROR_DISTANCE_HAMMING)
+)
+
+func (m VectorDistanceMetric) check() error {
+	if m < DistanceCosine || m > DistanceHamming {
+		return fmt.Errorf("unknown vector distance metric %d", m)
+	}
+	return nil
+}
+
+// minNativeDims is the number of dimensions from which the cgo call
+// to the SIMD kernels is cheaper than the Go loop.
+const minNativeDims = 32
+
+// VectorDistance returns the distance of a and b, which must have the same format and number of dimensions.
+// Any of them may be sparse.
+//
+// BINARY vectors support DistanceHamming only.
+func VectorDistance(metric VectorDistanceMetric, a, b Vector) (float64, error) {
+	if err := metric.check(); err != nil {
+		return 0, err
+	}
+	switch av := a.Values.(type) {
+	case []float32:
+		if bv, ok := b.Values.([]float32); ok {
+			aSparse, bSparse := a.IsSparse || len(a.Indices) != 0, b.IsSparse || len(b.Indices) != 0
+			if !aSparse && !bSparse && len(av) >= minNativeDims && len(av) == len(bv) {
+				var d [1]float32
+				C.godrorVectorDistancesFloat32(C.int(metric),
+					(*C.float)(unsafe.Pointer(&av[0])), (*C.float)(unsafe.Pointer(&bv[0])),
+					1, C.uint32_t(len(av)), (*C.float)(unsafe.Pointer(&d[0])))
+				return float64(d[0]), nil
+			}
+			return vectorDistance(metric, a, av, b, bv)
+		}
+	case []float64:
+		if bv, ok := b.Values.([]float64); ok {
+			return vectorDistance(metric, a, av, b, bv)
+		}
+	case []int8:
+		if bv, ok := b.Values.([]int8); ok {
+			return vectorDistance(metric, a, av, b, bv)
+		}
+	case []uint8:
+		if bv, ok := b.Values.([]uint8); ok {
+			if metric != DistanceHamming {
+				return 0, errors.New("BINARY vectors support only the HAMMING distance")
+			}
+			if len(av) != len(bv) {
+				return 0, fmt.Errorf("vector dimensions mismatch: %d and %d", 8*len(av), 8*len(bv))
+			}
+			return float64(hammingBits(av, bv)), nil
+		}
+	default:
+		return 0, fmt.Errorf("unsupported vector values %T", a.Values)
+	}
+	return 0, fmt.Errorf("vector formats mismatch: %T and %T", a.Values, b.Values)
+}
+
+type vectorNumber interface {
+	~float32 | ~float64 | ~int8
+}
+
+func vectorDistance[T vectorNumber](metric VectorDistanceMetric, a Vector, av []T, b Vector, bv []T) (float64, error) {
+	aSparse, bSparse := a.IsSparse || len(a.Indices) != 0, b.IsSparse || len(b.Indices) != 0
+	if !aSparse && !bSparse {
+		if len(av) != len(bv) {
+			return 0, fmt.Errorf("vector dimensions mismatch: %d and %d", len(av), len(bv))
+		}
+		return denseDistance(metric, av, bv), nil
+	}
+	var ai, bi []uint32 // nil for the dense one
+	aDims, bDims := len(av), len(bv)
+	if aSparse {
+		if len(a.Indices) != len(av) {
+			return 0, fmt.Errorf("sparse vector has %d indices for %d values", len(a.Indices), len(av))
+		}
+		ai, aDims = a.Indices, int(a.Dimensions)
+	}
+	if bSparse {
+		if len(b.Indices) != len(bv) {
+			return 0, fmt.Errorf("sparse vector has %d indices for %d values", len(b.Indices), len(bv))
+		}
+		bi, bDims = b.Indices, int(b.Dimensions)
+	}
+	if aDims != bDims {
+		return 0, fmt.Errorf("vector dimensions mismatch: %d and %d", aDims, bDims)
+	}
+	return sparseDistance(metric, ai, av, bi, bv), nil
+}
+
+// distanceSums are the sums all the metrics are computed from.
+type distanceSums struct {
+	dot, aa, bb, dd, diff float64
+}
+
+func (s *distanceSums) add(x, y float64) {
+	s.dot += x * y
+	s.aa += x * x
+	s.bb += y * y
+	d := x - y
+	s.dd += d * d
+	if d != 0 {
+		s.diff++
+	}
+}
+
+func (s distanceSums) distance(metric VectorDistanceMetric) float64 {
+	switch metric {
+	case DistanceCosine:
+		if s.aa == 0 || s.bb == 0 {
+			return 1
+		}
+		return 1 - s.dot/math.Sqrt(s.aa*s.bb)
+	case DistanceDot:
+		return -s.dot
+	case DistanceEuclidean:
+		return math.Sqrt(s.dd)
+	case DistanceEuclideanSquared:
+		return s.dd
+	default:
+		return s.diff
+	}
+}
+
+// denseDistance is the Go version of the godrorVectorDistancesFloat32 kernels,
+// with only the sums the metric needs, in two lanes.
+func denseDistance[T vectorNumber](metric VectorDistanceMetric, a, b []T) float64 {
+	var s0, s1 distanceSums
+	b = b[:len(a)]
+	n := len(a) &^ 1
+	switch metric {
+	case DistanceCosine:
+		for i := 0; i < n; i += 2 {
+			x0, y0, x1, y1 := float64(a[i]), float64(b[i]), float64(a[i+1]), float64(b[i+1])
+			s0.dot, s0.aa, s0.bb = s0.dot+x0*y0, s0.aa+x0*x0, s0.bb+y0*y0
+			s1.dot, s1.aa, s1.bb = s1.dot+x1*y1, s1.aa+x1*x1, s1.bb+y1*y1
+		}
+	case DistanceDot:
+		for i := 0; i < n; i += 2 {
+			s0.dot += float64(a[i]) * float64(b[i])
+			s1.dot += float64(a[i+1]) * float64(b[i+1])
+		}
+	case DistanceEuclidean, DistanceEuclideanSquared:
+		for i := 0; i < n; i += 2 {
+			d0, d1 := float64(a[i])-float64(b[i]), float64(a[i+1])-float64(b[i+1])
+			s0.dd += d0 * d0
+			s1.dd += d1 * d1
+		}
+	default:
+		for i := 0; i < n; i++ {
+			if a[i] != b[i] {
+				s0.diff++
+			}
+		}
+	}
+	for i := n; i < len(a); i++ {
+		s0.add(float64(a[i]), float64(b[i]))
+	}
+	s0.dot, s0.aa, s0.bb, s0.dd, s0.diff = s0.dot+s1.dot, s0.aa+s1.aa, s0.bb+s1.bb, s0.dd+s1.dd, s0.diff+s1.diff
+	return s0.distance(metric)
+}
+
+// sparseDistance merges the (ascending) indices of a and b; nil indices mean a dense vector.
+func sparseDistance[T vectorNumber](metric VectorDistanceMetric, ai []uint32, av []T, bi []uint32, bv []T) float64 {
+	index := func(indices []uint32, i int) uint32 {
+		if indices == nil {
+			return uint32(i)
+		}
+		return indices[i]
+	}
+	var s distanceSums
+	i, j := 0, 0
+	for i < len(av) || j < len(bv) {
+		switch {
+		case j == len(bv) || i < len(av) && index(ai, i) < index(bi, j):
+			s.add(float64(av[i]), 0)
+			i++
+		case i == len(av) || index(ai, i) > index(bi, j):
+			s.add(0, float64(bv[j]))
+			j++
+		default:
+			s.add(float64(av[i]), float64(bv[j]))
+			i, j = i+1, j+1
+		}
+	}
+	return s.distance(metric)
+}
+
+// hammingBits returns the number of differing bits of a and b.
+func hammingBits(a, b []uint8) int {
+	var n int
+	b = b[:len(a)]
+	for len(a) >= 8 {
+		n += bits.OnesCount64(binary.LittleEndian.Uint64(a) ^ binary.LittleEndian.Uint64(b))
+		a, b = a[8:], b[8:]
+	}
+	for i := range a {
+		n += bits.OnesCount8(a[i] ^ b[i])
+	}
+	return n
+}
+
+// VectorDistances computes the distances of query and each row of matrix
+// (which holds len(matrix)/len(query) vectors, row after row, as ColumnBuffer.VectorFloat32)
+// into distances (resized as needed), with one call to the SIMD kernels.
+func VectorDistances(metric VectorDistanceMetric, query, matrix, distances []float32) ([]float32, error) {
+	if err := metric.check(); err != nil {
+		return distances, err
+	}
+	dims := len(query)
+	if dims == 0 || len(matrix)%dims != 0 {
+		return distances, fmt.Errorf("matrix of %d values is not of vectors of %d dimensions", len(matrix), dims)
+	}
+	n := len(matrix) / dims
+	distances = resize(distances, n)
+	if n == 0 {
+		return distances, nil
+	}
+	if dims < minNativeDims {
+		for j := range distances {
+			distances[j] = float32(denseDistance(metric, query, matrix[j*dims:(j+1)*dims]))
+		}
+		return distances, nil
+	}
+	C.godrorVectorDistancesFloat32(C.int(metric),
+		(*C.float)(unsafe.Pointer(&query[0])), (*C.float)(unsafe.Pointer(&matrix[0])),
+		C.uint32_t(n), C.uint32_t(dims), (*C.float)(unsafe.Pointer(&distances[0])))
+	return distances, nil
+}
+
+// VectorHit is a row found by VectorTopK.
+type VectorHit struct {
+	// Row is the index of the row in all the batches added.
+	Row      int
+	Distance float32
+}
+
+// VectorTopK collects the K rows nearest to Query,
+// from the batches of a FetchColumns (or QueryColumns) fetch of a FLOAT32 VECTOR column.
+//
+//	topK := godror.VectorTopK{Metric: godror.DistanceCosine, Query: q, K: 10}
+//	err := godror.QueryColumns(ctx, db, "SELECT embedding FROM docs", nil, nil,
+//		func(dest []godror.ColumnBuffer, n int) error { return topK.Add(&dest[0]) })
+//	hits := topK.Hits()
+type VectorTopK struct {
+	Query     []float32
+	hits      []VectorHit // max-heap on Distance
+	distances []float32
+	rows      int
+	K         int
+	Metric    VectorDistanceMetric
+}
+
+// Add adds the rows (the NULL ones excepted) of the VectorFloat32 slice of cb as candidates.
+func (t *VectorTopK) Add(cb *ColumnBuffer) error {
+	if cb.Dimensions != len(t.Query) {
+		return fmt.Errorf("got vectors of %d dimensions, query has %d", cb.Dimensions, len(t.Query))
+	}
+	var err error
+	if t.distances, err = VectorDistances(t.Metric, t.Query, cb.VectorFloat32, t.distances); err != nil {
+		return err
+	}
+	for j, d := range t.distances {
+		if len(cb.Nulls) != 0 && cb.IsNull(j) || d != d {
+			continue
+		}
+		t.push(VectorHit{Row: t.rows + j, Distance: d})
+	}
+	t.rows += len(t.distances)
+	return nil
+}
+
+// Hits returns the hits collected, the nearest first.
+func (t *VectorTopK) Hits() []VectorHit {
+	hits := append([]VectorHit(nil), t.hits...)
+	sort.Slice(hits, func(i, j int) bool {
+		return hits[i].Distance < hits[j].Distance || hits[i].Distance == hits[j].Distance && hits[i].Row < hits[j].Row
+	})
+	return hits
+}
+
+// Reset forgets the hits and rows added, to start a new search.
+func (t *VectorTopK) Reset() { t.hits, t.rows = t.hits[:0], 0 }
+
+func (t *VectorTopK) push(h VectorHit) {
+	if t.K <= 0 {
+		return
+	}
+	if len(t.hits) < t.K {
+		t.hits = append(t.hits, h)
+		for i := len(t.hits) - 1; i > 0; {
+			p := (i - 1) / 2
+			if t.hits[p].Distance >= t.hits[i].Distance {
+				break
+			}
+			t.hits[p], t.hits[i] = t.hits[i], t.hits[p]
+			i = p
+		}
+		return
+	}
+	if h.Distance >= t.hits[0].Distance {
+		return
+	}
+	t.hits[0] = h
+	for i := 0; ; {
+		l, m := 2*i+1, i
+		if l < len(t.hits) && t.hits[l].Distance > t.hits[m].Distance {
+			m = l
+		}
+		if r := l + 1; r < len(t.hits) && t.hits[r].Distance > t.hits[m].Distance {
+			m = r
+		}
+		if m == i {
+			break
+		}
+		t.hits[i], t.hits[m] = t.hits[m], t.hits[i]
+		i = m
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef GODROR_VECTORDIST
+#define GODROR_VECTORDIST
+
+#include <stdint.h>
+
+// the metrics of godrorVectorDistancesFloat32, as VectorDistanceMetric
+#define GODROR_DISTANCE_COSINE 1
+#define GODROR_DISTANCE_DOT 2
+#define GODROR_DISTANCE_EUCLIDEAN 3
+#define GODROR_DISTANCE_EUCLIDEAN_SQUARED 4
+#define GODROR_DISTANCE_HAMMING 5
+
+// godrorVectorDistancesFloat32 computes the distances of query and each of
+// the numRows vectors of matrix (stored row after row, numDims values each)
+// into distances.
+void godrorVectorDistancesFloat32(int metric, const float *query,
+		const float *matrix, uint32_t numRows, uint32_t numDims,
+		float *distances);
+
+#endif
@@ -9,6 +9,7 @@ import (
 	"context"
 	"database/sql"
 	"fmt"
+	"strings"
 	"testing"
 	"time"
 
@@ -616,3 +617,151 @@ func TestBatchFlushError(t *testing.T) {
 
 	t.Logf("Got expected error: %v", err)
 }
+
+func TestDirectBatch(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("DirectBatch"), time.Minute)
+	defer cancel()
+
+	tbl := "test_direct_batch" + tblSuffix
+	create := `CREATE TABLE ` + tbl + ` (F_int NUMBER(9), F_num NUMBER, F_text VARCHAR2(100), F_date DATE)`
+	if _, err := testDb.ExecContext(ctx, create); err != nil {
+		t.Fatal(err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), "DROP TABLE "+tbl) }()
+
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+	const numRows = 25
+	now := time.Now().Truncate(time.Second)
+	if err = conn.Raw(func(dc any) error {
+		b, err := godror.NewDirectBatch(ctx, dc.(godror.Conn),
+			`INSERT INTO `+tbl+` (F_int, F_num, F_text, F_date) VALUES (:1, :2, :3, :4)`, 10,
+			godror.BatchColumn{Type: godror.BatchInt64}, godror.BatchColumn{Type: godror.BatchFloat64},
+			godror.BatchColumn{Type: godror.BatchString, MaxSize: 100}, godror.BatchColumn{Type: godror.BatchTime},
+		)
+		if err != nil {
+			return err
+		}
+		defer b.Close()
+		for i := 0; i < numRows; i++ {
+			b.SetInt64(0, int64(i))
+			b.SetFloat64(1, float64(i)+0.5)
+			if i%5 != 0 {
+				if err := b.SetString(2, fmt.Sprintf("a-%d", i)); err != nil {
+					return err
+				}
+			}
+			b.SetTime(3, now)
+			if err := b.Next(ctx); err != nil {
+				return err
+			}
+		}
+		if err := b.SetString(2, strings.Repeat("x", 101)); err == nil {
+			t.Error("wanted error for a too long string")
+		}
+		if err := b.Flush(ctx); err != nil {
+			return err
+		}
+		if got := b.RowsAffected(); got != numRows {
+			t.Errorf("got %d rows affected, wanted %d", got, numRows)
+		}
+		return b.Close()
+	}); err != nil {
+		t.Fatal(err)
+	}
+
+	rows, err := testDb.QueryContext(ctx, "SELECT F_int, F_num, F_text, F_date FROM "+tbl+" ORDER BY F_int")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer rows.Close()
+	var i int
+	for ; rows.Next(); i++ {
+		var fInt int64
+		var fNum float64
+		var fTxt sql.NullString
+		var fDt time.Time
+		if err = rows.Scan(&fInt, &fNum, &fTxt, &fDt); err != nil {
+			t.Fatal(err)
+		}
+		if fInt != int64(i) || fNum != float64(i)+0.5 || !fDt.Equal(now) {
+			t.Errorf("%d. got %d, %f, %v", i, fInt, fNum, fDt)
+		}
+		if want := fmt.Sprintf("a-%d", i); fTxt.Valid != (i%5 != 0) || fTxt.Valid && fTxt.String != want {
+			t.Errorf("%d. got %+v, wanted %q", i, fTxt, want)
+		}
+	}
+	if i != numRows {
+		t.Errorf("got %d rows, wanted %d", i, numRows)
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=DirectBatch -test.benchmem
+func BenchmarkDirectBatch(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("BenchmarkDirectBatch"), 10*time.Minute)
+	defer cancel()
+
+	tbl := "test_direct_batch_b" + tblSuffix
+	if _, err := testDb.ExecContext(ctx, `CREATE TABLE `+tbl+` (F_int NUMBER(9), F_num NUMBER, F_text VARCHAR2(100))`); err != nil {
+		b.Fatal(err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), "DROP TABLE "+tbl) }()
+	insQry := `INSERT INTO ` + tbl + ` (F_int, F_num, F_text) VALUES (:1, :2, :3)`
+	const limit = 1024
+
+	b.Run("Batch", func(b *testing.B) {
+		stmt, err := testDb.PrepareContext(ctx, insQry)
+		if err != nil {
+			b.Fatal(err)
+		}
+		defer stmt.Close()
+		batch := godror.Batch{Stmt: stmt, Limit: limit}
+		b.ReportAllocs()
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			if err := batch.Add(ctx, i, float64(i)/3, "text"); err != nil {
+				b.Fatal(err)
+			}
+		}
+		if err := batch.Flush(ctx); err != nil {
+			b.Fatal(err)
+		}
+	})
+
+	b.Run("Direct", func(b *testing.B) {
+		conn, err := testDb.Conn(ctx)
+		if err != nil {
+			b.Fatal(err)
+		}
+		defer conn.Close()
+		if err = conn.Raw(func(dc any) error {
+			batch, err := godror.NewDirectBatch(ctx, dc.(godror.Conn), insQry, limit,
+				godror.BatchColumn{Type: godror.BatchInt64}, godror.BatchColumn{Type: godror.BatchFloat64},
+				godror.BatchColumn{Type: godror.BatchString, MaxSize: 100},
+			)
+			if err != nil {
+				return err
+			}
+			defer batch.Close()
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				batch.SetInt64(0, int64(i))
+				batch.SetFloat64(1, float64(i)/3)
+				if err := batch.SetString(2, "text"); err != nil {
+					return err
+				}
+				if err := batch.Next(ctx); err != nil {
+					return err
+				}
+			}
+			return batch.Flush(ctx)
+		}); err != nil {
+			b.Fatal(err)
+		}
+	})
+}
@@ -813,6 +813,130 @@ END;`
 	}
 }
 
+// BenchmarkSelectNumbers compares the fetching of integer (NUMBER(18)) and decimal (NUMBER(20,4)) columns
+// as Number (through the text representation) or as float64 (decoded straight from the OCINumber);
+// see BenchmarkSelectWide for the same with a real table.
+//
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=SelectNumbers -test.benchmem
+func BenchmarkSelectNumbers(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("SelectNumbers"), 30*time.Minute)
+	defer cancel()
+	for _, typ := range []string{"18", "20,4"} {
+		qry := `SELECT CAST(LEVEL*12345 AS NUMBER(` + typ + `)) AS a,
+	                 CAST(-LEVEL/8 AS NUMBER(` + typ + `)) AS b,
+	                 CAST(LEVEL*LEVEL AS NUMBER(` + typ + `)) AS c
+	            FROM DUAL CONNECT BY LEVEL <= 10000`
+		for _, nm := range []string{"Number", "Float64"} {
+			args := []interface{}{godror.FetchArraySize(1024), godror.PrefetchCount(1025)}
+			if nm == "Float64" {
+				args = append(args, godror.NumberAsFloat64())
+			}
+			b.Run(typ+"/"+nm, func(b *testing.B) {
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					rows, err := testDb.QueryContext(ctx, qry, args...)
+					if err != nil {
+						b.Fatalf("%s: %+v", qry, err)
+					}
+					var x, y, z interface{}
+					for rows.Next() {
+						if err = rows.Scan(&x, &y, &z); err != nil {
+							rows.Close()
+							b.Fatal(err)
+						}
+					}
+					rows.Close()
+				}
+			})
+		}
+	}
+}
+
+// BenchmarkSelect300Cols fetches 300 columns (integer and decimal NUMBERs, VARCHAR2s and DATEs) per row,
+// to measure the per-column decoding of rows.Next.
+//
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=Select300Cols -test.benchmem
+func BenchmarkSelect300Cols(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("Select300Cols"), 30*time.Minute)
+	defer cancel()
+	var buf strings.Builder
+	buf.WriteString("SELECT ")
+	for i := 0; i < 300; i++ {
+		if i != 0 {
+			buf.WriteString(", ")
+		}
+		switch i % 4 {
+		case 0:
+			fmt.Fprintf(&buf, "LEVEL+%d", i)
+		case 1:
+			fmt.Fprintf(&buf, "LEVEL/%d", i)
+		case 2:
+			fmt.Fprintf(&buf, "'col-%d'", i)
+		case 3:
+			fmt.Fprintf(&buf, "SYSDATE+%d", i)
+		}
+	}
+	buf.WriteString(" FROM DUAL CONNECT BY LEVEL <= 1000")
+	qry := buf.String()
+	dest := make([]interface{}, 300)
+	ptrs := make([]interface{}, len(dest))
+	for i := range dest {
+		ptrs[i] = &dest[i]
+	}
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		rows, err := testDb.QueryContext(ctx, qry, godror.FetchArraySize(128), godror.PrefetchCount(129))
+		if err != nil {
+			b.Fatal(err)
+		}
+		for rows.Next() {
+			if err = rows.Scan(ptrs...); err != nil {
+				rows.Close()
+				b.Fatal(err)
+			}
+		}
+		rows.Close()
+	}
+}
+
+// BenchmarkExecPrepared executes a prepared statement with the same argument types ("Same", using the cached bind plan),
+// and with alternating argument types ("Alternating", which skips the plan on each execution).
+//
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=ExecPrepared -test.benchmem
+func BenchmarkExecPrepared(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("ExecPrepared"), 10*time.Minute)
+	defer cancel()
+	const qry = `SELECT 1 FROM DUAL WHERE :1 > 0 AND :2 > 0 AND :3 IS NOT NULL AND :4 IS NOT NULL`
+	stmt, err := testDb.PrepareContext(ctx, qry)
+	if err != nil {
+		b.Fatalf("%s: %+v", qry, err)
+	}
+	defer stmt.Close()
+	now := time.Now()
+
+	b.Run("Same", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := stmt.ExecContext(ctx, int64(i+1), float64(i)+0.5, "text-"+strconv.Itoa(i%100), now); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+	b.Run("Alternating", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			var first interface{} = int64(i + 1)
+			if i%2 == 0 {
+				first = int32(i + 1)
+			}
+			if _, err := stmt.ExecContext(ctx, first, float64(i)+0.5, "text-"+strconv.Itoa(i%100), now); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
+
 var benchmarkSelect301LogFh *os.File
 
 func BenchmarkSelect301(b *testing.B) {
@@ -874,3 +998,226 @@ func BenchmarkSelect301(b *testing.B) {
 	}
 	b.Log(nm, oid, typ, ts)
 }
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=HandlePool -test.cpuprofile=/tmp/cpu.prof && go tool pprof godror.v2.test /tmp/cpu.prof
+//
+// Each GetPoolStats call acquires and releases an OCI error handle per
+// attribute read, so this measures contention on the shared handle pool.
+func BenchmarkHandlePool(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("HandlePool"), time.Minute)
+	defer cancel()
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer conn.Close()
+	var cx godror.Conn
+	if err = godror.Raw(ctx, conn, func(c godror.Conn) error { cx = c; return nil }); err != nil {
+		b.Fatal(err)
+	}
+
+	for _, threads := range []int{1, 8, 64, 256} {
+		b.Run(strconv.Itoa(threads), func(b *testing.B) {
+			b.SetParallelism((threads + runtime.GOMAXPROCS(0) - 1) / runtime.GOMAXPROCS(0))
+			b.ResetTimer()
+			b.RunParallel(func(pb *testing.PB) {
+				runtime.LockOSThread()
+				defer runtime.UnlockOSThread()
+				for pb.Next() {
+					if _, err := cx.GetPoolStats(); err != nil {
+						b.Error(err)
+						return
+					}
+				}
+			})
+		})
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=VarArena -test.benchmem
+func BenchmarkVarArena(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("VarArena"), time.Minute)
+	defer cancel()
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer conn.Close()
+	const qry = "SELECT LEVEL, TO_CHAR(LEVEL), SYSDATE FROM DUAL CONNECT BY LEVEL <= 3"
+
+	for _, tC := range []struct {
+		Name    string
+		Options []interface{}
+	}{
+		{"plain", nil},
+		{"arena", []interface{}{godror.VarArena()}},
+	} {
+		b.Run(tC.Name, func(b *testing.B) {
+			var n int64
+			var s string
+			var t time.Time
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				rows, err := conn.QueryContext(ctx, qry, tC.Options...)
+				if err != nil {
+					b.Fatal(err)
+				}
+				for rows.Next() {
+					if err = rows.Scan(&n, &s, &t); err != nil {
+						rows.Close()
+						b.Fatal(err)
+					}
+				}
+				rows.Close()
+			}
+		})
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=ReuseQueryVars -test.benchmem
+func BenchmarkReuseQueryVars(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("ReuseQueryVars"), time.Minute)
+	defer cancel()
+	const qry = "SELECT :1 + LEVEL, TO_CHAR(LEVEL), SYSDATE FROM DUAL CONNECT BY LEVEL <= 3"
+
+	for _, tC := range []struct {
+		Name   string
+		Option godror.Option
+	}{
+		{"plain", nil},
+		{"reuse", godror.ReuseQueryVars()},
+	} {
+		b.Run(tC.Name, func(b *testing.B) {
+			stmt, err := testDb.PrepareContext(ctx, qry)
+			if err != nil {
+				b.Fatal(err)
+			}
+			defer stmt.Close()
+			var n int64
+			var s string
+			var t time.Time
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				rows, err := stmt.QueryContext(ctx, i, tC.Option)
+				if err != nil {
+					b.Fatal(err)
+				}
+				for rows.Next() {
+					if err = rows.Scan(&n, &s, &t); err != nil {
+						rows.Close()
+						b.Fatal(err)
+					}
+				}
+				rows.Close()
+			}
+		})
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=StringCodes -test.benchmem
+func BenchmarkStringCodes(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("StringCodes"), 5*time.Minute)
+	defer cancel()
+	const qry = "SELECT DECODE(MOD(LEVEL, 3), 0, 'OPEN', 1, 'CLOSED', 'PENDING'), 'C'||MOD(LEVEL, 20) FROM DUAL CONNECT BY LEVEL <= 1000"
+
+	for _, tC := range []struct {
+		Name    string
+		Options []interface{}
+	}{
+		{"plain", nil},
+		{"intern", []interface{}{godror.InternStrings(0)}},
+		{"borrow", []interface{}{godror.BorrowBytes()}},
+	} {
+		b.Run(tC.Name, func(b *testing.B) {
+			var status, currency sql.RawBytes
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				rows, err := testDb.QueryContext(ctx, qry, append(tC.Options, godror.FetchArraySize(1000))...)
+				if err != nil {
+					b.Fatal(err)
+				}
+				var n int
+				for rows.Next() {
+					if err = rows.Scan(&status, &currency); err != nil {
+						rows.Close()
+						b.Fatal(err)
+					}
+					if n++; len(status) < 4 || len(currency) < 2 || currency[0] != 'C' {
+						rows.Close()
+						b.Fatalf("%d. got %q, %q", n, status, currency)
+					}
+				}
+				err = rows.Err()
+				rows.Close()
+				if err != nil {
+					b.Fatal(err)
+				} else if n != 1000 {
+					b.Fatalf("got %d rows, wanted 1000", n)
+				}
+			}
+		})
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=Connect -test.benchmem
+func BenchmarkConnect(b *testing.B) {
+	P, err := godror.ParseDSN(testConStr)
+	if err != nil {
+		b.Fatal(err)
+	}
+	if P.IsStandalone() {
+		b.Skip("needs a pool")
+	}
+	ctx, cancel := context.WithTimeout(testContext("Connect"), 5*time.Minute)
+	defer cancel()
+	connector := godror.NewConnector(P)
+	// warm up the pool
+	cx, err := connector.Connect(ctx)
+	if err != nil {
+		b.Fatal(err)
+	}
+	cx.Close()
+
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		cx, err := connector.Connect(ctx)
+		if err != nil {
+			b.Fatal(err)
+		}
+		cx.Close()
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=Pipeline -test.benchmem
+func BenchmarkPipeline(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("Pipeline"), time.Minute)
+	defer cancel()
+	cx, err := testDb.Conn(ctx)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer cx.Close()
+	const qry, n = "DECLARE v VARCHAR2(10) := :1; BEGIN NULL; END;", 10
+
+	b.Run("sequential", func(b *testing.B) {
+		for i := 0; i < b.N; i++ {
+			for j := 0; j < n; j++ {
+				if _, err := cx.ExecContext(ctx, qry, "X"); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}
+	})
+	b.Run("pipeline", func(b *testing.B) {
+		p := godror.NewPipeline(cx)
+		for i := 0; i < b.N; i++ {
+			for j := 0; j < n; j++ {
+				p.Exec(qry, "X")
+			}
+			if _, err := p.Run(ctx); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
@@ -0,0 +1,241 @@
+// Copyright 2026 The Godror Authors
+//
+//
+// SPDX-License-Identifier: UPL-1.0 OR Apache-2.0
+
+package godror_test
+
+import (
+	"context"
+	"database/sql"
+	"strconv"
+	"strings"
+	"testing"
+	"time"
+	"unsafe"
+
+	godror "github.com/godror/godror"
+)
+
+func TestQueryColumns(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("QueryColumns"), 30*time.Second)
+	defer cancel()
+
+	const qry = `SELECT CAST(LEVEL AS NUMBER(9)) AS id, LEVEL/4 AS ratio, TRUNC(SYSDATE) + LEVEL AS dt,
+	                    DECODE(MOD(LEVEL, 3), 0, NULL, 'row ' || LEVEL) AS txt
+	               FROM DUAL CONNECT BY LEVEL <= :1`
+	const rowCount = 250
+	for _, compact := range []bool{false, true} {
+		t.Run("compact="+strconv.FormatBool(compact), func(t *testing.T) {
+			args := []interface{}{rowCount, godror.FetchArraySize(100)}
+			if compact {
+				args = append(args, godror.CompactFetch())
+			}
+			dest := make([]godror.ColumnBuffer, 4)
+			var total, batches int
+			var first time.Time
+			if err := godror.QueryColumns(ctx, testDb, qry, args, dest,
+				func(dest []godror.ColumnBuffer, n int) error {
+					batches++
+					ids, ratios, dts, txts := dest[0].Int64, dest[1].Float64, dest[2].Time, dest[3].String
+					if len(ids) != n || len(ratios) != n || len(dts) != n || len(txts) != n {
+						t.Fatalf("got %d/%d/%d/%d values, wanted %d", len(ids), len(ratios), len(dts), len(txts), n)
+					}
+					for j := 0; j < n; j++ {
+						total++
+						if ids[j] != int64(total) {
+							t.Errorf("%d. id: got %d", total, ids[j])
+						}
+						if want := float64(total) / 4; ratios[j] != want {
+							t.Errorf("%d. ratio: got %f, wanted %f", total, ratios[j], want)
+						}
+						if total == 1 {
+							first = dts[j]
+						} else if got := dts[j].Sub(first); got != time.Duration(total-1)*24*time.Hour {
+							t.Errorf("%d. dt: got %v (%s after the first)", total, dts[j], got)
+						}
+						if total%3 == 0 {
+							if !dest[3].IsNull(j) || txts[j] != "" {
+								t.Errorf("%d. txt: wanted NULL, got %q", total, txts[j])
+							}
+						} else if want := "row " + strconv.Itoa(total); dest[3].IsNull(j) || txts[j] != want {
+							t.Errorf("%d. txt: got %q, wanted %q", total, txts[j], want)
+						}
+					}
+					return nil
+				},
+			); err != nil {
+				t.Fatal(err)
+			}
+			if total != rowCount || batches != 3 {
+				t.Errorf("got %d rows in %d batches, wanted %d in 3", total, batches, rowCount)
+			}
+		})
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=FetchColumns -test.benchmem
+func BenchmarkFetchColumns(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("FetchColumns"), 5*time.Minute)
+	defer cancel()
+	const qry = `SELECT CAST(LEVEL AS NUMBER(9)), LEVEL/7, SYSDATE + LEVEL/86400, 'row ' || LEVEL FROM DUAL CONNECT BY LEVEL <= 10000`
+
+	b.Run("Next", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			rows, err := testDb.QueryContext(ctx, qry, godror.FetchArraySize(1024))
+			if err != nil {
+				b.Fatal(err)
+			}
+			var id int64
+			var ratio float64
+			var dt time.Time
+			var txt string
+			for rows.Next() {
+				if err = rows.Scan(&id, &ratio, &dt, &txt); err != nil {
+					rows.Close()
+					b.Fatal(err)
+				}
+			}
+			rows.Close()
+		}
+	})
+
+	b.Run("Columns", func(b *testing.B) {
+		b.ReportAllocs()
+		dest := make([]godror.ColumnBuffer, 4)
+		for i := 0; i < b.N; i++ {
+			if err := godror.QueryColumns(ctx, testDb, qry, []interface{}{godror.FetchArraySize(1024)}, dest,
+				func([]godror.ColumnBuffer, int) error { return nil },
+			); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
+
+func TestParallelQuery(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("ParallelQuery"), 30*time.Second)
+	defer cancel()
+	tbl := "test_parallel_query" + tblSuffix
+	testDb.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err := testDb.ExecContext(ctx, "CREATE TABLE "+tbl+" (id NUMBER(6), txt VARCHAR2(20))"); err != nil {
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+	const rowCount, degree = 1000, 4
+	if _, err := testDb.ExecContext(ctx,
+		"INSERT INTO "+tbl+" (id, txt) SELECT LEVEL, 'row '||LEVEL FROM DUAL CONNECT BY LEVEL <= :1", rowCount,
+	); err != nil {
+		t.Fatal(err)
+	}
+
+	for _, compact := range []bool{false, true} {
+		t.Run("compact="+strconv.FormatBool(compact), func(t *testing.T) {
+			args := []interface{}{sql.Named("min_id", 0), godror.FetchArraySize(100)}
+			if compact {
+				args = append(args, godror.CompactFetch())
+			}
+			seen := make([]bool, rowCount+1)
+			chunks := make(map[int]int)
+			if err := godror.ParallelQuery(ctx, testDb, tbl,
+				"SELECT id, txt FROM "+tbl+" WHERE ROWID BETWEEN :rowid_lo AND :rowid_hi AND id > :min_id",
+				degree, args,
+				func(chunk int, dest []godror.ColumnBuffer, n int) error {
+					chunks[chunk] += n
+					for j, id := range dest[0].Int64[:n] {
+						if id <= 0 || id > rowCount || seen[id] {
+							t.Errorf("%d. chunk: unexpected id %d", chunk, id)
+							continue
+						}
+						seen[id] = true
+						if want := "row " + strconv.FormatInt(id, 10); dest[1].String[j] != want {
+							t.Errorf("%d. txt: got %q, wanted %q", id, dest[1].String[j], want)
+						}
+					}
+					return nil
+				},
+			); err != nil {
+				t.Fatal(err)
+			}
+			t.Logf("chunks: %v", chunks)
+			if len(chunks) != degree {
+				t.Errorf("got %d chunks, wanted %d", len(chunks), degree)
+			}
+			for id, ok := range seen[1:] {
+				if !ok {
+					t.Errorf("%d. row is missing", id+1)
+				}
+			}
+		})
+	}
+}
+
+func TestQueryArrow(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("QueryArrow"), 30*time.Second)
+	defer cancel()
+
+	const qry = `SELECT CAST(LEVEL AS NUMBER(9)) AS id, LEVEL/4 AS ratio,
+	                    TO_DATE('2024-01-01', 'YYYY-MM-DD') + LEVEL AS dt,
+	                    DECODE(MOD(LEVEL, 3), 0, NULL, 'row ' || LEVEL) AS txt
+	               FROM DUAL CONNECT BY LEVEL <= :1`
+	const rowCount = 250
+	base := time.Date(2024, 1, 1, 0, 0, 0, 0, time.UTC)
+	for _, compact := range []bool{false, true} {
+		t.Run("compact="+strconv.FormatBool(compact), func(t *testing.T) {
+			args := []interface{}{rowCount, godror.FetchArraySize(100)}
+			if compact {
+				args = append(args, godror.CompactFetch())
+			}
+			var total, batches int
+			if err := godror.QueryArrow(ctx, testDb, qry, args,
+				func(batch *godror.ArrowRecordBatch) error {
+					batches++
+					if batches == 1 {
+						var formats []string
+						for _, f := range batch.Fields {
+							formats = append(formats, f.Format)
+						}
+						if got, want := strings.Join(formats, ","), "l,g,tsu:,u"; got != want {
+							t.Fatalf("got formats %q, wanted %q", got, want)
+						}
+					}
+					ids := unsafe.Slice((*int64)(unsafe.Pointer(unsafe.SliceData(batch.Columns[0].Values))), batch.NumRows)
+					ratios := unsafe.Slice((*float64)(unsafe.Pointer(unsafe.SliceData(batch.Columns[1].Values))), batch.NumRows)
+					dts := unsafe.Slice((*int64)(unsafe.Pointer(unsafe.SliceData(batch.Columns[2].Values))), batch.NumRows)
+					txt := batch.Columns[3]
+					for j := 0; j < batch.NumRows; j++ {
+						total++
+						if ids[j] != int64(total) {
+							t.Errorf("%d. id: got %d", total, ids[j])
+						}
+						if want := float64(total) / 4; ratios[j] != want {
+							t.Errorf("%d. ratio: got %f, wanted %f", total, ratios[j], want)
+						}
+						if want := base.AddDate(0, 0, total).UnixMicro(); dts[j] != want {
+							t.Errorf("%d. dt: got %d, wanted %d", total, dts[j], want)
+						}
+						valid := txt.Validity[j>>3]&(1<<(j&7)) != 0
+						s := string(txt.Values[txt.Offsets[j]:txt.Offsets[j+1]])
+						if total%3 == 0 {
+							if valid || s != "" {
+								t.Errorf("%d. txt: wanted NULL, got %q", total, s)
+							}
+						} else if want := "row " + strconv.Itoa(total); !valid || s != want {
+							t.Errorf("%d. txt: got %q, wanted %q", total, s, want)
+						}
+					}
+					return nil
+				},
+			); err != nil {
+				t.Fatal(err)
+			}
+			if total != rowCount || batches != 3 {
+				t.Errorf("got %d rows in %d batches, wanted %d in 3", total, batches, rowCount)
+			}
+		})
+	}
+}
@@ -128,3 +128,52 @@ func printConnStats(t testing.TB, db *sql.DB) {
 	})
 	cancel()
 }
+
+// BenchmarkConcurrentRefCount stresses handle reference counting from many
+// threads at once: each query allocates, addRefs and releases a statement
+// and its variables on its own connection.
+//
+// go test -c && ./godror.test -test.run=^$ -test.bench=ConcurrentRefCount -test.cpu=1,2,4,8,16
+func BenchmarkConcurrentRefCount(b *testing.B) {
+	ctx, cancel := context.WithTimeout(testContext("ConcurrentRefCount"), 5*time.Minute)
+	defer cancel()
+	const qry = "SELECT LEVEL, TO_CHAR(LEVEL) FROM DUAL CONNECT BY LEVEL <= 10"
+	b.ReportAllocs()
+	b.ResetTimer()
+	b.RunParallel(func(pb *testing.PB) {
+		conn, err := testDb.Conn(ctx)
+		if err != nil {
+			b.Error(err)
+			return
+		}
+		defer conn.Close()
+		stmt, err := conn.PrepareContext(ctx, qry)
+		if err != nil {
+			b.Error(err)
+			return
+		}
+		defer stmt.Close()
+		var n int64
+		var s string
+		for pb.Next() {
+			rows, err := stmt.QueryContext(ctx, godror.FetchArraySize(16))
+			if err != nil {
+				b.Error(err)
+				return
+			}
+			for rows.Next() {
+				if err = rows.Scan(&n, &s); err != nil {
+					break
+				}
+			}
+			if err == nil {
+				err = rows.Err()
+			}
+			rows.Close()
+			if err != nil {
+				b.Error(err)
+				return
+			}
+		}
+	})
+}
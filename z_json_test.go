@@ -11,6 +11,7 @@ import (
 	"encoding/json"
 	"errors"
 	"fmt"
+	"io"
 	"reflect"
 	"strconv"
 	"strings"
@@ -903,3 +904,150 @@ func TestJSONIssue371(t *testing.T) {
 		t.Log("The JSON Map object is:", gotmap)
 	}
 }
+
+func TestJSONGetPath(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("JSONGetPath"), 30*time.Second)
+	defer cancel()
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+	tbl := "test_json_getpath" + tblSuffix
+	conn.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err = conn.ExecContext(ctx,
+		"CREATE TABLE "+tbl+" (id NUMBER(6), jdoc JSON)", //nolint:gas
+	); err != nil {
+		if errIs(err, 902, "invalid datatype") {
+			t.Skip(err)
+		}
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+
+	const jsonstring = `{"person":{"Name":"Alex","first name":"Al","creditScore":[700,250,340],"address":{"city":"Budapest"}}}`
+	if _, err = conn.ExecContext(ctx, "INSERT INTO "+tbl+" (id, jdoc) VALUES (1, :1)",
+		godror.JSONString{Value: jsonstring}); err != nil {
+		t.Fatal(err)
+	}
+	var jsondoc godror.JSON
+	if err = conn.QueryRowContext(ctx, "SELECT jdoc FROM "+tbl).Scan(&jsondoc); err != nil {
+		t.Fatal(err)
+	}
+	for path, want := range map[string]interface{}{
+		"$.person.Name":            "Alex",
+		`$.person."first name"`:    "Al",
+		"$.person.creditScore[1]":  godror.Number("250"),
+		"$.person.address.city":    "Budapest",
+		"$.person.address":         map[string]interface{}{"city": "Budapest"},
+		"$.person.creditScore[3]":  nil,
+		"$.person.missing":         nil,
+		"$.person.Name.length":     nil,
+		"$.person.creditScore.x":   nil,
+		`$.person.address["city"]`: errors.New("syntax"),
+	} {
+		scalar, err := jsondoc.GetPath(path, godror.JSONOptNumberAsString)
+		if wantErr, ok := want.(error); ok {
+			if err == nil || errors.Is(err, godror.ErrJSONPathNotFound) {
+				t.Errorf("%s: wanted %v error, got %v", path, wantErr, err)
+			}
+			continue
+		}
+		if want == nil {
+			if !errors.Is(err, godror.ErrJSONPathNotFound) {
+				t.Errorf("%s: wanted ErrJSONPathNotFound, got %v", path, err)
+			}
+			continue
+		}
+		if err != nil {
+			t.Errorf("%s: %+v", path, err)
+			continue
+		}
+		got, err := scalar.GetValue()
+		if err != nil {
+			t.Errorf("%s: %+v", path, err)
+		} else if !reflect.DeepEqual(got, want) {
+			t.Errorf("%s: got %#v, wanted %#v", path, got, want)
+		}
+	}
+}
+
+func TestSODA(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("SODA"), 30*time.Second)
+	defer cancel()
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+	sdb, err := godror.NewSodaDatabase(ctx, conn)
+	if err != nil {
+		t.Skip(err)
+	}
+	defer sdb.Close()
+	name := "test_soda" + tblSuffix
+	coll, err := sdb.CreateCollection(ctx, name, "")
+	if err != nil {
+		t.Skip(err)
+	}
+	defer func() { coll.Drop(context.Background()) }()
+
+	const n = 100
+	contents := make([][]byte, n)
+	for i := range contents {
+		contents[i] = []byte(fmt.Sprintf(`{"id":%d,"name":"doc %d"}`, i, i))
+	}
+	inserted, err := coll.InsertMany(ctx, contents)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(inserted) != n || inserted[0].Key == "" || inserted[0].Key == inserted[n-1].Key {
+		t.Fatalf("inserted %d: %+v", len(inserted), inserted)
+	}
+
+	if cnt, err := coll.Count(ctx, godror.SodaOperation{Filter: `{"id":{"$gte":90}}`}); err != nil {
+		t.Fatal(err)
+	} else if cnt != 10 {
+		t.Errorf("count: got %d, wanted 10", cnt)
+	}
+	doc, err := coll.FindOne(ctx, godror.SodaOperation{Key: inserted[42].Key})
+	if err != nil {
+		t.Fatal(err)
+	}
+	var m map[string]interface{}
+	if err = json.Unmarshal(doc.Content, &m); err != nil {
+		t.Fatalf("%s: %+v", doc.Content, err)
+	} else if m["id"] != float64(42) {
+		t.Errorf("FindOne: got %v, wanted id=42", m)
+	}
+
+	cur, err := coll.Find(ctx, godror.SodaOperation{FetchArraySize: 16})
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer cur.Close()
+	seen := make(map[string]struct{}, n)
+	for {
+		if err = cur.Next(ctx, &doc); err != nil {
+			if errors.Is(err, io.EOF) {
+				break
+			}
+			t.Fatal(err)
+		}
+		seen[doc.Key] = struct{}{}
+	}
+	if len(seen) != n {
+		t.Errorf("Find: got %d documents, wanted %d", len(seen), n)
+	}
+
+	if names, err := sdb.CollectionNames(ctx, name, 1); err != nil {
+		t.Error(err)
+	} else if len(names) != 1 || names[0] != name {
+		t.Errorf("CollectionNames: got %q, wanted %q", names, name)
+	}
+	if _, err = sdb.OpenCollection(ctx, name+"_missing"); !errors.Is(err, godror.ErrNotExist) {
+		t.Errorf("OpenCollection missing: got %v, wanted ErrNotExist", err)
+	}
+}
@@ -16,6 +16,7 @@ import (
 	"io"
 	"log"
 	"log/slog"
+	"os"
 	"strings"
 	"sync"
 	"testing"
@@ -169,6 +170,185 @@ func TestInsertLargeLOB(t *testing.T) {
 	}
 }
 
+func TestBLOBWriteTo(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("BLOBWriteTo"), 60*time.Second)
+	defer cancel()
+
+	tbl := "test_blob_writeto" + tblSuffix
+	drQry := "DROP TABLE " + tbl
+	_, _ = testDb.ExecContext(ctx, drQry)
+	crQry := "CREATE TABLE " + tbl + " (F_size NUMBER(9) NOT NULL, F_data BLOB NOT NULL)"
+	if _, err := testDb.ExecContext(ctx, crQry); err != nil {
+		t.Fatal(crQry, err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), drQry) }()
+
+	insQry := "INSERT INTO " + tbl + " (F_size, F_data) VALUES (:1, :2)"
+	selQry := "SELECT F_data FROM " + tbl + " WHERE F_size = :1"
+	for _, size := range []int{1, 8131, 1 << 20, 3<<20 + 17} {
+		data := make([]byte, size)
+		for i := range data {
+			data[i] = byte(i * 7 / 3)
+		}
+		if _, err := testDb.ExecContext(ctx, insQry, size, godror.Lob{Reader: bytes.NewReader(data)}); err != nil {
+			t.Fatalf("%s [%d]: %+v", insQry, size, err)
+		}
+		var lobI any
+		if err := testDb.QueryRowContext(ctx, selQry, size, godror.LobAsReader()).Scan(&lobI); err != nil {
+			t.Fatalf("%s [%d]: %+v", selQry, size, err)
+		}
+		lob := lobI.(*godror.Lob)
+		// read something first, to check that WriteTo continues from there
+		head := make([]byte, 1)
+		if _, err := io.ReadFull(lob, head); err != nil {
+			t.Fatalf("%d: read head: %+v", size, err)
+		}
+		var buf bytes.Buffer
+		n, err := lob.WriteTo(&buf)
+		if err != nil {
+			t.Errorf("%d: WriteTo: %+v", size, err)
+		}
+		if got := append(head, buf.Bytes()...); n != int64(size-1) || !bytes.Equal(got, data) {
+			t.Errorf("%d: got %d bytes (WriteTo said %d), wanted %d", size, len(got), n, size)
+		}
+	}
+}
+
+func TestDirectLobCopyTo(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("DirectLobCopyTo"), 60*time.Second)
+	defer cancel()
+
+	tbl := "test_directlob_copyto" + tblSuffix
+	drQry := "DROP TABLE " + tbl
+	_, _ = testDb.ExecContext(ctx, drQry)
+	crQry := "CREATE TABLE " + tbl + " (F_id NUMBER(9) NOT NULL, F_data BLOB NOT NULL)"
+	if _, err := testDb.ExecContext(ctx, crQry); err != nil {
+		t.Fatal(crQry, err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), drQry) }()
+
+	data := make([]byte, 5<<20+3)
+	for i := range data {
+		data[i] = byte(i * 13 / 7)
+	}
+	insQry := "INSERT INTO " + tbl + " (F_id, F_data) VALUES (1, :1)"
+	if _, err := testDb.ExecContext(ctx, insQry, godror.Lob{Reader: bytes.NewReader(data)}); err != nil {
+		t.Fatalf("%s: %+v", insQry, err)
+	}
+
+	selQry := "SELECT F_data FROM " + tbl + " WHERE F_id = :1"
+	// the locator is valid while the rows are open
+	rows, err := testDb.QueryContext(ctx, selQry, 1, godror.LobAsReader())
+	if err != nil {
+		t.Fatalf("%s: %+v", selQry, err)
+	}
+	defer rows.Close()
+	if !rows.Next() {
+		t.Fatalf("%s: no rows: %+v", selQry, rows.Err())
+	}
+	var lobI any
+	if err = rows.Scan(&lobI); err != nil {
+		t.Fatal(err)
+	}
+	dl, err := lobI.(*godror.Lob).Hijack()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer dl.Close()
+	opts := godror.ParallelLobOptions{
+		DB: testDb, Query: selQry, Args: []interface{}{1},
+		Parallelism: 3, RangeSize: 1 << 20,
+	}
+
+	fh, err := os.CreateTemp(t.TempDir(), "copyto-*.bin")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer fh.Close()
+	n, err := dl.CopyTo(ctx, fh, opts)
+	if err != nil {
+		t.Fatalf("CopyTo: %+v", err)
+	}
+	got, err := os.ReadFile(fh.Name())
+	if err != nil {
+		t.Fatal(err)
+	}
+	if n != int64(len(data)) || !bytes.Equal(got, data) {
+		t.Errorf("CopyTo: got %d bytes (said %d), wanted %d", len(got), n, len(data))
+	}
+
+	p := make([]byte, 2<<20+5)
+	const offset = 1<<20 - 1
+	k, err := dl.ParallelReadAt(ctx, p, offset, opts)
+	if err != nil {
+		t.Fatalf("ParallelReadAt: %+v", err)
+	}
+	if k != len(p) || !bytes.Equal(p, data[offset:offset+len(p)]) {
+		t.Errorf("ParallelReadAt: got %d bytes, wanted %d", k, len(p))
+	}
+}
+
+func TestInsertLOBBatch(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("InsertLOBBatch"), 60*time.Second)
+	defer cancel()
+
+	tbl := "test_insert_lob_batch" + tblSuffix
+	drQry := "DROP TABLE " + tbl
+	_, _ = testDb.ExecContext(ctx, drQry)
+	crQry := "CREATE TABLE " + tbl + " (F_id NUMBER(9) NOT NULL, F_clob CLOB, F_blob BLOB)"
+	if _, err := testDb.ExecContext(ctx, crQry); err != nil {
+		t.Fatal(crQry, err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), drQry) }()
+
+	const rowCount = 1000
+	ids := make([]int, rowCount)
+	clobs := make([]godror.Lob, rowCount)
+	blobs := make([]godror.Lob, rowCount)
+	for i := range ids {
+		ids[i] = i
+		if i%10 == 0 {
+			continue // NULLs
+		}
+		size := i * 37
+		clobs[i] = godror.Lob{IsClob: true, Reader: strings.NewReader(strings.Repeat("x", size))}
+		blobs[i] = godror.Lob{Reader: bytes.NewReader(bytes.Repeat([]byte{byte(i)}, size))}
+	}
+	insQry := "INSERT INTO " + tbl + " (F_id, F_clob, F_blob) VALUES (:1, :2, :3)"
+	if _, err := testDb.ExecContext(ctx, insQry, ids, clobs, blobs); err != nil {
+		t.Fatalf("%s: %+v", insQry, err)
+	}
+
+	selQry := "SELECT F_id, NVL(DBMS_LOB.getlength(F_clob), 0), NVL(DBMS_LOB.getlength(F_blob), 0), DBMS_LOB.substr(F_blob, 1, 1) FROM " + tbl + " ORDER BY 1"
+	rows, err := testDb.QueryContext(ctx, selQry)
+	if err != nil {
+		t.Fatalf("%s: %+v", selQry, err)
+	}
+	defer rows.Close()
+	var n int
+	for rows.Next() {
+		var id, clobLen, blobLen int
+		var first []byte
+		if err = rows.Scan(&id, &clobLen, &blobLen, &first); err != nil {
+			t.Fatal(err)
+		}
+		n++
+		want := id * 37
+		if id%10 == 0 {
+			want = 0
+		}
+		if clobLen != want || blobLen != want || want != 0 && (len(first) != 1 || first[0] != byte(id)) {
+			t.Errorf("%d. got clob=%d blob=%d (%v), wanted %d", id, clobLen, blobLen, first, want)
+		}
+	}
+	if err = rows.Err(); err != nil {
+		t.Fatal(err)
+	}
+	if n != rowCount {
+		t.Errorf("got %d rows, wanted %d", n, rowCount)
+	}
+}
+
 func TestCloseTempLOB(t *testing.T) {
 	//godror.SetLogger(godror.NewLogfmtLogger(os.Stdout))
 	P, err := dsn.Parse(testConStr)
@@ -657,3 +837,99 @@ func TestCLOBSurrogate(t *testing.T) {
 	})
 
 }
+
+func TestLOBLocatorReuse(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("LOBLocatorReuse"), 60*time.Second)
+	defer cancel()
+
+	tbl := "test_lob_reuse" + tblSuffix
+	drQry := "DROP TABLE " + tbl
+	_, _ = testDb.ExecContext(ctx, drQry)
+	crQry := "CREATE TABLE " + tbl + " (F_id NUMBER(9) NOT NULL, F_blob BLOB)"
+	if _, err := testDb.ExecContext(ctx, crQry); err != nil {
+		t.Fatal(crQry, err)
+	}
+	defer func() { _, _ = testDb.ExecContext(context.Background(), drQry) }()
+
+	const rowCount = 10
+	ids := make([]int, rowCount)
+	blobs := make([]godror.Lob, rowCount)
+	for i := range ids {
+		ids[i] = i
+		blobs[i] = godror.Lob{Reader: bytes.NewReader(bytes.Repeat([]byte{byte('a' + i)}, 100+i))}
+	}
+	insQry := "INSERT INTO " + tbl + " (F_id, F_blob) VALUES (:1, :2)"
+	if _, err := testDb.ExecContext(ctx, insQry, ids, blobs); err != nil {
+		t.Fatalf("%s: %+v", insQry, err)
+	}
+
+	// The first Lob is kept unread through the following fetches, which must not reuse its locator,
+	// and the second one till rows.Close, which releases it.
+	// The reuse of the locators read till their end is checked by BenchmarkMockLOB (see godror.MockAllocations).
+	selQry := "SELECT F_id, F_blob FROM " + tbl + " ORDER BY 1"
+	for _, asReader := range []bool{false, true} {
+		args := []interface{}{godror.FetchArraySize(3), godror.PrefetchCount(4)}
+		if asReader {
+			args = append(args, godror.LobAsReader())
+		}
+		rows, err := testDb.QueryContext(ctx, selQry, args...)
+		if err != nil {
+			t.Fatalf("%s: %+v", selQry, err)
+		}
+		var first, second io.Reader
+		var n int
+		for rows.Next() {
+			var id int
+			var got []byte
+			if asReader {
+				var lobI interface{}
+				if err = rows.Scan(&id, &lobI); err != nil {
+					break
+				}
+				lob := lobI.(*godror.Lob)
+				if first == nil {
+					first = lob.Reader
+					continue
+				} else if second == nil {
+					second = lob.Reader
+					continue
+				}
+				got, err = io.ReadAll(lob)
+			} else {
+				err = rows.Scan(&id, &got)
+			}
+			if err != nil {
+				break
+			}
+			n++
+			if want := bytes.Repeat([]byte{byte('a' + id)}, 100+id); !bytes.Equal(got, want) {
+				t.Errorf("%d. got %q, wanted %q", id, got, want)
+			}
+		}
+		if err == nil {
+			err = rows.Err()
+		}
+		if err == nil && first != nil {
+			n++
+			var got []byte
+			if got, err = io.ReadAll(first); err == nil {
+				if want := bytes.Repeat([]byte{'a'}, 100); !bytes.Equal(got, want) {
+					t.Errorf("first: got %q, wanted %q", got, want)
+				}
+			}
+		}
+		rows.Close()
+		if err != nil {
+			t.Fatal(err)
+		}
+		if second != nil {
+			n++
+			if got, err := io.ReadAll(second); err == nil {
+				t.Errorf("second: read %q after rows.Close, wanted error", got)
+			}
+		}
+		if n != rowCount {
+			t.Errorf("got %d rows, wanted %d", n, rowCount)
+		}
+	}
+}
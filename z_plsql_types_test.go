@@ -1276,6 +1276,338 @@ func TestObjectTypeClose(t *testing.T) {
 	}
 }
 
+func TestObjectGetAttributes(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("ObjectGetAttributes"), 30*time.Second)
+	defer cancel()
+	typeName, listName := "test_getattrs_t"+tblSuffix, "test_getattrs_lt"+tblSuffix
+	for _, qry := range []string{
+		`CREATE OR REPLACE TYPE ` + typeName + ` FORCE AS OBJECT (id NUMBER(10), amount NUMBER(18,2), txt VARCHAR2(100))`,
+		`CREATE OR REPLACE TYPE ` + listName + ` FORCE AS TABLE OF NUMBER`,
+	} {
+		if _, err := testDb.ExecContext(ctx, qry); err != nil {
+			t.Fatalf("%s: %+v", qry, err)
+		}
+	}
+	defer func() {
+		testDb.ExecContext(context.Background(), "DROP TYPE "+listName+" FORCE")
+		testDb.ExecContext(context.Background(), "DROP TYPE "+typeName+" FORCE")
+	}()
+
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+
+	ot, err := godror.GetObjectType(ctx, conn, typeName)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer ot.Close()
+	obj, err := ot.NewObject()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer obj.Close()
+	for k, v := range map[string]interface{}{"ID": 42, "AMOUNT": godror.Number("3.14"), "TXT": "árvíztűrő"} {
+		if err = obj.Set(k, v); err != nil {
+			t.Fatalf("Set(%q, %v): %+v", k, v, err)
+		}
+	}
+	values, err := obj.GetAttributes(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i, nm := range ot.AttributeNames() {
+		var d godror.Data
+		if err = obj.GetAttribute(&d, nm); err != nil {
+			t.Fatal(err)
+		}
+		if got, want := fmt.Sprintf("%v", values[i].Get()), fmt.Sprintf("%v", d.Get()); got != want {
+			t.Errorf("%s: got %q, wanted %q", nm, got, want)
+		}
+	}
+
+	lt, err := godror.GetObjectType(ctx, conn, listName)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer lt.Close()
+	list, err := lt.NewCollection()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer list.Close()
+	want := make([]string, 0, 100)
+	for i := 0; i < cap(want); i++ {
+		if err = list.Append(float64(i) / 4); err != nil {
+			t.Fatal(err)
+		}
+		want = append(want, fmt.Sprintf("%v", float64(i)/4))
+	}
+	items, err := list.GetItems(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	got := make([]string, len(items))
+	for i := range items {
+		got[i] = fmt.Sprintf("%v", items[i].Get())
+	}
+	if d := cmp.Diff(want, got); d != "" {
+		t.Error(d)
+	}
+}
+
+func TestObjectTypeShared(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("ObjectTypeShared"), 30*time.Second)
+	defer cancel()
+	addrName, personName, listName := "test_shared_addr_t"+tblSuffix, "test_shared_person_t"+tblSuffix, "test_shared_person_lt"+tblSuffix
+	for _, qry := range []string{
+		`CREATE OR REPLACE TYPE ` + addrName + ` FORCE AS OBJECT (city VARCHAR2(30))`,
+		`CREATE OR REPLACE TYPE ` + personName + ` FORCE AS OBJECT (name VARCHAR2(30), home ` + addrName + `, work ` + addrName + `)`,
+		`CREATE OR REPLACE TYPE ` + listName + ` FORCE AS TABLE OF ` + personName,
+	} {
+		if _, err := testDb.ExecContext(ctx, qry); err != nil {
+			t.Fatalf("%s: %+v", qry, err)
+		}
+	}
+	defer func() {
+		testDb.ExecContext(context.Background(), "DROP TYPE "+listName+" FORCE")
+		testDb.ExecContext(context.Background(), "DROP TYPE "+personName+" FORCE")
+		testDb.ExecContext(context.Background(), "DROP TYPE "+addrName+" FORCE")
+	}()
+
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+
+	lt, err := godror.GetObjectType(ctx, conn, listName)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer lt.Close()
+	pt := lt.CollectionOf
+	if pt == nil {
+		t.Fatalf("%s is not a collection", lt)
+	}
+	home, work := pt.Attributes["HOME"].ObjectType, pt.Attributes["WORK"].ObjectType
+	if home == nil || home != work {
+		t.Errorf("HOME (%p) and WORK (%p) should share the same ObjectType", home, work)
+	}
+
+	person, err := pt.NewObject()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer person.Close()
+	for _, nm := range []string{"HOME", "WORK"} {
+		addr, err := pt.Attributes[nm].ObjectType.NewObject()
+		if err != nil {
+			t.Fatal(err)
+		}
+		err = addr.Set("CITY", nm+" city")
+		if err == nil {
+			err = person.Set(nm, addr)
+		}
+		addr.Close()
+		if err != nil {
+			t.Fatalf("%s: %+v", nm, err)
+		}
+	}
+	m, err := person.AsMap(true)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for _, nm := range []string{"HOME", "WORK"} {
+		addr, _ := m[nm].(map[string]interface{})
+		if got, want := fmt.Sprintf("%v", addr["CITY"]), nm+" city"; got != want {
+			t.Errorf("%s: got %q, wanted %q (%v)", nm, got, want, m)
+		}
+	}
+}
+
+func TestCollectionNativeSlices(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("CollectionNativeSlices"), 30*time.Second)
+	defer cancel()
+	numList, strList := "test_natslice_nt"+tblSuffix, "test_natslice_st"+tblSuffix
+	for _, qry := range []string{
+		`CREATE OR REPLACE TYPE ` + numList + ` FORCE AS TABLE OF NUMBER`,
+		`CREATE OR REPLACE TYPE ` + strList + ` FORCE AS TABLE OF VARCHAR2(100)`,
+	} {
+		if _, err := testDb.ExecContext(ctx, qry); err != nil {
+			t.Fatalf("%s: %+v", qry, err)
+		}
+	}
+	defer func() {
+		testDb.ExecContext(context.Background(), "DROP TYPE "+numList+" FORCE")
+		testDb.ExecContext(context.Background(), "DROP TYPE "+strList+" FORCE")
+	}()
+
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+
+	nt, err := godror.GetObjectType(ctx, conn, numList)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer nt.Close()
+	nums, err := nt.NewCollection()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer nums.Close()
+	// more than one OCICollGetElemArray batch
+	want := make([]int64, 1000)
+	for i := range want {
+		want[i] = int64(i*i) - 500
+	}
+	if err = nums.AppendInt64s(want); err != nil {
+		t.Fatal(err)
+	}
+	got, err := nums.GetInt64s(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if d := cmp.Diff(want, got); d != "" {
+		t.Error(d)
+	}
+	floats, err := nums.GetFloat64s(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(floats) != len(want) || floats[10] != float64(want[10]) {
+		t.Errorf("got %d floats (%v), wanted %d", len(floats), floats[10], len(want))
+	}
+	// sparse
+	if err = nums.Delete(1); err != nil {
+		t.Fatal(err)
+	}
+	if got, err = nums.GetInt64s(got); err != nil {
+		t.Fatal(err)
+	} else if d := cmp.Diff(append(want[:1:1], want[2:]...), got); d != "" {
+		t.Error(d)
+	}
+
+	st, err := godror.GetObjectType(ctx, conn, strList)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer st.Close()
+	strs, err := st.NewCollection()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer strs.Close()
+	wantS := []string{"a", "árvíztűrő tükörfúrógép", "", "z"}
+	if err = strs.AppendStrings(wantS); err != nil {
+		t.Fatal(err)
+	}
+	if err = strs.FromSlice([]interface{}{"x", "y"}); err != nil {
+		t.Fatal(err)
+	}
+	gotS, err := strs.GetStrings(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if d := cmp.Diff(append(wantS, "x", "y"), gotS); d != "" {
+		t.Error(d)
+	}
+}
+
+func TestCollectionNativeSlicesIndexBy(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("CollectionNativeSlicesIndexBy"), 30*time.Second)
+	defer cancel()
+	conn, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer conn.Close()
+	testCon, err := godror.DriverConn(ctx, conn)
+	if err != nil {
+		t.Fatal(err)
+	}
+
+	pkg := strings.ToUpper("test_natslice_pkg" + tblSuffix)
+	if err = prepExec(ctx, testCon, `CREATE OR REPLACE PACKAGE `+pkg+` IS
+  TYPE num_tab_typ IS TABLE OF NUMBER INDEX BY PLS_INTEGER;
+  PROCEDURE fill(p_tab IN OUT NOCOPY num_tab_typ, p_from IN PLS_INTEGER, p_step IN PLS_INTEGER, p_n IN PLS_INTEGER);
+END;`); err != nil {
+		t.Fatal(err)
+	}
+	defer testDb.ExecContext(context.Background(), "DROP PACKAGE "+pkg)
+	if err = prepExec(ctx, testCon, `CREATE OR REPLACE PACKAGE BODY `+pkg+` IS
+  PROCEDURE fill(p_tab IN OUT NOCOPY num_tab_typ, p_from IN PLS_INTEGER, p_step IN PLS_INTEGER, p_n IN PLS_INTEGER) IS
+  BEGIN
+    p_tab.DELETE;
+    FOR i IN 0..p_n-1 LOOP
+      p_tab(p_from + i*p_step) := i*i - 500;
+    END LOOP;
+  END fill;
+END;`); err != nil {
+		t.Fatal(err)
+	}
+
+	ot, err := testCon.GetObjectType(pkg + ".NUM_TAB_TYP")
+	if err != nil {
+		if clientVersion, _ := godror.ClientVersion(ctx, testDb); clientVersion.Version < 12 {
+			t.Skipf("client=%d < 12: %+v", clientVersion.Version, err)
+		}
+		t.Fatalf("%+v", err)
+	}
+	defer ot.Close()
+	coll, err := ot.NewCollection()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer coll.Close()
+
+	// index-by tables are keyed by any integers, not contiguous from zero
+	for _, tc := range []struct {
+		Name          string
+		From, Step, N int
+	}{
+		{Name: "fromOne", From: 1, Step: 1, N: 1000},
+		{Name: "negative", From: -7, Step: 1, N: 20},
+		{Name: "sparse", From: -7, Step: 3, N: 300},
+	} {
+		if err = prepExec(ctx, testCon, "BEGIN "+pkg+".fill(:1, :2, :3, :4); END;",
+			driver.NamedValue{Ordinal: 1, Value: coll},
+			driver.NamedValue{Ordinal: 2, Value: tc.From},
+			driver.NamedValue{Ordinal: 3, Value: tc.Step},
+			driver.NamedValue{Ordinal: 4, Value: tc.N},
+		); err != nil {
+			t.Fatalf("%s: %+v", tc.Name, err)
+		}
+		want := make([]int64, tc.N)
+		for i := range want {
+			want[i] = int64(i*i) - 500
+		}
+		got, err := coll.GetInt64s(nil)
+		if err != nil {
+			t.Fatalf("%s: %+v", tc.Name, err)
+		}
+		if d := cmp.Diff(want, got); d != "" {
+			t.Errorf("%s: %s", tc.Name, d)
+		}
+		floats, err := coll.GetFloat64s(nil)
+		if err != nil {
+			t.Fatalf("%s: %+v", tc.Name, err)
+		}
+		if len(floats) != len(want) || floats[len(floats)-1] != float64(want[len(want)-1]) {
+			t.Errorf("%s: got %d floats, wanted %d", tc.Name, len(floats), len(want))
+		}
+	}
+}
+
 // See https://github.com/godror/godror/issues/180
 func TestSubObjectTypeClose(t *testing.T) {
 	ctx, cancel := context.WithTimeout(testContext("SubObjectTypeClose"), 30*time.Second)
@@ -10,6 +10,7 @@ import (
 	"errors"
 	"fmt"
 	"testing"
+	"time"
 
 	godror "github.com/godror/godror"
 )
@@ -80,3 +81,83 @@ func TestQRCN(t *testing.T) {
 	testDb.Exec("INSERT INTO test_subscr (i) VALUES (0)")
 	t.Log("events:", events)
 }
+
+func TestResultCache(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("ResultCache"), time.Minute)
+	defer cancel()
+
+	tbl := "test_rescache" + tblSuffix
+	testDb.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err := testDb.ExecContext(ctx, "CREATE TABLE "+tbl+" (id NUMBER(9), name VARCHAR2(40))"); err != nil {
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+	if _, err := testDb.ExecContext(ctx, "INSERT INTO "+tbl+" (id, name) VALUES (1, 'one')"); err != nil {
+		t.Fatal(err)
+	}
+
+	rc, err := godror.NewResultCache(ctx, testDb, 0)
+	if err != nil {
+		var ec interface{ Code() int }
+		if errors.As(err, &ec) {
+			switch ec.Code() {
+			case 29970, 65131, 1031, 29972:
+				t.Skip(err.Error())
+			}
+		}
+		t.Fatalf("%+v", err)
+	}
+	defer rc.Close()
+
+	qry := "SELECT name FROM " + tbl + " WHERE id = :1"
+	res1, err := rc.Query(ctx, qry, 1)
+	if err != nil {
+		t.Fatalf("%s: %+v", qry, err)
+	}
+	t.Log(res1.Columns, res1.Rows)
+	if len(res1.Rows) != 1 || res1.Rows[0][0] != "one" {
+		t.Fatalf("got %v, wanted [[one]]", res1.Rows)
+	}
+	if res2, err := rc.Query(ctx, qry, 1); err != nil {
+		t.Fatal(err)
+	} else if res2 != res1 {
+		t.Error("second query is not served from the cache")
+	}
+	if res3, err := rc.Query(ctx, qry, 2); err != nil {
+		t.Fatal(err)
+	} else if len(res3.Rows) != 0 {
+		t.Errorf("got %v for id=2, wanted nothing", res3.Rows)
+	}
+
+	// the borrowed bytes point into the fetch buffer, so the cache must copy them
+	bQry := "SELECT name, id FROM " + tbl + " WHERE id = :1"
+	resB, err := rc.Query(ctx, bQry, godror.BorrowBytes(), 1)
+	if err != nil {
+		t.Fatalf("%s: %+v", bQry, err)
+	}
+	if _, err := rc.Query(ctx, "SELECT 'xyz' AS name, 2 AS id FROM DUAL", godror.BorrowBytes()); err != nil {
+		t.Fatal(err)
+	}
+	if len(resB.Rows) != 1 {
+		t.Fatalf("got %v, wanted [[one 1]]", resB.Rows)
+	} else if b, ok := resB.Rows[0][0].([]byte); !ok || string(b) != "one" {
+		t.Errorf("got %#v with BorrowBytes, wanted \"one\"", resB.Rows[0][0])
+	}
+
+	if _, err := testDb.ExecContext(ctx, "UPDATE "+tbl+" SET name = 'egy' WHERE id = 1"); err != nil {
+		t.Fatal(err)
+	}
+	for start := time.Now(); time.Since(start) < 30*time.Second; time.Sleep(100 * time.Millisecond) {
+		res, err := rc.Query(ctx, qry, 1)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if res != res1 {
+			if len(res.Rows) != 1 || res.Rows[0][0] != "egy" {
+				t.Errorf("got %v after the update, wanted [[egy]]", res.Rows)
+			}
+			return
+		}
+	}
+	t.Skip("no change notification arrived (is the database able to connect back to the client?)")
+}
@@ -5237,3 +5237,264 @@ func TestWarningAsError(t *testing.T) {
 		}
 	}
 }
+
+// TestConcurrentErrors checks that the errors got inline (without a locked OS thread)
+// are not mixed up between goroutines.
+func TestConcurrentErrors(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("ConcurrentErrors"), 30*time.Second)
+	defer cancel()
+	grp, ctx := errgroup.WithContext(ctx)
+	for i := 0; i < 8; i++ {
+		i := i
+		grp.Go(func() error {
+			for j := 0; j < 10; j++ {
+				msg := fmt.Sprintf("godror-%d-%d", i, j)
+				_, err := testDb.ExecContext(ctx, "BEGIN RAISE_APPLICATION_ERROR(-20001, :1); END;", msg)
+				if err == nil {
+					return fmt.Errorf("%s: no error", msg)
+				}
+				if !strings.Contains(err.Error(), msg) {
+					return fmt.Errorf("wanted %q, got %w", msg, err)
+				}
+			}
+			return nil
+		})
+	}
+	if err := grp.Wait(); err != nil {
+		t.Fatal(err)
+	}
+}
+
+func TestConnStats(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("ConnStats"), 30*time.Second)
+	defer cancel()
+	cx, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer cx.Close()
+	getStats := func() godror.ConnStats {
+		stats, err := godror.GetConnStats(ctx, cx)
+		if err != nil {
+			t.Fatal(err)
+		}
+		return stats
+	}
+
+	before := getStats()
+	rows, err := cx.QueryContext(ctx, "SELECT LEVEL FROM DUAL CONNECT BY LEVEL <= 250", godror.FetchArraySize(100))
+	if err != nil {
+		t.Fatal(err)
+	}
+	var n int
+	for rows.Next() {
+		n++
+	}
+	rows.Close()
+	if err = rows.Err(); err != nil {
+		t.Fatal(err)
+	}
+	tx, err := cx.BeginTx(ctx, nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err = tx.Commit(); err != nil {
+		t.Fatal(err)
+	}
+	delta := getStats().Sub(before)
+	t.Logf("delta: %s", delta)
+	if delta.Executes != 1 || delta.RowsFetched != 250 || delta.Fetches < 3 || delta.Commits != 1 || delta.FetchTime <= 0 {
+		t.Errorf("got %+v, wanted 1 execute, 250 rows in at least 3 fetches and 1 commit", delta)
+	}
+}
+
+func TestSessionTag(t *testing.T) {
+	t.Parallel()
+	P, err := godror.ParseDSN(testConStr)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if P.IsStandalone() {
+		t.Skip("needs a pool")
+	}
+	// a pool of its own
+	P.MinSessions, P.MaxSessions, P.SessionIncrement = 0, 3, 1
+	db := sql.OpenDB(godror.NewConnector(P))
+	defer db.Close()
+	db.SetMaxIdleConns(0)
+	ctx, cancel := context.WithTimeout(testContext("SessionTag"), 30*time.Second)
+	defer cancel()
+
+	const qry = "SELECT SYS_CONTEXT('USERENV', 'SID'), SYS_CONTEXT('USERENV', 'NLS_DATE_FORMAT') FROM DUAL"
+	const dateFormat = "YYYY-MM-DD\"tagged\""
+	tagCtx := godror.ContextWithSessionTag(ctx, "TestSessionTag")
+	var sid1, sid2, format string
+	setUp := func() error {
+		cx, err := db.Conn(tagCtx)
+		if err != nil {
+			return err
+		}
+		defer cx.Close()
+		if _, err = cx.ExecContext(ctx, "ALTER SESSION SET NLS_DATE_FORMAT='"+dateFormat+"'"); err != nil {
+			return err
+		}
+		return cx.QueryRowContext(ctx, qry).Scan(&sid1, &format)
+	}
+	if err = setUp(); err != nil {
+		t.Fatal(err)
+	}
+
+	if err = db.QueryRowContext(tagCtx, qry).Scan(&sid2, &format); err != nil {
+		t.Fatal(err)
+	}
+	t.Logf("sid1=%s sid2=%s format=%q", sid1, sid2, format)
+	if sid1 != sid2 || format != dateFormat {
+		t.Errorf("got session %s with date format %q, wanted the tagged session %s with %q", sid2, format, sid1, dateFormat)
+	}
+}
+
+func TestPipeline(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("Pipeline"), 30*time.Second)
+	defer cancel()
+	cx, err := testDb.Conn(ctx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer cx.Close()
+	tbl := "test_pipeline" + tblSuffix
+	cx.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err = cx.ExecContext(ctx, "CREATE TABLE "+tbl+" (id NUMBER(6) PRIMARY KEY, name VARCHAR2(10))"); err != nil {
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+
+	var results []godror.PipelineResult
+	before, err := godror.GetConnStats(ctx, cx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	// the PL/SQL blocks bind each distinct name once, so they must be recognized as such
+	if results, err = godror.NewPipeline(cx).
+		Exec("INSERT INTO "+tbl+" (id, name) VALUES (:1, :2)", 1, "one").
+		Exec("INSERT INTO "+tbl+" (id, name) VALUES (:1, :2)", 1, "dup").
+		Exec("INSERT INTO "+tbl+" (id, name) SELECT id+1, :1 FROM "+tbl, "two").
+		Exec("UPDATE "+tbl+" SET name = :name||name WHERE id > :id", sql.Named("name", "x"), sql.Named("id", 0)).
+		Query("SELECT id, name FROM "+tbl+" WHERE id >= :1 ORDER BY id", 1).
+		Exec("BEGIN\n  IF :a = :a THEN NULL; END IF;\nEND;", 1).
+		Exec("DECLARE\tv NUMBER := :x; w NUMBER := :x;\nBEGIN NULL; END;", 2).
+		Commit().
+		Run(ctx); err != nil {
+		t.Fatal(err)
+	}
+	after, err := godror.GetConnStats(ctx, cx)
+	if err != nil {
+		t.Fatal(err)
+	}
+	delta := after.Sub(before)
+	t.Logf("delta: %s", delta)
+	if delta.Executes != 1 {
+		t.Errorf("got %d executes, wanted 1", delta.Executes)
+	}
+	if len(results) != 8 {
+		t.Fatalf("got %d results, wanted 8", len(results))
+	}
+	for i, want := range []int64{1, 0, 1, 2} {
+		if results[i].RowsAffected != want {
+			t.Errorf("%d. got %d rows affected, wanted %d", i, results[i].RowsAffected, want)
+		}
+	}
+	if oerr, ok := godror.AsOraErr(results[1].Err); !ok || oerr.Code() != 1 {
+		t.Errorf("1. got %v, wanted ORA-00001", results[1].Err)
+	}
+	for i, r := range results {
+		if i != 1 && r.Err != nil {
+			t.Errorf("%d. %+v", i, r.Err)
+		}
+	}
+	if results[4].Rows == nil {
+		t.Fatal("no rows for the query")
+	}
+	rows, err := godror.WrapRows(ctx, cx, results[4].Rows)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer rows.Close()
+	var got []string
+	for rows.Next() {
+		var id int
+		var name string
+		if err = rows.Scan(&id, &name); err != nil {
+			t.Fatal(err)
+		}
+		got = append(got, strconv.Itoa(id)+"="+name)
+	}
+	if err = rows.Err(); err != nil {
+		t.Fatal(err)
+	}
+	if want := []string{"1=xone", "2=xtwo"}; !reflect.DeepEqual(got, want) {
+		t.Errorf("got %q, wanted %q", got, want)
+	}
+
+	// the final END; of a PL/SQL unit is part of its source
+	proc := "test_pipeline_proc" + tblSuffix
+	defer testDb.Exec("DROP PROCEDURE " + proc)
+	if results, err = godror.NewPipeline(cx).
+		Exec("CREATE OR REPLACE PROCEDURE " + proc + " IS\nBEGIN\n  NULL;\nEND;").
+		Run(ctx); err != nil {
+		t.Fatal(err)
+	}
+	if results[0].Err != nil {
+		t.Fatal(results[0].Err)
+	}
+	if _, err = cx.ExecContext(ctx, "BEGIN "+proc+"; END;"); err != nil {
+		t.Errorf("%s is invalid: %+v", proc, err)
+	}
+}
+
+func TestCompactFetch(t *testing.T) {
+	ctx, cancel := context.WithTimeout(testContext("CompactFetch"), 30*time.Second)
+	defer cancel()
+	const qry = `SELECT LEVEL, DECODE(MOD(LEVEL, 5), 0, NULL, 'v'||LEVEL), CAST('c'||MOD(LEVEL, 3) AS CHAR(4)),
+		DECODE(MOD(LEVEL, 7), 0, NULL, HEXTORAW(TO_CHAR(LEVEL, 'FM0X'))),
+		TO_BINARY_DOUBLE(LEVEL)/4, DECODE(MOD(LEVEL, 4), 0, NULL, TO_BINARY_FLOAT(LEVEL))
+	  FROM DUAL CONNECT BY LEVEL <= 250`
+
+	var results [2][]string
+	for k, compact := range []bool{false, true} {
+		args := []interface{}{godror.FetchArraySize(100)}
+		if compact {
+			args = append(args, godror.CompactFetch())
+		}
+		rows, err := testDb.QueryContext(ctx, qry, args...)
+		if err != nil {
+			t.Fatalf("%s: %+v", qry, err)
+		}
+		for rows.Next() {
+			var id int
+			var s, c sql.NullString
+			var raw []byte
+			var d sql.NullFloat64
+			var f interface{}
+			if err = rows.Scan(&id, &s, &c, &raw, &d, &f); err != nil {
+				break
+			}
+			results[k] = append(results[k], fmt.Sprintf("%d %v %v %x %v %v", id, s, c, raw, d, f))
+		}
+		if err == nil {
+			err = rows.Err()
+		}
+		rows.Close()
+		if err != nil {
+			t.Fatal(err)
+		}
+	}
+	if len(results[0]) != 250 {
+		t.Errorf("got %d rows, wanted 250", len(results[0]))
+	}
+	if d := cmp.Diff(results[0], results[1]); d != "" {
+		t.Error(d)
+	}
+}
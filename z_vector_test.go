@@ -10,6 +10,7 @@ import (
 	crand "crypto/rand"
 	"database/sql"
 	"fmt"
+	"math"
 	"math/rand/v2"
 	"reflect"
 	"sort"
@@ -478,3 +479,306 @@ func TestVectorPointerCases(t *testing.T) {
 		compareSparseVector(t, id, sparse2, sparseVec2)
 	}
 }
+
+// It Verifies fetching Vector columns contiguously with QueryColumns.
+func TestVectorFetchColumns(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("VectorFetchColumns"), 30*time.Second)
+	defer cancel()
+
+	tbl := "test_vector_columns" + tblSuffix
+	testDb.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err := testDb.ExecContext(ctx,
+		`CREATE TABLE `+tbl+` (id NUMBER(6), f32 Vector(3, float32), i8 Vector(4, int8))`,
+	); err != nil {
+		if errIs(err, 902, "invalid datatype") {
+			t.Skip(err)
+		}
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+
+	const rowCount = 5
+	for i := 1; i <= rowCount; i++ {
+		var f32, i8 interface{}
+		if i != 3 {
+			f32 = godror.Vector{Values: []float32{float32(i), float32(i) / 2, -float32(i)}}
+			i8 = godror.Vector{Values: []int8{int8(i), 0, -int8(i), 1}}
+		}
+		if _, err := testDb.ExecContext(ctx,
+			"INSERT INTO "+tbl+" (id, f32, i8) VALUES (:1, :2, :3)", i, f32, i8,
+		); err != nil {
+			t.Fatal(err)
+		}
+	}
+
+	dest := make([]godror.ColumnBuffer, 3)
+	var total int
+	if err := godror.QueryColumns(ctx, testDb, "SELECT id, f32, i8 FROM "+tbl+" ORDER BY id",
+		[]interface{}{godror.FetchArraySize(2)}, dest,
+		func(dest []godror.ColumnBuffer, n int) error {
+			if dest[1].Dimensions != 3 || len(dest[1].VectorFloat32) != 3*n {
+				t.Fatalf("got %d float32s of %d dimensions for %d rows", len(dest[1].VectorFloat32), dest[1].Dimensions, n)
+			}
+			if dest[2].Dimensions != 4 || len(dest[2].VectorInt8) != 4*n {
+				t.Fatalf("got %d int8s of %d dimensions for %d rows", len(dest[2].VectorInt8), dest[2].Dimensions, n)
+			}
+			for j := 0; j < n; j++ {
+				total++
+				id := dest[0].Int64[j]
+				f32, i8 := dest[1].VectorFloat32[3*j:3*j+3], dest[2].VectorInt8[4*j:4*j+4]
+				wantF32 := []float32{float32(id), float32(id) / 2, -float32(id)}
+				wantI8 := []int8{int8(id), 0, -int8(id), 1}
+				if id == 3 {
+					if !dest[1].IsNull(j) || !dest[2].IsNull(j) {
+						t.Errorf("%d. wanted NULLs", id)
+					}
+					wantF32, wantI8 = make([]float32, 3), make([]int8, 4)
+				}
+				if !reflect.DeepEqual(f32, wantF32) {
+					t.Errorf("%d. f32: got %v, wanted %v", id, f32, wantF32)
+				}
+				if !reflect.DeepEqual(i8, wantI8) {
+					t.Errorf("%d. i8: got %v, wanted %v", id, i8, wantI8)
+				}
+			}
+			return nil
+		},
+	); err != nil {
+		t.Fatal(err)
+	}
+	if total != rowCount {
+		t.Errorf("got %d rows, wanted %d", total, rowCount)
+	}
+}
+
+// naiveDistance is the straightforward Go loop the kernels are checked against.
+func naiveDistance(metric godror.VectorDistanceMetric, a, b []float32) float64 {
+	var dot, aa, bb, dd, diff float64
+	for i := range a {
+		x, y := float64(a[i]), float64(b[i])
+		dot, aa, bb, dd = dot+x*y, aa+x*x, bb+y*y, dd+(x-y)*(x-y)
+		if x != y {
+			diff++
+		}
+	}
+	switch metric {
+	case godror.DistanceCosine:
+		return 1 - dot/math.Sqrt(aa*bb)
+	case godror.DistanceDot:
+		return -dot
+	case godror.DistanceEuclidean:
+		return math.Sqrt(dd)
+	case godror.DistanceEuclideanSquared:
+		return dd
+	}
+	return diff
+}
+
+func TestVectorDistance(t *testing.T) {
+	t.Parallel()
+	metrics := []godror.VectorDistanceMetric{
+		godror.DistanceCosine, godror.DistanceDot, godror.DistanceEuclidean,
+		godror.DistanceEuclideanSquared, godror.DistanceHamming,
+	}
+	for _, dims := range []int{3, 31, 100, 1536} {
+		a, b := randomFloat32Slice(dims), randomFloat32Slice(dims)
+		b[0] = a[0]
+		for _, metric := range metrics {
+			want := naiveDistance(metric, a, b)
+			got, err := godror.VectorDistance(metric, godror.Vector{Values: a}, godror.Vector{Values: b})
+			if err != nil {
+				t.Fatal(err)
+			}
+			if math.Abs(got-want) > 1e-4*math.Max(1, math.Abs(want)) {
+				t.Errorf("%d dims, metric %d: got %g, wanted %g", dims, metric, got, want)
+			}
+		}
+	}
+
+	// sparse vs. dense
+	dense := godror.Vector{Values: []float64{0, 1.5, 0, -2, 0}}
+	sparse := godror.Vector{Values: []float64{3, -2}, Indices: []uint32{0, 3}, Dimensions: 5, IsSparse: true}
+	if got, err := godror.VectorDistance(godror.DistanceEuclideanSquared, dense, sparse); err != nil {
+		t.Fatal(err)
+	} else if got != 9+1.5*1.5 {
+		t.Errorf("sparse: got %g, wanted %g", got, 9+1.5*1.5)
+	}
+	if got, err := godror.VectorDistance(godror.DistanceDot, sparse, sparse); err != nil {
+		t.Fatal(err)
+	} else if got != -13 {
+		t.Errorf("sparse dot: got %g, wanted -13", got)
+	}
+
+	// binary
+	if got, err := godror.VectorDistance(godror.DistanceHamming,
+		godror.Vector{Values: []uint8{0xff, 0x0f}}, godror.Vector{Values: []uint8{0x0f, 0x0f}},
+	); err != nil {
+		t.Fatal(err)
+	} else if got != 4 {
+		t.Errorf("binary hamming: got %g, wanted 4", got)
+	}
+	if _, err := godror.VectorDistance(godror.DistanceCosine,
+		godror.Vector{Values: []uint8{1}}, godror.Vector{Values: []uint8{1}},
+	); err == nil {
+		t.Error("wanted error for BINARY COSINE")
+	}
+}
+
+func TestVectorTopK(t *testing.T) {
+	t.Parallel()
+	const dims, rows, k = 64, 1000, 7
+	query := randomFloat32Slice(dims)
+	topK := godror.VectorTopK{Metric: godror.DistanceEuclidean, Query: query, K: k}
+	var all []godror.VectorHit
+	cb := godror.ColumnBuffer{Dimensions: dims}
+	for batch := 0; batch < rows/100; batch++ {
+		cb.VectorFloat32 = randomFloat32Slice(100 * dims)
+		for j := 0; j < 100; j++ {
+			all = append(all, godror.VectorHit{
+				Row:      batch*100 + j,
+				Distance: float32(naiveDistance(godror.DistanceEuclidean, query, cb.VectorFloat32[j*dims:(j+1)*dims])),
+			})
+		}
+		if err := topK.Add(&cb); err != nil {
+			t.Fatal(err)
+		}
+	}
+	sort.Slice(all, func(i, j int) bool { return all[i].Distance < all[j].Distance })
+	hits := topK.Hits()
+	if len(hits) != k {
+		t.Fatalf("got %d hits, wanted %d", len(hits), k)
+	}
+	for i, h := range hits {
+		if h.Row != all[i].Row {
+			t.Errorf("%d. got %+v, wanted %+v", i, h, all[i])
+		}
+	}
+}
+
+// go test -c && ./godror.v2.test -test.run=^$ -test.bench=VectorDistances -test.benchmem
+func BenchmarkVectorDistances(b *testing.B) {
+	const dims, rows = 1536, 1000
+	query, matrix := randomFloat32Slice(dims), randomFloat32Slice(rows*dims)
+	distances := make([]float32, rows)
+	for _, metric := range []godror.VectorDistanceMetric{godror.DistanceCosine, godror.DistanceDot, godror.DistanceEuclidean} {
+		b.Run(fmt.Sprintf("naive-%d", metric), func(b *testing.B) {
+			b.SetBytes(rows * dims * 4)
+			for i := 0; i < b.N; i++ {
+				for j := range distances {
+					distances[j] = float32(naiveDistance(metric, query, matrix[j*dims:(j+1)*dims]))
+				}
+			}
+		})
+		b.Run(fmt.Sprintf("kernel-%d", metric), func(b *testing.B) {
+			b.SetBytes(rows * dims * 4)
+			for i := 0; i < b.N; i++ {
+				var err error
+				if distances, err = godror.VectorDistances(metric, query, matrix, distances); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// It Verifies the batch insert of a VectorMatrix.
+func TestVectorMatrixInsert(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("VectorMatrixInsert"), 30*time.Second)
+	defer cancel()
+
+	tbl := "test_vector_matrix" + tblSuffix
+	testDb.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err := testDb.ExecContext(ctx,
+		`CREATE TABLE `+tbl+` (id NUMBER(6), f32 Vector(8, float32))`,
+	); err != nil {
+		if errIs(err, 902, "invalid datatype") {
+			t.Skip(err)
+		}
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+
+	const dims, rowCount = 8, 1000
+	ids := make([]int, rowCount)
+	for i := range ids {
+		ids[i] = i
+	}
+	values := randomFloat32Slice(dims * rowCount)
+	res, err := testDb.ExecContext(ctx, "INSERT INTO "+tbl+" (id, f32) VALUES (:1, :2)",
+		ids, godror.VectorMatrix{Values: values, Dimensions: dims})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if n, err := res.RowsAffected(); err != nil {
+		t.Fatal(err)
+	} else if n != rowCount {
+		t.Errorf("inserted %d rows, wanted %d", n, rowCount)
+	}
+
+	dest := make([]godror.ColumnBuffer, 2)
+	var total int
+	if err := godror.QueryColumns(ctx, testDb, "SELECT id, f32 FROM "+tbl+" ORDER BY id", nil, dest,
+		func(dest []godror.ColumnBuffer, n int) error {
+			for j := 0; j < n; j++ {
+				id := int(dest[0].Int64[j])
+				got, want := dest[1].VectorFloat32[j*dims:(j+1)*dims], values[id*dims:(id+1)*dims]
+				if !reflect.DeepEqual(got, want) {
+					t.Errorf("%d. got %v, wanted %v", id, got, want)
+				}
+				total++
+			}
+			return nil
+		},
+	); err != nil {
+		t.Fatal(err)
+	}
+	if total != rowCount {
+		t.Errorf("got %d rows, wanted %d", total, rowCount)
+	}
+
+	if _, err := testDb.ExecContext(ctx, "INSERT INTO "+tbl+" (id, f32) VALUES (:1, :2)",
+		ids[:2], godror.VectorMatrix{Values: values[:3*dims], Dimensions: dims},
+	); err == nil {
+		t.Error("wanted error for mismatched row counts")
+	}
+}
+
+// It Verifies that QueryColumns refuses the vectors of a flexible dimension column
+// which have other dimensions than the ColumnBuffer, instead of overflowing it.
+func TestVectorFetchColumnsFlexible(t *testing.T) {
+	t.Parallel()
+	ctx, cancel := context.WithTimeout(testContext("VectorFetchColumnsFlexible"), 30*time.Second)
+	defer cancel()
+
+	tbl := "test_vector_flexcols" + tblSuffix
+	testDb.ExecContext(ctx, "DROP TABLE "+tbl)
+	if _, err := testDb.ExecContext(ctx,
+		`CREATE TABLE `+tbl+` (id NUMBER(6), f32 Vector(*, float32))`,
+	); err != nil {
+		if errIs(err, 902, "invalid datatype") {
+			t.Skip(err)
+		}
+		t.Fatal(err)
+	}
+	defer testDb.Exec("DROP TABLE " + tbl)
+
+	for i, values := range [][]float32{{1, 2, 3}, {4, 5, 6, 7, 8, 9, 10, 11}} {
+		if _, err := testDb.ExecContext(ctx,
+			"INSERT INTO "+tbl+" (id, f32) VALUES (:1, :2)", i, godror.Vector{Values: values},
+		); err != nil {
+			t.Fatal(err)
+		}
+	}
+
+	dest := []godror.ColumnBuffer{{}, {Dimensions: 3, VectorFloat32: []float32{}}}
+	err := godror.QueryColumns(ctx, testDb, "SELECT id, f32 FROM "+tbl+" ORDER BY id",
+		[]interface{}{godror.FetchArraySize(2)}, dest,
+		func(dest []godror.ColumnBuffer, n int) error { return nil },
+	)
+	t.Log(err)
+	if err == nil {
+		t.Error("wanted error for the vector of 8 dimensions")
+	}
+}